@@ -0,0 +1,240 @@
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+#include <pagmo/algorithm.hpp>
+#include <pagmo/algorithms/bee_colony.hpp>
+#include <pagmo/algorithms/de.hpp>
+#include <pagmo/algorithms/de1220.hpp>
+#include <pagmo/algorithms/gaco.hpp>
+#include <pagmo/algorithms/gwo.hpp>
+#include <pagmo/algorithms/ihs.hpp>
+#include <pagmo/algorithms/maco.hpp>
+#include <pagmo/algorithms/moead.hpp>
+#include <pagmo/algorithms/nsga2.hpp>
+#include <pagmo/algorithms/nspso.hpp>
+#include <pagmo/algorithms/pso.hpp>
+#include <pagmo/algorithms/pso_gen.hpp>
+#include <pagmo/algorithms/sade.hpp>
+#include <pagmo/algorithms/sga.hpp>
+#include <pagmo/config.hpp>
+#include <pagmo/population.hpp>
+#include <pagmo/problem.hpp>
+#include <pagmo/problems/dtlz.hpp>
+#include <pagmo/problems/rastrigin.hpp>
+#include <pagmo/problems/zdt.hpp>
+#include <pagmo/types.hpp>
+
+#if defined(PAGMO_WITH_EIGEN3)
+#include <pagmo/algorithms/cmaes.hpp>
+#include <pagmo/algorithms/xnes.hpp>
+#endif
+
+#include "bench_utils.hpp"
+
+// This benchmark runs the population-based algorithms on cheap reference problems,
+// and it splits the runtime of each evolution into the time spent evaluating fitness
+// functions and the time spent in the algorithm itself. The evaluation time is estimated
+// by multiplying the number of fitness evaluations performed during the evolution
+// (as reported by the fevals counter of the problem) by the measured cost of a single
+// call to problem::fitness().
+
+using namespace pagmo;
+using namespace pagmo_bench;
+
+namespace
+{
+
+// Peak resident set size of the process, in kilobytes (0 if not available).
+// NOTE: this is a process-wide high-water mark, thus it can only grow
+// during the execution of the benchmark.
+long peak_rss_kb()
+{
+#if defined(__unix__) || defined(__APPLE__)
+    rusage ru;
+    if (getrusage(RUSAGE_SELF, &ru) == 0) {
+#if defined(__APPLE__)
+        // On OSX, ru_maxrss is in bytes.
+        return static_cast<long>(ru.ru_maxrss / 1024);
+#else
+        return static_cast<long>(ru.ru_maxrss);
+#endif
+    }
+#endif
+    return 0;
+}
+
+// Average cost of a single call to problem::fitness(), in seconds.
+double fitness_cost(const options &opts, const problem &prob)
+{
+    std::mt19937 eng(42u);
+    const auto bounds = prob.get_bounds();
+    std::vector<vector_double> xs(1000u, vector_double(prob.get_nx()));
+    for (auto &x : xs) {
+        for (decltype(x.size()) i = 0; i < x.size(); ++i) {
+            x[i] = std::uniform_real_distribution<double>(bounds.first[i], bounds.second[i])(eng);
+        }
+    }
+    const auto r = time_it(opts, "", {}, [&prob, &xs]() {
+        for (const auto &x : xs) {
+            (void)prob.fitness(x);
+        }
+    });
+    return r.median / static_cast<double>(xs.size());
+}
+
+struct algo_entry {
+    std::string name;
+    // Factory producing the algorithm given the number of generations.
+    std::function<algorithm(unsigned)> make;
+    // Whether the algorithm is multi-objective.
+    bool mo;
+};
+
+std::vector<algo_entry> algo_list()
+{
+    // NOTE: the stopping tolerances are set to zero whenever possible,
+    // so that the algorithms always run for the requested number of generations.
+    std::vector<algo_entry> retval = {
+        {"de", [](unsigned gen) { return algorithm{de{gen, 0.8, 0.9, 2u, 0., 0., 42u}}; }, false},
+        {"sade", [](unsigned gen) { return algorithm{sade{gen, 2u, 1u, 0., 0., false, 42u}}; }, false},
+        {"de1220",
+         [](unsigned gen) {
+             return algorithm{de1220{gen, de1220_statics<void>::allowed_variants, 1u, 0., 0., false, 42u}};
+         },
+         false},
+        {"pso", [](unsigned gen) { return algorithm{pso{gen, 0.7298, 2.05, 2.05, 0.5, 5u, 2u, 4u, false, 42u}}; },
+         false},
+        {"pso_gen",
+         [](unsigned gen) { return algorithm{pso_gen{gen, 0.7298, 2.05, 2.05, 0.5, 5u, 2u, 4u, false, 42u}}; }, false},
+#if defined(PAGMO_WITH_EIGEN3)
+        {"cmaes",
+         [](unsigned gen) { return algorithm{cmaes{gen, -1, -1, -1, -1, 0.5, 0., 0., false, true, 42u}}; }, false},
+        {"xnes", [](unsigned gen) { return algorithm{xnes{gen, -1, -1, -1, -1, 0., 0., false, true, 42u}}; },
+         false},
+#endif
+        {"sga",
+         [](unsigned gen) {
+             return algorithm{sga{gen, .9, 1., .02, 1., 2u, "exponential", "polynomial", "tournament", 42u}};
+         },
+         false},
+        {"gwo", [](unsigned gen) { return algorithm{gwo{gen, 42u}}; }, false},
+        {"bee_colony", [](unsigned gen) { return algorithm{bee_colony{gen, 20u, 42u}}; }, false},
+        {"gaco",
+         [](unsigned gen) {
+             return algorithm{gaco{gen, 63u, 1., 0., 0.01, 1u, 7u, 100000u, 100000u, 0., false, 42u}};
+         },
+         false},
+        // NOTE: ihs generates a single individual per generation, thus
+        // its generations are scaled by the population size (see below).
+        {"ihs", [](unsigned gen) { return algorithm{ihs{gen, 0.85, 0.35, 0.99, 1e-5, 1., 42u}}; }, false},
+        {"nsga2", [](unsigned gen) { return algorithm{nsga2{gen, 0.95, 10., 0.01, 50., 42u}}; }, true},
+        {"moead",
+         [](unsigned gen) {
+             return algorithm{moead{gen, "random", "tchebycheff", 20u, 1., 0.5, 20., 0.9, 2u, true, 42u}};
+         },
+         true},
+        {"nspso",
+         [](unsigned gen) {
+             return algorithm{nspso{gen, 0.6, 2., 2., 1., 0.5, 60u, "crowding distance", false, 42u}};
+         },
+         true},
+        {"maco",
+         [](unsigned gen) { return algorithm{maco{gen, 63u, 1., 1u, 7u, 100000u, 0., false, 42u}}; }, true}};
+
+    return retval;
+}
+
+struct udp_entry {
+    std::string name;
+    std::function<problem(unsigned)> make;
+    bool mo;
+};
+
+std::vector<udp_entry> udp_list()
+{
+    return {{"rastrigin", [](unsigned nx) { return problem{rastrigin{nx}}; }, false},
+            {"zdt1", [](unsigned nx) { return problem{zdt{1u, nx}}; }, true},
+            {"dtlz2", [](unsigned nx) { return problem{dtlz{2u, nx, 3u}}; }, true}};
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    suite s(parse_options(argc, argv));
+    const auto &opts = s.opts();
+
+    const std::vector<unsigned> nxs = opts.quick ? std::vector<unsigned>{10u} : std::vector<unsigned>{10u, 100u};
+    const std::vector<unsigned> pop_sizes
+        = opts.quick ? std::vector<unsigned>{64u} : std::vector<unsigned>{64u, 256u};
+    const unsigned gen = opts.quick ? 10u : 50u;
+
+    const auto algos = algo_list();
+    const auto udps = udp_list();
+
+    for (const auto &udp : udps) {
+        for (auto nx : nxs) {
+            const auto prob = udp.make(nx);
+            const auto t_eval = fitness_cost(opts, prob);
+
+            for (const auto &ae : algos) {
+                if (ae.mo != udp.mo || !s.enabled(ae.name)) {
+                    continue;
+                }
+
+                for (auto pop_size : pop_sizes) {
+                    const auto n_gen = ae.name == "ihs" ? gen * pop_size : gen;
+                    const auto algo = ae.make(n_gen);
+
+                    population pop;
+                    // The number of fitness evaluations of each repetition.
+                    std::vector<unsigned long long> rep_fevals;
+                    auto r = time_it(
+                        opts, ae.name, {{"udp", udp.name}, {"nx", to_str(nx)}, {"pop_size", to_str(pop_size)}},
+                        [&pop, &prob, pop_size]() { pop = population{prob, pop_size, 42u}; },
+                        [&pop, &algo, &rep_fevals]() {
+                            const auto fevals_start = pop.get_problem().get_fevals();
+                            auto algo_copy(algo);
+                            const auto new_pop = algo_copy.evolve(pop);
+                            rep_fevals.push_back(new_pop.get_problem().get_fevals() - fevals_start);
+                        },
+                        1u);
+
+                    // NOTE: the population and the algorithm are seeded in the same way in each
+                    // repetition, hence all the repetitions must perform the same number of
+                    // fitness evaluations, and the median time can be split using any of them.
+                    const auto fevals = rep_fevals.front();
+                    if (std::any_of(rep_fevals.begin(), rep_fevals.end(),
+                                    [fevals](unsigned long long n) { return n != fevals; })) {
+                        throw std::runtime_error("The number of fitness evaluations performed by the algorithm '"
+                                                 + ae.name + "' differs across repetitions");
+                    }
+
+                    const auto eval_time = static_cast<double>(fevals) * t_eval;
+                    const auto overhead = r.median - eval_time;
+                    r.metrics.emplace_back("gen", to_str(n_gen));
+                    r.metrics.emplace_back("fevals", to_str(fevals));
+                    r.metrics.emplace_back("eval_time_s", to_str(eval_time));
+                    r.metrics.emplace_back("overhead_s", to_str(overhead));
+                    r.metrics.emplace_back("overhead_per_gen_s", to_str(overhead / n_gen));
+                    r.metrics.emplace_back("overhead_per_feval_s",
+                                           to_str(fevals ? overhead / static_cast<double>(fevals) : 0.));
+                    r.metrics.emplace_back("peak_rss_kb", to_str(peak_rss_kb()));
+                    s.add(std::move(r));
+                }
+            }
+        }
+    }
+
+    s.finalise();
+}
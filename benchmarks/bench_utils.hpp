@@ -0,0 +1,239 @@
+#ifndef PAGMO_BENCHMARKS_BENCH_UTILS_HPP
+#define PAGMO_BENCHMARKS_BENCH_UTILS_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Small self-contained framework shared by the benchmark executables.
+// Each benchmark produces a list of records (one per point of a parameter
+// sweep), which can be printed as a human-readable table, as JSON or as CSV.
+namespace pagmo_bench
+{
+
+using clock_type = std::chrono::steady_clock;
+
+// A list of (key, value) pairs, used both for the parameters of a record
+// and for additional metrics.
+using kv_list = std::vector<std::pair<std::string, std::string>>;
+
+template <typename T>
+inline std::string to_str(const T &x)
+{
+    std::ostringstream oss;
+    oss << std::setprecision(10) << x;
+    return oss.str();
+}
+
+struct record {
+    std::string name;
+    kv_list params;
+    // Timing statistics, in seconds per repetition.
+    std::size_t reps = 0;
+    double min = 0, median = 0, mean = 0;
+    kv_list metrics;
+};
+
+// Command-line options common to all benchmarks.
+struct options {
+    // Output format: "table", "json" or "csv".
+    std::string format = "table";
+    // Output file (empty for stdout).
+    std::string output;
+    // Only run benchmarks whose name contains this string.
+    std::string filter;
+    // Reduced parameter sweeps.
+    bool quick = false;
+    // Minimum measurement time per record, in seconds.
+    double min_time = 0.2;
+};
+
+inline options parse_options(int argc, char **argv)
+{
+    options retval;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        auto next = [&]() -> std::string {
+            if (i + 1 >= argc) {
+                throw std::invalid_argument("Missing value for the command-line option '" + arg + "'");
+            }
+            return argv[++i];
+        };
+        if (arg == "--format") {
+            retval.format = next();
+            if (retval.format != "table" && retval.format != "json" && retval.format != "csv") {
+                throw std::invalid_argument("Invalid output format '" + retval.format
+                                            + "': the supported formats are 'table', 'json' and 'csv'");
+            }
+        } else if (arg == "--output") {
+            retval.output = next();
+        } else if (arg == "--filter") {
+            retval.filter = next();
+        } else if (arg == "--quick") {
+            retval.quick = true;
+        } else if (arg == "--min-time") {
+            retval.min_time = std::stod(next());
+        } else if (arg == "--help" || arg == "-h") {
+            std::cout << "Usage: " << argv[0]
+                      << " [--format table|json|csv] [--output FILE] [--filter SUBSTR] [--quick] [--min-time SECONDS]\n";
+            std::exit(0);
+        } else {
+            throw std::invalid_argument("Unknown command-line option '" + arg + "'");
+        }
+    }
+    return retval;
+}
+
+// Time repeated invocations of f. The setup function is called before
+// each repetition, and it is not included in the measurement. The repetitions
+// continue until min_time has elapsed (at least min_reps repetitions are run).
+template <typename Setup, typename F>
+inline record time_it(const options &opts, std::string name, kv_list params, Setup &&setup, F &&f,
+                      std::size_t min_reps = 3)
+{
+    std::vector<double> samples;
+    double total = 0;
+    while (samples.size() < min_reps || total < opts.min_time) {
+        setup();
+        const auto start = clock_type::now();
+        f();
+        const std::chrono::duration<double> elapsed = clock_type::now() - start;
+        samples.push_back(elapsed.count());
+        total += elapsed.count();
+    }
+
+    std::sort(samples.begin(), samples.end());
+
+    record r;
+    r.name = std::move(name);
+    r.params = std::move(params);
+    r.reps = samples.size();
+    r.min = samples.front();
+    r.median = samples[samples.size() / 2u];
+    r.mean = total / static_cast<double>(samples.size());
+
+    return r;
+}
+
+template <typename F>
+inline record time_it(const options &opts, std::string name, kv_list params, F &&f, std::size_t min_reps = 3)
+{
+    return time_it(
+        opts, std::move(name), std::move(params), []() {}, std::forward<F>(f), min_reps);
+}
+
+// Collection of records, with output facilities.
+class suite
+{
+public:
+    explicit suite(options opts) : m_opts(std::move(opts)) {}
+
+    const options &opts() const
+    {
+        return m_opts;
+    }
+    // Check if the benchmark with the given name should be run.
+    bool enabled(const std::string &name) const
+    {
+        return m_opts.filter.empty() || name.find(m_opts.filter) != std::string::npos;
+    }
+    void add(record r)
+    {
+        if (m_opts.format == "table") {
+            // In table mode, print the records as soon as they are available.
+            print_table_row(std::cout, r);
+        }
+        m_records.push_back(std::move(r));
+    }
+    // Write out the records in JSON or CSV format.
+    void finalise() const
+    {
+        if (m_opts.format == "table") {
+            return;
+        }
+        if (m_opts.output.empty()) {
+            write(std::cout);
+        } else {
+            std::ofstream ofs(m_opts.output);
+            if (!ofs) {
+                throw std::runtime_error("Unable to open the output file '" + m_opts.output + "'");
+            }
+            write(ofs);
+        }
+    }
+
+private:
+    static std::string json_escape(const std::string &s)
+    {
+        std::string retval;
+        for (auto c : s) {
+            if (c == '"' || c == '\\') {
+                retval += '\\';
+            }
+            retval += c;
+        }
+        return retval;
+    }
+    static std::string join(const kv_list &l)
+    {
+        std::string retval;
+        for (const auto &p : l) {
+            retval += (retval.empty() ? "" : ";") + p.first + "=" + p.second;
+        }
+        return retval;
+    }
+    static void print_table_row(std::ostream &os, const record &r)
+    {
+        os << std::left << std::setw(36) << r.name << std::setw(40) << join(r.params) << " median: " << std::setw(14)
+           << r.median << " min: " << std::setw(14) << r.min << " reps: " << r.reps;
+        if (!r.metrics.empty()) {
+            os << "  [" << join(r.metrics) << ']';
+        }
+        os << std::endl;
+    }
+    void write(std::ostream &os) const
+    {
+        os << std::setprecision(10);
+        if (m_opts.format == "json") {
+            os << "[\n";
+            for (decltype(m_records.size()) i = 0; i < m_records.size(); ++i) {
+                const auto &r = m_records[i];
+                os << "  {\"benchmark\": \"" << json_escape(r.name) << "\", \"params\": {";
+                for (decltype(r.params.size()) j = 0; j < r.params.size(); ++j) {
+                    os << (j ? ", " : "") << '"' << json_escape(r.params[j].first) << "\": \""
+                       << json_escape(r.params[j].second) << '"';
+                }
+                os << "}, \"reps\": " << r.reps << ", \"min_s\": " << r.min << ", \"median_s\": " << r.median
+                   << ", \"mean_s\": " << r.mean << ", \"metrics\": {";
+                for (decltype(r.metrics.size()) j = 0; j < r.metrics.size(); ++j) {
+                    os << (j ? ", " : "") << '"' << json_escape(r.metrics[j].first) << "\": " << r.metrics[j].second;
+                }
+                os << "}}" << (i + 1u == m_records.size() ? "" : ",") << '\n';
+            }
+            os << "]\n";
+        } else {
+            os << "benchmark,params,reps,min_s,median_s,mean_s,metrics\n";
+            for (const auto &r : m_records) {
+                os << r.name << ',' << join(r.params) << ',' << r.reps << ',' << r.min << ',' << r.median << ','
+                   << r.mean << ',' << join(r.metrics) << '\n';
+            }
+        }
+    }
+
+    options m_opts;
+    std::vector<record> m_records;
+};
+
+} // namespace pagmo_bench
+
+#endif
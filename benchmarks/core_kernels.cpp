@@ -0,0 +1,370 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <pagmo/algorithms/null_algorithm.hpp>
+#include <pagmo/archipelago.hpp>
+#include <pagmo/batch_evaluators/default_bfe.hpp>
+#include <pagmo/batch_evaluators/member_bfe.hpp>
+#include <pagmo/batch_evaluators/thread_bfe.hpp>
+#include <pagmo/bfe.hpp>
+#include <pagmo/config.hpp>
+#include <pagmo/island.hpp>
+#include <pagmo/population.hpp>
+#include <pagmo/problem.hpp>
+#include <pagmo/problems/rosenbrock.hpp>
+#include <pagmo/threading.hpp>
+#include <pagmo/topologies/fully_connected.hpp>
+#include <pagmo/topologies/ring.hpp>
+#include <pagmo/types.hpp>
+#include <pagmo/utils/hv_algos/hv_algorithm.hpp>
+#include <pagmo/utils/hv_algos/hv_bf_approx.hpp>
+#include <pagmo/utils/hv_algos/hv_bf_fpras.hpp>
+#include <pagmo/utils/hv_algos/hv_hv2d.hpp>
+#include <pagmo/utils/hv_algos/hv_hv3d.hpp>
+#include <pagmo/utils/hv_algos/hv_hvwfg.hpp>
+#include <pagmo/utils/hypervolume.hpp>
+#include <pagmo/utils/multi_objective.hpp>
+
+#if defined(PAGMO_WITH_FORK_ISLAND)
+#include <pagmo/islands/fork_island.hpp>
+#endif
+
+#include "bench_utils.hpp"
+
+using namespace pagmo;
+using namespace pagmo_bench;
+
+namespace
+{
+
+// A cheap UDP whose cost can be tuned via the number of
+// inner loops. It provides a batch fitness function, so that
+// member_bfe can be benchmarked as well.
+struct tunable_udp {
+    tunable_udp(vector_double::size_type dim = 10u, unsigned work = 1u) : m_dim(dim), m_work(work) {}
+    vector_double fitness(const vector_double &x) const
+    {
+        double retval = 0;
+        for (unsigned w = 0; w < m_work; ++w) {
+            for (auto v : x) {
+                retval += std::sin(v + static_cast<double>(w)) * v;
+            }
+        }
+        return {retval};
+    }
+    vector_double batch_fitness(const vector_double &dvs) const
+    {
+        vector_double retval(dvs.size() / m_dim);
+        for (decltype(retval.size()) i = 0; i < retval.size(); ++i) {
+            retval[i] = fitness(vector_double(dvs.data() + i * m_dim, dvs.data() + (i + 1u) * m_dim))[0];
+        }
+        return retval;
+    }
+    std::pair<vector_double, vector_double> get_bounds() const
+    {
+        return {vector_double(m_dim, -1.), vector_double(m_dim, 1.)};
+    }
+    thread_safety get_thread_safety() const
+    {
+        return thread_safety::constant;
+    }
+    vector_double::size_type m_dim;
+    unsigned m_work;
+};
+
+// Random fitness vectors, uniformly distributed in [0, 1]^d.
+std::vector<vector_double> random_points(std::size_t n, std::size_t d, std::mt19937 &eng)
+{
+    std::uniform_real_distribution<double> dist(0., 1.);
+    std::vector<vector_double> retval(n, vector_double(d));
+    for (auto &p : retval) {
+        for (auto &x : p) {
+            x = dist(eng);
+        }
+    }
+    return retval;
+}
+
+// Random mutually non-dominated points, lying on the positive
+// orthant of the unit sphere.
+std::vector<vector_double> random_front(std::size_t n, std::size_t d, std::mt19937 &eng)
+{
+    std::normal_distribution<double> dist;
+    std::vector<vector_double> retval(n, vector_double(d));
+    for (auto &p : retval) {
+        double norm = 0;
+        for (auto &x : p) {
+            x = std::abs(dist(eng)) + 1e-9;
+            norm += x * x;
+        }
+        for (auto &x : p) {
+            x /= std::sqrt(norm);
+        }
+    }
+    return retval;
+}
+
+void bench_mo_utils(suite &s)
+{
+    std::mt19937 eng(42u);
+    const std::vector<std::size_t> ns = s.opts().quick ? std::vector<std::size_t>{100u, 1000u}
+                                                       : std::vector<std::size_t>{100u, 1000u, 4000u};
+    const std::vector<std::size_t> ds = {2u, 3u, 5u};
+
+    for (auto d : ds) {
+        for (auto n : ns) {
+            const auto pts = random_points(n, d, eng);
+            const kv_list params = {{"n", to_str(n)}, {"d", to_str(d)}};
+
+            if (s.enabled("fast_non_dominated_sorting")) {
+                s.add(time_it(s.opts(), "fast_non_dominated_sorting", params,
+                              [&pts]() { (void)fast_non_dominated_sorting(pts); }));
+            }
+            if (s.enabled("crowding_distance")) {
+                // NOTE: crowding_distance() operates on a single front.
+                const auto front = random_front(n, d, eng);
+                s.add(time_it(s.opts(), "crowding_distance", params, [&front]() { (void)crowding_distance(front); }));
+            }
+            if (s.enabled("select_best_N_mo")) {
+                s.add(time_it(s.opts(), "select_best_N_mo", params,
+                              [&pts, n]() { (void)select_best_N_mo(pts, n / 2u); }));
+            }
+        }
+    }
+}
+
+void bench_hv(suite &s)
+{
+    std::mt19937 eng(42u);
+    const std::vector<std::size_t> ns = s.opts().quick ? std::vector<std::size_t>{10u, 100u}
+                                                       : std::vector<std::size_t>{10u, 100u, 1000u};
+
+    // The exact algorithms, with the dimensions they support.
+    struct exact_algo {
+        std::string name;
+        std::shared_ptr<hv_algorithm> algo;
+        std::vector<std::size_t> dims;
+    };
+    const std::vector<exact_algo> exact
+        = {{"hv2d", std::make_shared<hv2d>(), {2u}},
+           {"hv3d", std::make_shared<hv3d>(), {3u}},
+           {"hvwfg", std::make_shared<hvwfg>(), {2u, 3u, 4u, 5u}}};
+
+    for (const auto &ea : exact) {
+        const auto name = "hv_compute_" + ea.name;
+        if (!s.enabled(name)) {
+            continue;
+        }
+        for (auto d : ea.dims) {
+            for (auto n : ns) {
+                if (d >= 5u && n > 100u && ea.name == "hvwfg") {
+                    // Avoid excessively long runtimes.
+                    continue;
+                }
+                const hypervolume hv(random_front(n, d, eng), false);
+                const vector_double ref(d, 1.1);
+                s.add(time_it(s.opts(), name, {{"n", to_str(n)}, {"d", to_str(d)}},
+                              [&hv, &ref, &ea]() { (void)hv.compute(ref, *ea.algo); }));
+            }
+        }
+    }
+
+    // bf_fpras is a randomised approximation scheme for the total hypervolume.
+    if (s.enabled("hv_compute_bf_fpras")) {
+        bf_fpras algo(1e-1, 1e-1, 42u);
+        for (auto d : {2u, 3u, 4u, 5u}) {
+            for (auto n : ns) {
+                const hypervolume hv(random_front(n, d, eng), false);
+                const vector_double ref(d, 1.1);
+                s.add(time_it(s.opts(), "hv_compute_bf_fpras", {{"n", to_str(n)}, {"d", to_str(d)}},
+                              [&hv, &ref, &algo]() { (void)hv.compute(ref, algo); }));
+            }
+        }
+    }
+
+    // bf_approx supports only the computation of the least/greatest contributors.
+    if (s.enabled("hv_least_contributor_bf_approx")) {
+        bf_approx algo(false, 1u, 1e-1, 1e-1, 0.775, 0.2, 0.1, 0.25, 42u);
+        for (auto d : {3u, 4u}) {
+            for (auto n : ns) {
+                const hypervolume hv(random_front(n, d, eng), false);
+                const vector_double ref(d, 1.1);
+                s.add(time_it(s.opts(), "hv_least_contributor_bf_approx", {{"n", to_str(n)}, {"d", to_str(d)}},
+                              [&hv, &ref, &algo]() { (void)hv.least_contributor(ref, algo); }));
+            }
+        }
+    }
+}
+
+void bench_bfe(suite &s)
+{
+    std::mt19937 eng(42u);
+    const std::vector<std::size_t> ns = s.opts().quick ? std::vector<std::size_t>{100u, 1000u}
+                                                       : std::vector<std::size_t>{100u, 1000u, 10000u};
+    const std::vector<unsigned> works = {1u, 100u};
+    const auto dim = 10u;
+
+    for (auto work : works) {
+        const problem prob{tunable_udp{dim, work}};
+        for (auto n : ns) {
+            std::uniform_real_distribution<double> dist(-1., 1.);
+            vector_double dvs(n * dim);
+            for (auto &x : dvs) {
+                x = dist(eng);
+            }
+            const kv_list params = {{"n", to_str(n)}, {"work", to_str(work)}};
+
+            const std::vector<std::pair<std::string, bfe>> bfes
+                = {{"default_bfe", bfe{default_bfe{}}}, {"thread_bfe", bfe{thread_bfe{}}}, {"member_bfe", bfe{member_bfe{}}}};
+            for (const auto &p : bfes) {
+                const auto name = "bfe_" + p.first;
+                if (!s.enabled(name)) {
+                    continue;
+                }
+                auto r = time_it(s.opts(), name, params, [&p, &prob, &dvs]() { (void)p.second(prob, dvs); });
+                r.metrics.emplace_back("evals_per_s", to_str(static_cast<double>(n) / r.median));
+                s.add(std::move(r));
+            }
+        }
+    }
+}
+
+void bench_population(suite &s)
+{
+    std::mt19937 eng(42u);
+    const std::vector<std::size_t> ns = s.opts().quick ? std::vector<std::size_t>{1000u}
+                                                       : std::vector<std::size_t>{1000u, 10000u};
+    const std::vector<std::size_t> dims = {10u, 100u};
+
+    for (auto dim : dims) {
+        const problem prob{rosenbrock{dim}};
+        for (auto n : ns) {
+            const auto xs = random_points(n, dim, eng);
+            const std::vector<vector_double> fs(n, vector_double{1.});
+            const kv_list params = {{"n", to_str(n)}, {"nx", to_str(dim)}};
+
+            if (s.enabled("population_push_back_xf")) {
+                std::unique_ptr<population> pop;
+                auto r = time_it(
+                    s.opts(), "population_push_back_xf", params,
+                    [&pop, &prob]() { pop = std::make_unique<population>(prob); },
+                    [&pop, &xs, &fs, n]() {
+                        for (std::size_t i = 0; i < n; ++i) {
+                            pop->push_back(xs[i], fs[i]);
+                        }
+                    });
+                r.metrics.emplace_back("ops_per_s", to_str(static_cast<double>(n) / r.median));
+                s.add(std::move(r));
+            }
+            if (s.enabled("population_push_back_x")) {
+                // NOTE: this includes the fitness evaluation.
+                std::unique_ptr<population> pop;
+                auto r = time_it(
+                    s.opts(), "population_push_back_x", params,
+                    [&pop, &prob]() { pop = std::make_unique<population>(prob); },
+                    [&pop, &xs, n]() {
+                        for (std::size_t i = 0; i < n; ++i) {
+                            pop->push_back(xs[i]);
+                        }
+                    });
+                r.metrics.emplace_back("ops_per_s", to_str(static_cast<double>(n) / r.median));
+                s.add(std::move(r));
+            }
+            if (s.enabled("population_set_xf")) {
+                population pop{prob};
+                for (std::size_t i = 0; i < n; ++i) {
+                    pop.push_back(xs[i], fs[i]);
+                }
+                auto r = time_it(s.opts(), "population_set_xf", params, [&pop, &xs, &fs, n]() {
+                    for (std::size_t i = 0; i < n; ++i) {
+                        pop.set_xf(n - i - 1u, xs[i], fs[i]);
+                    }
+                });
+                r.metrics.emplace_back("ops_per_s", to_str(static_cast<double>(n) / r.median));
+                s.add(std::move(r));
+            }
+        }
+    }
+}
+
+void bench_migration(suite &s)
+{
+    if (!s.enabled("archipelago_migration")) {
+        return;
+    }
+
+    // NOTE: the null algorithm does not alter the population, so
+    // the runtime of archipelago::evolve() is dominated by
+    // the migration machinery.
+    const std::vector<unsigned> n_isls
+        = s.opts().quick ? std::vector<unsigned>{8u} : std::vector<unsigned>{8u, 32u, 128u};
+    const auto n_evolve = 20u;
+
+    for (auto n_isl : n_isls) {
+        for (auto fully : {false, true}) {
+            const kv_list params
+                = {{"islands", to_str(n_isl)}, {"topology", fully ? "fully_connected" : "ring"}, {"pop_size", "20"}};
+            std::unique_ptr<archipelago> archi;
+            auto r = time_it(
+                s.opts(), "archipelago_migration", params,
+                [&archi, n_isl, fully]() {
+                    archi = fully ? std::make_unique<archipelago>(fully_connected{}, n_isl, null_algorithm{},
+                                                                  rosenbrock{10u}, 20u, 42u)
+                                  : std::make_unique<archipelago>(ring{}, n_isl, null_algorithm{}, rosenbrock{10u},
+                                                                  20u, 42u);
+                },
+                [&archi, n_evolve]() {
+                    archi->evolve(n_evolve);
+                    archi->wait_check();
+                });
+            r.metrics.emplace_back("island_iterations_per_s", to_str(n_isl * n_evolve / r.median));
+            r.metrics.emplace_back("migrants_per_s", to_str(static_cast<double>(archi->get_migration_log().size())
+                                                            / r.median));
+            s.add(std::move(r));
+        }
+    }
+}
+
+void bench_fork_island(suite &s)
+{
+#if defined(PAGMO_WITH_FORK_ISLAND)
+    if (!s.enabled("fork_island_round_trip")) {
+        return;
+    }
+
+    const std::vector<unsigned> pop_sizes
+        = s.opts().quick ? std::vector<unsigned>{100u} : std::vector<unsigned>{100u, 1000u, 10000u};
+
+    for (auto pop_size : pop_sizes) {
+        island isl{fork_island{}, null_algorithm{}, population{rosenbrock{10u}, pop_size, 42u}};
+        s.add(time_it(s.opts(), "fork_island_round_trip", {{"pop_size", to_str(pop_size)}, {"nx", "10"}}, [&isl]() {
+            isl.evolve();
+            isl.wait_check();
+        }));
+    }
+#else
+    (void)s;
+#endif
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    suite s(parse_options(argc, argv));
+
+    bench_mo_utils(s);
+    bench_hv(s);
+    bench_bfe(s);
+    bench_population(s);
+    bench_migration(s);
+    bench_fork_island(s);
+
+    s.finalise();
+}
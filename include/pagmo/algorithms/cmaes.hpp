@@ -37,7 +37,10 @@ see https://www.gnu.org/licenses/. */
 #include <tuple>
 #include <vector>
 
+#include <boost/optional.hpp>
+
 #include <pagmo/algorithm.hpp>
+#include <pagmo/bfe.hpp>
 #include <pagmo/detail/eigen.hpp>
 #include <pagmo/detail/visibility.hpp>
 #include <pagmo/population.hpp>
@@ -53,6 +56,9 @@ namespace pagmo
  * optimization. The version implemented in PaGMO is the "classic" version described in the 2006 paper titled
  * "The CMA evolution strategy: a comparing review.".
  *
+ * The offspring of each generation are stored contiguously and, if a pagmo::bfe is set via
+ * cmaes::set_bfe(), they are evaluated with a single call to the batch fitness evaluator.
+ *
  * \verbatim embed:rst:leading-asterisk
  * .. warning::
  *
@@ -188,6 +194,9 @@ public:
         return m_gen;
     }
 
+    // Sets the bfe
+    void set_bfe(const bfe &b);
+
     /// Algorithm name
     /**
      * One of the optional methods of any user-defined algorithm (UDA).
@@ -247,6 +256,8 @@ private:
     mutable double sigma;
     mutable Eigen::VectorXd mean;
     mutable Eigen::VectorXd variation;
+    // NOTE: only the sizes of newpop are used, to detect a change in the problem
+    // dimension or in the population size.
     mutable std::vector<Eigen::VectorXd> newpop;
     mutable Eigen::MatrixXd B;
     mutable Eigen::MatrixXd D;
@@ -262,6 +273,7 @@ private:
     unsigned m_seed;
     unsigned m_verbosity;
     mutable log_type m_log;
+    boost::optional<bfe> m_bfe;
 };
 
 } // namespace pagmo
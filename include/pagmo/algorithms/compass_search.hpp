@@ -33,8 +33,11 @@ see https://www.gnu.org/licenses/. */
 #include <tuple>
 #include <vector>
 
+#include <boost/optional.hpp>
+
 #include <pagmo/algorithm.hpp>
 #include <pagmo/algorithms/not_population_based.hpp>
+#include <pagmo/bfe.hpp>
 #include <pagmo/detail/visibility.hpp>
 #include <pagmo/population.hpp>
 
@@ -82,6 +85,12 @@ namespace pagmo
  *    Compass search is a fully deterministic algorithms and will produce identical results if its evolve method is
  *    called from two identical populations.
  *
+ * .. note::
+ *
+ *    If a batch fitness evaluator is set via :cpp:func:`pagmo::compass_search::set_bfe()`, the :math:`2n` poll
+ *    points of each iteration are evaluated at once and the best of them is accepted if it improves the current
+ *    point. In this mode the number of fitness evaluations may exceed ``max_fevals`` by up to :math:`2n - 1`.
+ *
  * .. seealso::
  *
  *    Kolda, Lewis, Torczon: 'Optimization by Direct Search: New Perspectives on Some Classical and Modern Methods'
@@ -118,6 +127,9 @@ public:
     // Algorithm evolve method (juice implementation of the algorithm)
     population evolve(population) const;
 
+    // Sets the bfe
+    void set_bfe(const bfe &b);
+
     /// Sets the algorithm verbosity
     /**
      * Sets the verbosity level of the screen output and of the
@@ -234,6 +246,7 @@ private:
     double m_reduction_coeff;
     unsigned m_verbosity;
     mutable log_type m_log;
+    boost::optional<bfe> m_bfe;
     // Deleting the methods load save public in base as to avoid conflict with serialize
     template <typename Archive>
     void load(Archive &, unsigned) = delete;
@@ -33,7 +33,11 @@ see https://www.gnu.org/licenses/. */
 #include <tuple>
 #include <vector>
 
+#include <boost/optional.hpp>
+
 #include <pagmo/algorithm.hpp>
+#include <pagmo/async_evaluator.hpp>
+#include <pagmo/bfe.hpp>
 #include <pagmo/detail/visibility.hpp>
 #include <pagmo/population.hpp>
 #include <pagmo/rng.hpp>
@@ -55,6 +59,14 @@ namespace pagmo
  * The implementation provided for PaGMO is based on the code provided in the official
  * DE web site. pagmo::de is suitable for box-constrained single-objective continuous optimization.
  *
+ * If an asynchronous evaluation mode is selected via de::set_async(), a steady-state variant of the
+ * algorithm is run instead: each trial vector replaces its target as soon as its fitness becomes available,
+ * and new trial vectors are created from the updated population while other evaluations are still running.
+ * This keeps all the workers busy when the cost of the fitness evaluation is uneven.
+ * If a batch fitness evaluator is set via de::set_bfe(), the NP trial vectors of each generation are instead
+ * evaluated at once, and the selection is performed after the whole batch has been evaluated. Since the trial
+ * vectors of a generation are built from the previous generation only, the results are identical to the serial mode.
+ *
  * \verbatim embed:rst:leading-asterisk
  * .. note::
  *
@@ -160,6 +172,10 @@ public:
     {
         return m_gen;
     }
+    // Sets the bfe.
+    void set_bfe(const bfe &b);
+    // Sets the asynchronous evaluation mode.
+    void set_async(async_backend, unsigned = 0u);
     /// Algorithm name
     /**
      * One of the optional methods of any user-defined algorithm (UDA).
@@ -198,6 +214,9 @@ private:
     unsigned m_seed;
     unsigned m_verbosity;
     mutable log_type m_log;
+    boost::optional<async_backend> m_async;
+    unsigned m_async_n_workers;
+    boost::optional<bfe> m_bfe;
 };
 
 } // namespace pagmo
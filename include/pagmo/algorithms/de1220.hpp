@@ -33,7 +33,10 @@ see https://www.gnu.org/licenses/. */
 #include <tuple>
 #include <vector>
 
+#include <boost/optional.hpp>
+
 #include <pagmo/algorithm.hpp>
+#include <pagmo/bfe.hpp>
 #include <pagmo/detail/visibility.hpp>
 #include <pagmo/population.hpp>
 #include <pagmo/rng.hpp>
@@ -76,6 +79,10 @@ const std::vector<unsigned> de1220_statics<T>::allowed_variants = {2u, 3u, 7u, 1
  * where \f$\tau\f$ is set to be 0.1, \f$random\f$ selects a random mutation variant and \f$r_i\f$ is a random
  * uniformly distributed number in [0, 1]
  *
+ * If a batch fitness evaluator is set via de1220::set_bfe(), the trial vectors of each generation are evaluated
+ * at once, and the selection and the adaptation of F, CR and \f$V_i\f$ are performed after the whole batch has
+ * been evaluated.
+ *
  * \verbatim embed:rst:leading-asterisk
  * .. note::
  *
@@ -161,6 +168,9 @@ public:
     // Sets the seed
     void set_seed(unsigned);
 
+    // Sets the bfe
+    void set_bfe(const bfe &b);
+
     /// Gets the seed
     /**
      * @return the seed controlling the algorithm stochastic behaviour
@@ -270,6 +280,7 @@ private:
     unsigned m_seed;
     unsigned m_verbosity;
     mutable log_type m_log;
+    boost::optional<bfe> m_bfe;
 };
 
 } // namespace pagmo
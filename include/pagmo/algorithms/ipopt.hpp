@@ -83,6 +83,10 @@ PAGMO_DLL_PUBLIC unsigned ipopt_internal_test();
  * set_selection(population::size_type), set_replacement(const std::string &) and
  * set_replacement(population::size_type).
  *
+ * A multistart mode can be activated via set_n_starts(): ipopt::evolve() will then select several individuals
+ * and run an independent optimisation from each of them, writing the results back into the population via
+ * the replacement policy.
+ *
  * Configuring the optimsation run
  * -------------------------------
  *
@@ -241,6 +245,18 @@ public:
         return m_log;
     }
 
+    /// Get the number of starts.
+    /**
+     * @return the number of independent optimisations run by evolve() (see set_n_starts()).
+     */
+    unsigned get_n_starts() const
+    {
+        return m_n_starts;
+    }
+
+    // Set the number of starts.
+    void set_n_starts(unsigned);
+
     // Save to archive.
     template <typename Archive>
     void save(Archive &, unsigned) const;
@@ -314,6 +330,8 @@ private:
     // Verbosity/log.
     unsigned m_verbosity = 0;
     mutable log_type m_log;
+    // Number of starts.
+    unsigned m_n_starts = 1;
 };
 } // namespace pagmo
 
@@ -75,6 +75,9 @@ namespace pagmo
  *
  * pagmo::mbh is a user-defined algorithm (UDA) that can be used to construct pagmo::algorithm objects.
  *
+ * Several perturbation and evolution trials can be run in parallel at each step by calling mbh::set_n_trials():
+ * the best of the resulting populations is then compared against the current one.
+ *
  * See: https://arxiv.org/pdf/cond-mat/9803344.pdf for the paper introducing the basin hopping idea for a Lennard-Jones
  * cluster optimization.
  */
@@ -120,7 +123,8 @@ public:
      */
     template <typename T, ctor_enabler<T> = 0>
     explicit mbh(T &&a, unsigned stop, double perturb, unsigned seed = pagmo::random_device::next())
-        : m_algorithm(std::forward<T>(a)), m_stop(stop), m_perturb(1, perturb), m_e(seed), m_seed(seed), m_verbosity(0u)
+        : m_algorithm(std::forward<T>(a)), m_stop(stop), m_perturb(1, perturb), m_e(seed), m_seed(seed),
+          m_verbosity(0u), m_n_trials(1u)
     {
         scalar_ctor_impl(perturb);
     }
@@ -149,7 +153,8 @@ public:
      */
     template <typename T, ctor_enabler<T> = 0>
     explicit mbh(T &&a, unsigned stop, vector_double perturb, unsigned seed = pagmo::random_device::next())
-        : m_algorithm(std::forward<T>(a)), m_stop(stop), m_perturb(perturb), m_e(seed), m_seed(seed), m_verbosity(0u)
+        : m_algorithm(std::forward<T>(a)), m_stop(stop), m_perturb(perturb), m_e(seed), m_seed(seed),
+          m_verbosity(0u), m_n_trials(1u)
     {
         vector_ctor_impl(perturb);
     }
@@ -217,6 +222,16 @@ public:
     }
     // Set the perturbation vector.
     void set_perturb(const vector_double &);
+    /// Get the number of trials.
+    /**
+     * @return the number of perturbation and evolution trials run at each step.
+     */
+    unsigned get_n_trials() const
+    {
+        return m_n_trials;
+    }
+    // Set the number of trials.
+    void set_n_trials(unsigned);
     // Algorithm's thread safety level.
     thread_safety get_thread_safety() const;
     /// Getter for the inner algorithm.
@@ -289,6 +304,7 @@ private:
     unsigned m_seed;
     unsigned m_verbosity;
     mutable log_type m_log;
+    unsigned m_n_trials;
 };
 
 } // namespace pagmo
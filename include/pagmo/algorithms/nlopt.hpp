@@ -91,6 +91,11 @@ namespace pagmo
  * set_selection(population::size_type), set_replacement(const std::string &) and
  * set_replacement(population::size_type).
  *
+ * A multistart mode can be activated via set_n_starts(): nlopt::evolve() will then select several individuals
+ * and run an independent optimisation from each of them, concurrently if the problem's thread safety level
+ * allows it. Each optimised individual replaces, if better than its starting point, one of the individuals
+ * chosen by the replacement policy.
+ *
  * \verbatim embed:rst:leading-asterisk
  * .. warning::
  *
@@ -342,6 +347,18 @@ public:
         m_sc_maxtime = n;
     }
 
+    /// Get the number of starts.
+    /**
+     * @return the number of independent optimisations run by evolve() (see set_n_starts()).
+     */
+    unsigned get_n_starts() const
+    {
+        return m_n_starts;
+    }
+
+    // Set the number of starts.
+    void set_n_starts(unsigned);
+
     // Set the local optimizer.
     void set_local_optimizer(nlopt);
 
@@ -419,6 +436,8 @@ private:
     // Verbosity/log.
     unsigned m_verbosity = 0;
     mutable log_type m_log;
+    // Number of starts.
+    unsigned m_n_starts = 1;
     // Local/subsidiary optimizer.
     std::unique_ptr<nlopt> m_loc_opt;
 };
@@ -29,13 +29,16 @@ see https://www.gnu.org/licenses/. */
 #ifndef PAGMO_NOT_POPULATION_BASED_HPP
 #define PAGMO_NOT_POPULATION_BASED_HPP
 
+#include <functional>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <boost/any.hpp>
 
 #include <pagmo/detail/visibility.hpp>
 #include <pagmo/population.hpp>
+#include <pagmo/problem.hpp>
 #include <pagmo/rng.hpp>
 #include <pagmo/s11n.hpp>
 #include <pagmo/types.hpp>
@@ -49,8 +52,8 @@ namespace pagmo
  * that are not population based and establishes a common interface to a population
  *
  * Currently, this class implements policies for the selection and replacement of a single individual
- * in a population, which are meant to be used in the implementation of the <tt>evolve()</tt> method of the
- * user-defined algorithm (see, e.g., pagmo::nlopt::evolve()).
+ * (or of several individuals, for multistart optimisation) in a population, which are meant to be used in the
+ * implementation of the <tt>evolve()</tt> method of the user-defined algorithm (see, e.g., pagmo::nlopt::evolve()).
  */
 class PAGMO_DLL_PUBLIC not_population_based
 {
@@ -159,6 +162,13 @@ protected:
     std::pair<vector_double, vector_double> select_individual(const population &) const;
     // Replace individual.
     void replace_individual(population &, const vector_double &, const vector_double &) const;
+    // Select the indices of several individuals.
+    std::vector<population::size_type> select_indices(const population &, population::size_type) const;
+    // Select the indices of several individuals to be replaced.
+    std::vector<population::size_type> replace_indices(const population &, population::size_type) const;
+    // Run several independent optimisations, concurrently if possible.
+    void run_multistart(problem &, population::size_type,
+                        const std::function<void(problem &, population::size_type)> &) const;
 
 protected:
     /// Individual selection policy.
@@ -36,6 +36,7 @@ see https://www.gnu.org/licenses/. */
 #include <boost/optional.hpp>
 
 #include <pagmo/algorithm.hpp>
+#include <pagmo/async_evaluator.hpp>
 #include <pagmo/bfe.hpp>
 #include <pagmo/detail/visibility.hpp>
 #include <pagmo/population.hpp>
@@ -56,6 +57,10 @@ namespace pagmo
  * The version implemented in pagmo can be applied to box-bounded multiple-objective optimization. It also
  * deals with integer chromosomes treating the last \p int_dim entries in the decision vector as integers.
  *
+ * If an asynchronous evaluation mode is selected via nsga2::set_async(), a steady-state variant of the
+ * algorithm is run instead, in which each offspring competes for survival with the current population
+ * as soon as its fitness becomes available.
+ *
  * See:  Deb, K., Pratap, A., Agarwal, S., & Meyarivan, T. A. M. T. (2002). A fast and elitist multiobjective genetic
  * algorithm: NSGA-II. IEEE transactions on evolutionary computation, 6(2), 182-197.
  */
@@ -139,6 +144,8 @@ public:
 
     // Sets the bfe
     void set_bfe(const bfe &b);
+    // Sets the asynchronous evaluation mode
+    void set_async(async_backend, unsigned = 0u);
 
     /// Algorithm name
     /**
@@ -182,6 +189,8 @@ private:
     unsigned m_verbosity;
     mutable log_type m_log;
     boost::optional<bfe> m_bfe;
+    boost::optional<async_backend> m_async;
+    unsigned m_async_n_workers;
 };
 
 } // namespace pagmo
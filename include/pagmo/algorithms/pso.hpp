@@ -225,10 +225,10 @@ public:
     void serialize(Archive &, unsigned);
 
 private:
-    PAGMO_DLL_LOCAL vector_double
+    PAGMO_DLL_LOCAL population::size_type
     particle__get_best_neighbor(population::size_type pidx, std::vector<std::vector<vector_double::size_type>> &neighb,
-                                const std::vector<vector_double> &lbX, const std::vector<vector_double> &lbfit) const;
-    PAGMO_DLL_LOCAL void initialize_topology__gbest(const population &pop, vector_double &gbX, vector_double &gbfit,
+                                const vector_double &lbfit) const;
+    PAGMO_DLL_LOCAL void initialize_topology__gbest(const population &pop, vector_double &gbX, double &gbfit,
                                                     std::vector<std::vector<vector_double::size_type>> &neighb) const;
     PAGMO_DLL_LOCAL void initialize_topology__lbest(std::vector<std::vector<vector_double::size_type>> &neighb) const;
     PAGMO_DLL_LOCAL void initialize_topology__von(std::vector<std::vector<vector_double::size_type>> &neighb) const;
@@ -251,8 +251,8 @@ private:
     unsigned m_neighb_param;
     // memory
     bool m_memory;
-    // paricles' velocities
-    mutable std::vector<vector_double> m_V;
+    // paricles' velocities (row-major, one row per particle)
+    mutable vector_double m_V;
 
     mutable detail::random_engine_type m_e;
     unsigned m_seed;
@@ -36,6 +36,7 @@ see https://www.gnu.org/licenses/. */
 #include <boost/optional.hpp>
 
 #include <pagmo/algorithm.hpp>
+#include <pagmo/async_evaluator.hpp>
 #include <pagmo/bfe.hpp>
 #include <pagmo/detail/visibility.hpp>
 #include <pagmo/population.hpp>
@@ -49,6 +50,8 @@ namespace pagmo
  *
  * As opposed to the main PSO algorithm implemented in pagmo, this version of Particle Swarm Optimization is
  * generational. In other words, the velocity is first calculated for all particles, then the position is updated.
+ * Alternatively, an asynchronous mode can be selected via pso_gen::set_async(), in which each particle is moved
+ * again as soon as the fitness of its current position becomes available.
  *
  * \verbatim embed:rst:leading-asterisk
  * .. note::
@@ -155,6 +158,8 @@ public:
     }
     // Sets the bfe
     void set_bfe(const bfe &b);
+    // Sets the asynchronous evaluation mode
+    void set_async(async_backend, unsigned = 0u);
     // Sets the seed
     void set_seed(unsigned);
     /// Gets the seed
@@ -193,10 +198,10 @@ public:
     void serialize(Archive &, unsigned);
 
 private:
-    PAGMO_DLL_LOCAL vector_double
+    PAGMO_DLL_LOCAL population::size_type
     particle__get_best_neighbor(population::size_type pidx, std::vector<std::vector<vector_double::size_type>> &neighb,
-                                const std::vector<vector_double> &lbX, const std::vector<vector_double> &lbfit) const;
-    PAGMO_DLL_LOCAL void initialize_topology__gbest(const population &pop, vector_double &gbX, vector_double &gbfit,
+                                const vector_double &lbfit) const;
+    PAGMO_DLL_LOCAL void initialize_topology__gbest(const population &pop, vector_double &gbX, double &gbfit,
                                                     std::vector<std::vector<vector_double::size_type>> &neighb) const;
     PAGMO_DLL_LOCAL void initialize_topology__lbest(std::vector<std::vector<vector_double::size_type>> &neighb) const;
     PAGMO_DLL_LOCAL void initialize_topology__von(std::vector<std::vector<vector_double::size_type>> &neighb) const;
@@ -219,13 +224,15 @@ private:
     unsigned m_neighb_param;
     // memory
     bool m_memory;
-    // paricles' velocities
-    mutable std::vector<vector_double> m_V;
+    // paricles' velocities (row-major, one row per particle)
+    mutable vector_double m_V;
     mutable detail::random_engine_type m_e;
     unsigned m_seed;
     unsigned m_verbosity;
     mutable log_type m_log;
     boost::optional<bfe> m_bfe;
+    boost::optional<async_backend> m_async;
+    unsigned m_async_n_workers;
 };
 
 } // namespace pagmo
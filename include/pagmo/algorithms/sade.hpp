@@ -33,7 +33,10 @@ see https://www.gnu.org/licenses/. */
 #include <tuple>
 #include <vector>
 
+#include <boost/optional.hpp>
+
 #include <pagmo/algorithm.hpp>
+#include <pagmo/bfe.hpp>
 #include <pagmo/detail/visibility.hpp>
 #include <pagmo/population.hpp>
 #include <pagmo/rng.hpp>
@@ -58,6 +61,11 @@ namespace pagmo
  * operator to produce new
  * CR anf F parameters for each individual. We refer to this variant as to iDE.
  *
+ * If a batch fitness evaluator is set via sade::set_bfe(), the trial vectors of each generation are evaluated
+ * at once, and the selection and the adaptation of F and CR are performed after the whole batch has been evaluated.
+ * With jDE this gives the same results as the serial mode, while with iDE the parameters of a trial vector
+ * are computed only from the parameters of the previous generation.
+ *
  * \verbatim embed:rst:leading-asterisk
  * .. warning::
  *
@@ -143,6 +151,9 @@ public:
     // Sets the seed
     void set_seed(unsigned);
 
+    // Sets the bfe
+    void set_bfe(const bfe &b);
+
     /// Gets the seed
     /**
      * @return the seed controlling the algorithm stochastic behaviour
@@ -246,6 +257,7 @@ private:
     unsigned m_seed;
     unsigned m_verbosity;
     mutable log_type m_log;
+    boost::optional<bfe> m_bfe;
 };
 
 } // namespace pagmo
@@ -0,0 +1,255 @@
+/* Copyright 2017-2020 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#ifndef PAGMO_ALGORITHMS_SEP_CMAES_HPP
+#define PAGMO_ALGORITHMS_SEP_CMAES_HPP
+
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include <pagmo/algorithm.hpp>
+#include <pagmo/bfe.hpp>
+#include <pagmo/detail/visibility.hpp>
+#include <pagmo/population.hpp>
+#include <pagmo/rng.hpp>
+#include <pagmo/types.hpp>
+
+namespace pagmo
+{
+/// Separable Covariance Matrix Adaptation Evolutionary Strategy
+/**
+ * The separable CMA-ES (sep-CMA-ES) is a large-scale variant of pagmo::cmaes in which the covariance matrix
+ * of the search distribution is restricted to be diagonal. Memory and time requirements per generation are
+ * thus linear in the problem dimension (instead of, respectively, quadratic and cubic as in pagmo::cmaes),
+ * and no eigendecomposition is ever performed. This makes it possible to tackle problems with tens
+ * of thousands of continuous decision variables. On separable problems the learning rates of the covariance
+ * can be increased by a factor \f$(N+2)/3\f$ with respect to the full CMA-ES, which is what is done by default.
+ *
+ * The offspring of each generation are stored contiguously and, if a pagmo::bfe is set via
+ * sep_cmaes::set_bfe(), they are evaluated with a single call to the batch fitness evaluator.
+ *
+ * \verbatim embed:rst:leading-asterisk
+ * .. warning::
+ *
+ *    A moved-from pagmo::sep_cmaes is destructible and assignable. Any other operation will result
+ *    in undefined behaviour.
+ *
+ * .. note::
+ *
+ *    Since the covariance matrix is diagonal, sep-CMA-ES cannot learn correlations between the decision
+ *    variables. On non-separable problems of moderate dimension pagmo::cmaes should be preferred.
+ *
+ * .. seealso::
+ *
+ *    Ros, Raymond, and Nikolaus Hansen. "A simple modification in CMA-ES achieving linear time and space
+ *    complexity." International Conference on Parallel Problem Solving from Nature. Springer, 2008. 296-305.
+ * \endverbatim
+ */
+class PAGMO_DLL_PUBLIC sep_cmaes
+{
+public:
+    /// Single data line for the algorithm's log.
+    /**
+     * A log data line is a tuple consisting of:
+     * - the generation number,
+     * - the number of function evaluations
+     * - the best fitness vector so far,
+     * - the norm of the distance to the population mean of the mutant vectors,
+     * - the population flatness evaluated as the distance between the fitness of the best and of the worst individual,
+     * - the current step-size.
+     */
+    typedef std::tuple<unsigned, unsigned long long, double, double, double, double> log_line_type;
+
+    /// Log type.
+    /**
+     * The algorithm log is a collection of sep_cmaes::log_line_type data lines, stored in chronological order
+     * during the optimisation if the verbosity of the algorithm is set to a nonzero value
+     * (see sep_cmaes::set_verbosity()).
+     */
+    typedef std::vector<log_line_type> log_type;
+
+    /// Constructor.
+    /**
+     * Constructs sep_cmaes
+     *
+     * @param gen number of generations.
+     * @param cc backward time horizon for the evolution path (by default is automatically assigned)
+     * @param cs makes partly up for the small variance loss in case the indicator is zero (by default is
+     automatically assigned)
+     * @param c1  learning rate for the rank-one update of the covariance matrix (by default is automatically
+     assigned)
+     * @param cmu learning rate for the rank-\f$\mu\f$  update of the covariance matrix (by default is automatically
+     assigned)
+     * @param sigma0 initial step-size
+     * @param ftol stopping criteria on the x tolerance (default is 1e-6)
+     * @param xtol stopping criteria on the f tolerance (default is 1e-6)
+     * @param memory when true the adapted parameters are not reset between successive calls to the evolve method
+     * @param force_bounds when true the box bounds are enforced. The fitness will never be called outside the bounds
+     but the covariance matrix adaptation  mechanism will worsen
+     * @param seed seed used by the internal random number generator (default is random)
+     * @throws std::invalid_argument if cc, cs, c1 and cmu are not in [0, 1]
+     */
+    sep_cmaes(unsigned gen = 1, double cc = -1, double cs = -1, double c1 = -1, double cmu = -1, double sigma0 = 0.5,
+              double ftol = 1e-6, double xtol = 1e-6, bool memory = false, bool force_bounds = false,
+              unsigned seed = pagmo::random_device::next());
+
+    // Algorithm evolve method
+    population evolve(population) const;
+
+    // Sets the seed
+    void set_seed(unsigned);
+
+    /// Gets the seed
+    /**
+     * @return the seed controlling the algorithm stochastic behaviour
+     */
+    unsigned get_seed() const
+    {
+        return m_seed;
+    }
+
+    /// Sets the algorithm verbosity
+    /**
+     * Sets the verbosity level of the screen output and of the
+     * log returned by get_log(). \p level can be:
+     * - 0: no verbosity
+     * - >0: will print and log one line each \p level generations.
+     *
+     * Example (verbosity 20):
+     * @code{.unparsed}
+     * Gen:      Fevals:          Best:            dx:            df:         sigma:
+     * 1              0        81217.7        15.8954    2.46478e+06            0.5
+     * 21           400        1802.23        2.16367        12017.7       0.125676
+     * 41           800        123.083       0.466814        126.832      0.0592545
+     * 61          1200        87.2282        0.26315        22.6205      0.0347729
+     * 81          1600        53.9088       0.239776        52.2846      0.0715292
+     * 101         2000        11.7617      0.0976718        10.9023      0.0788081
+     * @endcode
+     * Gen, is the generation number, Fevals the number of function evaluation used, Best is the best fitness
+     * function currently in the population, dx is the norm of the distance to the population mean of
+     * the mutant vectors, df is the population flatness evaluated as the distance between the fitness
+     * of the best and of the worst individual and sigma is the current step-size
+     *
+     * @param level verbosity level
+     */
+    void set_verbosity(unsigned level)
+    {
+        m_verbosity = level;
+    }
+
+    /// Gets the verbosity level
+    /**
+     * @return the verbosity level
+     */
+    unsigned get_verbosity() const
+    {
+        return m_verbosity;
+    }
+
+    /// Gets the generations
+    /**
+     * @return the number of generations to evolve for
+     */
+    unsigned get_gen() const
+    {
+        return m_gen;
+    }
+
+    // Sets the bfe
+    void set_bfe(const bfe &b);
+
+    /// Algorithm name
+    /**
+     * One of the optional methods of any user-defined algorithm (UDA).
+     *
+     * @return a string containing the algorithm name
+     */
+    std::string get_name() const
+    {
+        return "sep-CMA-ES: Separable Covariance Matrix Adaptation Evolutionary Strategy";
+    }
+
+    // Extra info
+    std::string get_extra_info() const;
+
+    /// Get log
+    /**
+     * A log containing relevant quantities monitoring the last call to evolve. Each element of the returned
+     * <tt>std::vector</tt> is a sep_cmaes::log_line_type containing: Gen, Fevals, Best, dx, df, sigma
+     * as described in sep_cmaes::set_verbosity
+     * @return an <tt>std::vector</tt> of sep_cmaes::log_line_type containing the logged values Gen, Fevals, Best, dx,
+     * df, sigma
+     */
+    const log_type &get_log() const
+    {
+        return m_log;
+    }
+
+    // Object serialization
+    template <typename Archive>
+    void serialize(Archive &, unsigned);
+
+private:
+    // Data members
+    unsigned m_gen;
+    double m_cc;
+    double m_cs;
+    double m_c1;
+    double m_cmu;
+    double m_sigma0;
+    double m_ftol;
+    double m_xtol;
+    bool m_memory;
+    bool m_force_bounds;
+
+    // "Memory" data members (these are adapted during each evolve call and may be remembered if m_memory is true)
+    mutable double sigma;
+    mutable vector_double mean;
+    // The diagonal of the covariance matrix and its square root.
+    mutable vector_double C;
+    mutable vector_double D;
+    mutable vector_double pc;
+    mutable vector_double ps;
+    mutable population::size_type counteval;
+
+    // "Common" data members
+    mutable detail::random_engine_type m_e;
+    unsigned m_seed;
+    unsigned m_verbosity;
+    mutable log_type m_log;
+    boost::optional<bfe> m_bfe;
+};
+
+} // namespace pagmo
+
+PAGMO_S11N_ALGORITHM_EXPORT_KEY(pagmo::sep_cmaes)
+
+#endif
@@ -37,7 +37,10 @@ see https://www.gnu.org/licenses/. */
 #include <tuple>
 #include <vector>
 
+#include <boost/optional.hpp>
+
 #include <pagmo/algorithm.hpp>
+#include <pagmo/bfe.hpp>
 #include <pagmo/detail/eigen.hpp>
 #include <pagmo/detail/visibility.hpp>
 #include <pagmo/population.hpp>
@@ -198,6 +201,9 @@ public:
         return m_gen;
     }
 
+    // Sets the bfe
+    void set_bfe(const bfe &b);
+
     /// Algorithm name
     /**
      * One of the optional methods of any user-defined algorithm (UDA).
@@ -262,6 +268,7 @@ private:
     unsigned m_seed;
     unsigned m_verbosity;
     mutable log_type m_log;
+    boost::optional<bfe> m_bfe;
 };
 
 } // namespace pagmo
@@ -51,6 +51,7 @@ see https://www.gnu.org/licenses/. */
 #include <pagmo/island.hpp>
 #include <pagmo/problem.hpp>
 #include <pagmo/r_policy.hpp>
+#include <pagmo/rng.hpp>
 #include <pagmo/s11n.hpp>
 #include <pagmo/s_policy.hpp>
 #include <pagmo/topology.hpp>
@@ -297,7 +298,8 @@ private:
                           int> = 0>
     void n_ctor(size_type n, const Algo &a, const Prob &p, S1 size, S2 seed)
     {
-        std::mt19937 eng(static_cast<std::mt19937::result_type>(static_cast<unsigned>(seed)));
+        detail::random_engine_type eng(
+            static_cast<detail::random_engine_type::result_type>(static_cast<unsigned>(seed)));
         std::uniform_int_distribution<unsigned> udist;
         for (size_type i = 0; i < n; ++i) {
             push_back(a, p, boost::numeric_cast<population::size_type>(size), udist(eng));
@@ -313,7 +315,8 @@ private:
                     int> = 0>
     void n_ctor(size_type n, const Algo &a, const Prob &p, S1 size, const RPol &r_pol, const SPol &s_pol, S2 seed)
     {
-        std::mt19937 eng(static_cast<std::mt19937::result_type>(static_cast<unsigned>(seed)));
+        detail::random_engine_type eng(
+            static_cast<detail::random_engine_type::result_type>(static_cast<unsigned>(seed)));
         std::uniform_int_distribution<unsigned> udist;
         for (size_type i = 0; i < n; ++i) {
             push_back(a, p, boost::numeric_cast<population::size_type>(size), r_pol, s_pol, udist(eng));
@@ -332,7 +335,8 @@ private:
                     int> = 0>
     void n_ctor(size_type n, const Algo &a, const Prob &p, const Bfe &b, S1 size, S2 seed)
     {
-        std::mt19937 eng(static_cast<std::mt19937::result_type>(static_cast<unsigned>(seed)));
+        detail::random_engine_type eng(
+            static_cast<detail::random_engine_type::result_type>(static_cast<unsigned>(seed)));
         std::uniform_int_distribution<unsigned> udist;
         for (size_type i = 0; i < n; ++i) {
             push_back(a, p, b, boost::numeric_cast<population::size_type>(size), udist(eng));
@@ -349,7 +353,8 @@ private:
     void n_ctor(size_type n, const Algo &a, const Prob &p, const Bfe &b, S1 size, const RPol &r_pol, const SPol &s_pol,
                 S2 seed)
     {
-        std::mt19937 eng(static_cast<std::mt19937::result_type>(static_cast<unsigned>(seed)));
+        detail::random_engine_type eng(
+            static_cast<detail::random_engine_type::result_type>(static_cast<unsigned>(seed)));
         std::uniform_int_distribution<unsigned> udist;
         for (size_type i = 0; i < n; ++i) {
             push_back(a, p, b, boost::numeric_cast<population::size_type>(size), r_pol, s_pol, udist(eng));
@@ -363,7 +368,8 @@ private:
                           int> = 0>
     void n_ctor(size_type n, const Isl &isl, const Algo &a, const Prob &p, S1 size, S2 seed)
     {
-        std::mt19937 eng(static_cast<std::mt19937::result_type>(static_cast<unsigned>(seed)));
+        detail::random_engine_type eng(
+            static_cast<detail::random_engine_type::result_type>(static_cast<unsigned>(seed)));
         std::uniform_int_distribution<unsigned> udist;
         for (size_type i = 0; i < n; ++i) {
             push_back(isl, a, p, boost::numeric_cast<population::size_type>(size), udist(eng));
@@ -380,7 +386,8 @@ private:
     void n_ctor(size_type n, const Isl &isl, const Algo &a, const Prob &p, S1 size, const RPol &r_pol,
                 const SPol &s_pol, S2 seed)
     {
-        std::mt19937 eng(static_cast<std::mt19937::result_type>(static_cast<unsigned>(seed)));
+        detail::random_engine_type eng(
+            static_cast<detail::random_engine_type::result_type>(static_cast<unsigned>(seed)));
         std::uniform_int_distribution<unsigned> udist;
         for (size_type i = 0; i < n; ++i) {
             push_back(isl, a, p, boost::numeric_cast<population::size_type>(size), r_pol, s_pol, udist(eng));
@@ -395,7 +402,8 @@ private:
                           int> = 0>
     void n_ctor(size_type n, const Isl &isl, const Algo &a, const Prob &p, const Bfe &b, S1 size, S2 seed)
     {
-        std::mt19937 eng(static_cast<std::mt19937::result_type>(static_cast<unsigned>(seed)));
+        detail::random_engine_type eng(
+            static_cast<detail::random_engine_type::result_type>(static_cast<unsigned>(seed)));
         std::uniform_int_distribution<unsigned> udist;
         for (size_type i = 0; i < n; ++i) {
             push_back(isl, a, p, b, boost::numeric_cast<population::size_type>(size), udist(eng));
@@ -414,7 +422,8 @@ private:
     void n_ctor(size_type n, const Isl &isl, const Algo &a, const Prob &p, const Bfe &b, S1 size, const RPol &r_pol,
                 const SPol &s_pol, S2 seed)
     {
-        std::mt19937 eng(static_cast<std::mt19937::result_type>(static_cast<unsigned>(seed)));
+        detail::random_engine_type eng(
+            static_cast<detail::random_engine_type::result_type>(static_cast<unsigned>(seed)));
         std::uniform_int_distribution<unsigned> udist;
         for (size_type i = 0; i < n; ++i) {
             push_back(isl, a, p, b, boost::numeric_cast<population::size_type>(size), r_pol, s_pol, udist(eng));
@@ -0,0 +1,127 @@
+/* Copyright 2017-2020 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#ifndef PAGMO_ASYNC_EVALUATOR_HPP
+#define PAGMO_ASYNC_EVALUATOR_HPP
+
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <tuple>
+
+#include <boost/optional.hpp>
+
+#include <pagmo/config.hpp>
+#include <pagmo/detail/visibility.hpp>
+#include <pagmo/problem.hpp>
+#include <pagmo/types.hpp>
+
+namespace pagmo
+{
+
+/// Execution backends for the asynchronous evaluator.
+/**
+ * - async_backend::thread: the fitness evaluations are run in a pool of threads. The problem
+ *   must provide at least the pagmo::thread_safety::basic guarantee.
+ * - async_backend::fork: each fitness evaluation is run in a separate process created via the
+ *   POSIX <tt>fork()</tt> primitive (available only if pagmo was built with support for pagmo::fork_island).
+ *   Any problem can be used with this backend.
+ */
+enum class async_backend { thread, fork };
+
+#if !defined(PAGMO_DOXYGEN_INVOKED)
+
+// Stream operator for the async_backend enum.
+PAGMO_DLL_PUBLIC std::ostream &operator<<(std::ostream &, async_backend);
+
+#endif
+
+namespace detail
+{
+
+struct async_evaluator_impl;
+
+} // namespace detail
+
+/// Asynchronous fitness evaluator
+/**
+ * This class allows to evaluate decision vectors asynchronously. Decision vectors are submitted
+ * one at a time via async_evaluator::submit(), which returns immediately, and the results are
+ * retrieved in order of completion (rather than in order of submission) via
+ * async_evaluator::poll() or async_evaluator::wait(). This makes it possible to implement
+ * steady-state evolutionary schemes that keep all the workers busy even when the cost of the
+ * fitness function varies wildly from one decision vector to the other, as opposed to
+ * the batch-synchronous scheme implemented by pagmo::bfe, in which each batch of evaluations
+ * is as slow as its slowest member.
+ *
+ * The fitness evaluations are performed on private copies of the problem passed upon construction.
+ * The fitness evaluation counter of that problem is however increased by one each time a result
+ * is retrieved, so that, from the point of view of the user, the number of fitness evaluations
+ * is accounted for exactly as if the evaluations had been performed with problem::fitness().
+ * For this reason, the problem passed upon construction must outlive the evaluator.
+ *
+ * The destructor of an async_evaluator blocks until the evaluations in progress have completed
+ * (the results of which are then discarded). The submitted evaluations which have not been started
+ * yet are cancelled.
+ */
+class PAGMO_DLL_PUBLIC async_evaluator
+{
+public:
+    /// Result of an evaluation: (id, decision vector, fitness vector).
+    using result_type = std::tuple<unsigned long long, vector_double, vector_double>;
+
+    // Constructor.
+    explicit async_evaluator(const problem &, async_backend = async_backend::thread, unsigned = 0u);
+    async_evaluator(const async_evaluator &) = delete;
+    async_evaluator(async_evaluator &&) = delete;
+    async_evaluator &operator=(const async_evaluator &) = delete;
+    async_evaluator &operator=(async_evaluator &&) = delete;
+    ~async_evaluator();
+
+    // Submit a decision vector for evaluation.
+    unsigned long long submit(const vector_double &);
+    // Fetch a completed evaluation, if available.
+    boost::optional<result_type> poll();
+    // Wait for the next completed evaluation.
+    result_type wait();
+
+    // Number of submitted evaluations whose result
+    // has not been retrieved yet.
+    std::size_t get_n_pending() const;
+    // Number of concurrent evaluations.
+    unsigned get_n_workers() const;
+    // The backend.
+    async_backend get_backend() const;
+
+private:
+    std::unique_ptr<detail::async_evaluator_impl> m_impl;
+};
+
+} // namespace pagmo
+
+#endif
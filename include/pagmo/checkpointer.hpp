@@ -0,0 +1,95 @@
+/* Copyright 2017-2020 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#ifndef PAGMO_CHECKPOINTER_HPP
+#define PAGMO_CHECKPOINTER_HPP
+
+#include <memory>
+#include <string>
+
+#include <pagmo/archipelago.hpp>
+#include <pagmo/detail/visibility.hpp>
+
+namespace pagmo
+{
+
+namespace detail
+{
+
+struct checkpointer_impl;
+
+} // namespace detail
+
+/// Incremental archipelago checkpointer.
+/**
+ * This class writes checkpoints of a pagmo::archipelago into a directory without stopping the
+ * evolution of the islands. checkpointer::save() takes a snapshot of the islands via the copy constructor
+ * of pagmo::island (which is safe to use while an island is evolving) and returns immediately: the snapshots
+ * are serialised and written to disk by a separate thread of execution.
+ *
+ * A checkpoint consists of one file per island (named ``island_<idx>.ckpt``), containing the island's UDI, algorithm,
+ * population and replacement/selection policies, and of a file named ``archipelago.ckpt``, containing the number of
+ * islands, the topology, the database of migrants, the migration type and the migrant handling policy. The
+ * migration log is not part of the checkpoint. Only the islands whose algorithm or population have changed since
+ * the previous checkpoint are written to disk. Each file is first written to a temporary file which then replaces the
+ * old file, so that an interrupted write never corrupts the previous checkpoint.
+ *
+ * Because the islands are not stopped, the snapshots of different islands may refer to slightly different
+ * points in time. A checkpoint can be turned back into an archipelago via checkpointer::load().
+ *
+ * The destructor of a checkpointer blocks until all the pending writes have been completed.
+ */
+class PAGMO_DLL_PUBLIC checkpointer
+{
+public:
+    // Constructor.
+    explicit checkpointer(std::string);
+    checkpointer(const checkpointer &) = delete;
+    checkpointer(checkpointer &&) = delete;
+    checkpointer &operator=(const checkpointer &) = delete;
+    checkpointer &operator=(checkpointer &&) = delete;
+    ~checkpointer();
+
+    // Get the checkpoint directory.
+    const std::string &get_directory() const;
+
+    // Checkpoint an archipelago.
+    archipelago::size_type save(const archipelago &);
+    // Block until all the pending writes have been completed
+    // and raise the first exception that was encountered.
+    void wait_check();
+    // Restore an archipelago from the checkpoint.
+    archipelago load();
+
+private:
+    std::unique_ptr<detail::checkpointer_impl> m_impl;
+};
+
+} // namespace pagmo
+
+#endif
@@ -0,0 +1,230 @@
+/* Copyright 2017-2020 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#ifndef PAGMO_COLUMNAR_STORE_HPP
+#define PAGMO_COLUMNAR_STORE_HPP
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include <pagmo/archipelago.hpp>
+#include <pagmo/detail/visibility.hpp>
+#include <pagmo/population.hpp>
+#include <pagmo/types.hpp>
+
+namespace pagmo
+{
+
+namespace detail
+{
+
+struct columnar_reader_impl;
+
+} // namespace detail
+
+/// Writer for columnar population stores.
+/**
+ * A columnar store is a binary file containing a sequence of snapshots of populations. Each snapshot
+ * is appended at the end of the file via columnar_writer::append(), and it consists of a fixed-size header
+ * (containing a user-defined tag, e.g., the generation number, the index of the island the population belongs to,
+ * the number of individuals and the dimensions of the decision and fitness vectors) followed by
+ * the columns of the population: the IDs, the decision vectors, the fitness vectors and, if available, the
+ * champion's decision and fitness vectors. The decision and fitness vectors are stored as row-major matrices
+ * (that is, the decision vectors of the individuals are stored contiguously one after the other).
+ *
+ * The data is stored in the native binary format of the machine (a tag in the file header allows to detect
+ * files produced on machines with a different byte order), so that columnar stores can be memory-mapped and
+ * inspected without copies via pagmo::columnar_reader.
+ */
+class PAGMO_DLL_PUBLIC columnar_writer
+{
+public:
+    // Constructor.
+    explicit columnar_writer(std::string);
+
+    // Get the path of the store.
+    const std::string &get_path() const;
+
+    // Append a population.
+    void append(const population &, unsigned long long = 0);
+    // Append the populations of an archipelago.
+    void append(const archipelago &, unsigned long long = 0);
+
+private:
+    std::string m_path;
+};
+
+/// Snapshot of a population in a columnar store.
+/**
+ * This class provides read-only views on the columns of a population snapshot stored in a memory-mapped
+ * columnar store. The pointers returned by the getters refer to the memory-mapped file: they are valid as long as
+ * the pagmo::columnar_reader which produced the snapshot is alive.
+ */
+class PAGMO_DLL_PUBLIC columnar_snapshot
+{
+    friend class columnar_reader;
+
+public:
+    /// Tag of the snapshot.
+    /**
+     * @return the tag that was passed to columnar_writer::append().
+     */
+    unsigned long long get_tag() const
+    {
+        return m_tag;
+    }
+    /// Island index.
+    /**
+     * @return the index of the island in the archipelago, or zero if the
+     * snapshot was produced from a standalone population.
+     */
+    unsigned long long get_island() const
+    {
+        return m_island;
+    }
+    /// Number of individuals.
+    /**
+     * @return the number of individuals in the snapshot.
+     */
+    pop_size_t size() const
+    {
+        return m_size;
+    }
+    /// Dimension of the decision vectors.
+    /**
+     * @return the dimension of the decision vectors.
+     */
+    vector_double::size_type get_nx() const
+    {
+        return m_nx;
+    }
+    /// Dimension of the fitness vectors.
+    /**
+     * @return the dimension of the fitness vectors.
+     */
+    vector_double::size_type get_nf() const
+    {
+        return m_nf;
+    }
+    /// IDs.
+    /**
+     * @return a pointer to the array of the IDs of the individuals, of size columnar_snapshot::size().
+     */
+    const unsigned long long *get_ID() const
+    {
+        return m_ID;
+    }
+    /// Decision vectors.
+    /**
+     * @return a pointer to the row-major matrix of the decision vectors, of size
+     * <tt>size() * get_nx()</tt>.
+     */
+    const double *get_x() const
+    {
+        return m_x;
+    }
+    /// Fitness vectors.
+    /**
+     * @return a pointer to the row-major matrix of the fitness vectors, of size
+     * <tt>size() * get_nf()</tt>.
+     */
+    const double *get_f() const
+    {
+        return m_f;
+    }
+    /// Champion's decision vector.
+    /**
+     * @return a pointer to the decision vector of the champion, of size get_nx(), or \p nullptr
+     * if the snapshot does not contain a champion (e.g., because the problem is multi-objective).
+     */
+    const double *get_champion_x() const
+    {
+        return m_champion_x;
+    }
+    /// Champion's fitness vector.
+    /**
+     * @return a pointer to the fitness vector of the champion, of size get_nf(), or \p nullptr
+     * if the snapshot does not contain a champion.
+     */
+    const double *get_champion_f() const
+    {
+        return m_champion_f;
+    }
+
+private:
+    columnar_snapshot() = default;
+
+    unsigned long long m_tag = 0;
+    unsigned long long m_island = 0;
+    pop_size_t m_size = 0;
+    vector_double::size_type m_nx = 0;
+    vector_double::size_type m_nf = 0;
+    const unsigned long long *m_ID = nullptr;
+    const double *m_x = nullptr;
+    const double *m_f = nullptr;
+    const double *m_champion_x = nullptr;
+    const double *m_champion_f = nullptr;
+};
+
+/// Reader for columnar population stores.
+/**
+ * This class memory-maps a columnar store written by pagmo::columnar_writer and gives access
+ * to its snapshots without loading them into memory. The data of the snapshots is paged in
+ * by the operating system only when it is accessed.
+ *
+ * The snapshots are indexed upon construction. A snapshot which was not completely written
+ * to disk at the time of construction (e.g., because a pagmo::columnar_writer is still appending
+ * to the store) is ignored.
+ */
+class PAGMO_DLL_PUBLIC columnar_reader
+{
+public:
+    // Constructor.
+    explicit columnar_reader(const std::string &);
+    columnar_reader(const columnar_reader &) = delete;
+    columnar_reader(columnar_reader &&) noexcept;
+    columnar_reader &operator=(const columnar_reader &) = delete;
+    columnar_reader &operator=(columnar_reader &&) noexcept;
+    ~columnar_reader();
+
+    // Get the path of the store.
+    const std::string &get_path() const;
+
+    // Number of snapshots.
+    std::size_t size() const;
+    // Access a snapshot.
+    columnar_snapshot operator[](std::size_t) const;
+
+private:
+    std::unique_ptr<detail::columnar_reader_impl> m_impl;
+};
+
+} // namespace pagmo
+
+#endif
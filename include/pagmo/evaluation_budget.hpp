@@ -0,0 +1,127 @@
+/* Copyright 2017-2020 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#ifndef PAGMO_EVALUATION_BUDGET_HPP
+#define PAGMO_EVALUATION_BUDGET_HPP
+
+#include <atomic>
+#include <limits>
+
+#include <pagmo/detail/visibility.hpp>
+
+namespace pagmo
+{
+
+/// Fitness evaluation budget.
+/**
+ * An evaluation budget is a thread-safe object which counts the fitness evaluations performed
+ * on one or more problems, and which raises a stop flag as soon as either
+ * - the total number of fitness evaluations reaches a maximum value, or
+ * - a fitness lower than a target value is computed on a single-component fitness
+ *   (i.e., unconstrained single-objective) problem.
+ *
+ * A budget is attached to a pagmo::problem via problem::set_budget(). Since copies of a problem
+ * share its budget, attaching a budget to a problem before constructing an island or an archipelago
+ * from it makes the budget global to all the islands: every fitness evaluation performed by any island
+ * is charged to the same counter, and island::evolve() checks the stop flag between iterations,
+ * so that all the islands stop promptly once the budget is exhausted or the target has been reached.
+ *
+ * The stop flag can also be raised manually via request_stop().
+ */
+class PAGMO_DLL_PUBLIC evaluation_budget
+{
+public:
+    // Constructor.
+    explicit evaluation_budget(unsigned long long = std::numeric_limits<unsigned long long>::max(),
+                               double = -std::numeric_limits<double>::infinity());
+
+    // An evaluation budget is shared via pointers, it cannot be copied or moved.
+    evaluation_budget(const evaluation_budget &) = delete;
+    evaluation_budget(evaluation_budget &&) = delete;
+    evaluation_budget &operator=(const evaluation_budget &) = delete;
+    evaluation_budget &operator=(evaluation_budget &&) = delete;
+
+    /// Consume fitness evaluations.
+    /**
+     * This method will add \p n to the counter of fitness evaluations, and it will raise the stop flag
+     * if the counter reaches the maximum number of fitness evaluations.
+     *
+     * @param n the number of fitness evaluations to be consumed.
+     */
+    void consume(unsigned long long n) noexcept
+    {
+        const auto old = m_fevals.fetch_add(n, std::memory_order_relaxed);
+        // NOTE: avoid the possible wraparound in old + n.
+        if (n >= m_max_fevals || old >= m_max_fevals - n) {
+            request_stop();
+        }
+    }
+    /// Check a fitness against the target.
+    /**
+     * This method will raise the stop flag if \p f is less than the target fitness.
+     *
+     * @param f the fitness to be checked.
+     */
+    void check_target(double f) noexcept
+    {
+        if (f < m_target) {
+            request_stop();
+        }
+    }
+    /// Raise the stop flag.
+    void request_stop() noexcept
+    {
+        m_stop.store(true, std::memory_order_release);
+    }
+    /// Check the stop flag.
+    /**
+     * @return \p true if the stop flag has been raised, \p false otherwise.
+     */
+    bool stop_requested() const noexcept
+    {
+        return m_stop.load(std::memory_order_acquire);
+    }
+
+    // Reset the budget.
+    void reset() noexcept;
+
+    // Getters.
+    unsigned long long get_fevals() const noexcept;
+    unsigned long long get_max_fevals() const noexcept;
+    double get_target() const noexcept;
+
+private:
+    std::atomic<unsigned long long> m_fevals;
+    std::atomic<bool> m_stop;
+    const unsigned long long m_max_fevals;
+    const double m_target;
+};
+
+} // namespace pagmo
+
+#endif
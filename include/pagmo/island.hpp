@@ -29,6 +29,7 @@ see https://www.gnu.org/licenses/. */
 #ifndef PAGMO_ISLAND_HPP
 #define PAGMO_ISLAND_HPP
 
+#include <atomic>
 #include <functional>
 #include <future>
 #include <iostream>
@@ -248,6 +249,9 @@ struct is_virtual_base_of<pagmo::detail::isl_inner_base, pagmo::detail::isl_inne
 namespace pagmo
 {
 
+// Fwd declaration.
+class PAGMO_DLL_PUBLIC checkpointer;
+
 namespace detail
 {
 // NOTE: this construct is used to create a RAII-style object at the beginning
@@ -265,6 +269,9 @@ PAGMO_DLL_PUBLIC extern std::function<void(const algorithm &, const population &
                                            std::unique_ptr<detail::isl_inner_base> &)>
     island_factory;
 
+// Generate a new, globally unique, version number for the state of an island.
+PAGMO_DLL_PUBLIC unsigned long long new_island_version();
+
 // NOTE: the idea with this class is that we use it to store the data members of pagmo::island, and,
 // within pagmo::island, we store a pointer to an instance of this struct. The reason for this approach
 // is that, like this, we can provide sensible move semantics: just move the internal pointer of pagmo::island.
@@ -342,6 +349,10 @@ struct PAGMO_DLL_PUBLIC island_data {
     s_policy s_pol;
     // The vector of futures.
     std::vector<std::future<void>> futures;
+    // The version number of algo/pop. A new, globally unique, value is assigned
+    // each time algo or pop are set, so that it is possible to detect if the
+    // state of the island has changed (e.g., in pagmo::checkpointer).
+    std::atomic<unsigned long long> version{new_island_version()};
     // This will be explicitly set only during archipelago::push_back().
     // In all other situations, it will be null.
     archipelago *archi_ptr = nullptr;
@@ -460,6 +471,8 @@ class PAGMO_DLL_PUBLIC island
     using idata_t = detail::island_data;
     // archi needs access to the internal of island.
     friend class PAGMO_DLL_PUBLIC archipelago;
+    // checkpointer needs to access the version number of the island's state.
+    friend class PAGMO_DLL_PUBLIC checkpointer;
 #if !defined(PAGMO_DOXYGEN_INVOKED)
     // Make friends with the stream operator.
     friend PAGMO_DLL_PUBLIC std::ostream &operator<<(std::ostream &, const island &);
@@ -1086,6 +1099,11 @@ public:
      * to block until all tasks have been completed, and to fetch exceptions raised during the execution of the tasks.
      * island::status() can be used to query the status of the asynchronous operations in the island.
      *
+     * If an evaluation budget has been set on the problem of the island's population (see problem::set_budget()),
+     * the budget is checked before each invocation of <tt>run_evolve()</tt>: if a stop has been requested
+     * (e.g., because the maximum number of fitness evaluations or the target fitness has been reached),
+     * the evolution task will end without performing the remaining invocations.
+     *
      * @param n the number of times the <tt>run_evolve()</tt> method of the UDI will be called
      * within the evolution task. This corresponds also to the number of times migration can
      * happen, if the island belongs to an archipelago.
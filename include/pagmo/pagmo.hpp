@@ -34,7 +34,11 @@ see https://www.gnu.org/licenses/. */
 // Core.
 #include <pagmo/algorithm.hpp>
 #include <pagmo/archipelago.hpp>
+#include <pagmo/async_evaluator.hpp>
 #include <pagmo/bfe.hpp>
+#include <pagmo/checkpointer.hpp>
+#include <pagmo/columnar_store.hpp>
+#include <pagmo/evaluation_budget.hpp>
 #include <pagmo/exceptions.hpp>
 #include <pagmo/io.hpp>
 #include <pagmo/island.hpp>
@@ -46,6 +50,7 @@ see https://www.gnu.org/licenses/. */
 #include <pagmo/s_policy.hpp>
 #include <pagmo/threading.hpp>
 #include <pagmo/topology.hpp>
+#include <pagmo/tracing.hpp>
 #include <pagmo/type_traits.hpp>
 #include <pagmo/types.hpp>
 
@@ -84,6 +89,7 @@ see https://www.gnu.org/licenses/. */
 #include <pagmo/algorithms/pso_gen.hpp>
 #include <pagmo/algorithms/sade.hpp>
 #include <pagmo/algorithms/sea.hpp>
+#include <pagmo/algorithms/sep_cmaes.hpp>
 #include <pagmo/algorithms/sga.hpp>
 #include <pagmo/algorithms/simulated_annealing.hpp>
 
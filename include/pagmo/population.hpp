@@ -30,9 +30,11 @@ see https://www.gnu.org/licenses/. */
 #define PAGMO_POPULATION_HPP
 
 #include <cassert>
+#include <cstddef>
 #include <iostream>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -193,7 +195,7 @@ private:
     template <typename T, typename U>
     void push_back_impl(T &&, U &&);
     // Short routine to update the champion. Does nothing if the problem is MO
-    PAGMO_DLL_LOCAL void update_champion(vector_double, vector_double);
+    PAGMO_DLL_LOCAL void update_champion(const vector_double &, const vector_double &);
 
 public:
     // Adds one decision vector (chromosome) to the population.
@@ -306,6 +308,30 @@ public:
         return m_seed;
     }
 
+    // Enable or disable the deduplication index.
+    void set_dedup(bool);
+
+    /// Check if the deduplication index is enabled.
+    /**
+     * @return \p true if the deduplication index is enabled, \p false otherwise (see set_dedup()).
+     */
+    bool get_dedup() const
+    {
+        return m_dedup;
+    }
+
+    // Fetch the fitness of a decision vector from the deduplication index.
+    bool lookup_f(const vector_double &, vector_double &);
+
+    /// Number of fitness evaluations saved via the deduplication index.
+    /**
+     * @return the number of successful invocations of lookup_f().
+     */
+    unsigned long long get_dedup_hits() const
+    {
+        return m_dedup_hits;
+    }
+
     /// Save to archive.
     /**
      * This method will save \p this into the archive \p ar.
@@ -318,7 +344,12 @@ public:
     template <typename Archive>
     void save(Archive &ar, unsigned) const
     {
-        detail::to_archive(ar, m_prob, m_ID, m_x, m_f, m_champion_x, m_champion_f, m_e, m_seed);
+        detail::to_archive(ar, m_prob, m_ID);
+        // NOTE: the decision and fitness vectors are stored
+        // in a compact bulk format.
+        detail::bulk_save(ar, m_x);
+        detail::bulk_save(ar, m_f);
+        detail::to_archive(ar, m_champion_x, m_champion_f, m_e, m_seed, m_dedup, m_dedup_hits);
     }
     /// Load from archive.
     /**
@@ -335,8 +366,13 @@ public:
     {
         population tmp;
         try {
-            detail::from_archive(ar, tmp.m_prob, tmp.m_ID, tmp.m_x, tmp.m_f, tmp.m_champion_x, tmp.m_champion_f,
-                                 tmp.m_e, tmp.m_seed);
+            detail::from_archive(ar, tmp.m_prob, tmp.m_ID);
+            detail::bulk_load(ar, tmp.m_x);
+            detail::bulk_load(ar, tmp.m_f);
+            detail::from_archive(ar, tmp.m_champion_x, tmp.m_champion_f, tmp.m_e, tmp.m_seed, tmp.m_dedup,
+                                 tmp.m_dedup_hits);
+            // NOTE: the deduplication index is not serialised, it is rebuilt instead.
+            tmp.dedup_rebuild();
             // LCOV_EXCL_START
         } catch (...) {
             // NOTE: if anything goes wrong during deserialization, erase
@@ -352,6 +388,8 @@ public:
     BOOST_SERIALIZATION_SPLIT_MEMBER()
 private:
     void clear();
+    // Rebuild the deduplication index.
+    void dedup_rebuild();
 
 private:
     // Problem.
@@ -370,6 +408,12 @@ private:
     mutable detail::random_engine_type m_e;
     // Seed.
     unsigned m_seed;
+    // Deduplication index: if enabled, it maps the hash of the
+    // decision vector of each individual to the index of the individual.
+    std::unordered_multimap<std::size_t, size_type> m_dedup_index;
+    bool m_dedup = false;
+    // Number of fitness evaluations saved via the index.
+    unsigned long long m_dedup_hits = 0;
 };
 
 // Streaming operator for the class pagmo::population.
@@ -48,6 +48,7 @@ see https://www.gnu.org/licenses/. */
 #include <pagmo/detail/type_name.hpp>
 #include <pagmo/detail/typeid_name_extract.hpp>
 #include <pagmo/detail/visibility.hpp>
+#include <pagmo/evaluation_budget.hpp>
 #include <pagmo/exceptions.hpp>
 #include <pagmo/s11n.hpp>
 #include <pagmo/threading.hpp>
@@ -413,6 +414,18 @@ public:
     static constexpr bool value = implementation_defined;
 };
 
+// Detect the scalar_fitness() member function.
+template <typename T>
+class has_scalar_fitness
+{
+    template <typename U>
+    using scalar_fitness_t = decltype(std::declval<const U &>().scalar_fitness(std::declval<const double *>()));
+    static const bool implementation_defined = std::is_same<double, detected_t<scalar_fitness_t, T>>::value;
+
+public:
+    static constexpr bool value = implementation_defined;
+};
+
 namespace detail
 {
 
@@ -473,6 +486,8 @@ struct PAGMO_DLL_PUBLIC_INLINE_CLASS prob_inner_base {
     virtual vector_double fitness(const vector_double &) const = 0;
     virtual vector_double batch_fitness(const vector_double &) const = 0;
     virtual bool has_batch_fitness() const = 0;
+    virtual double scalar_fitness(const double *) const = 0;
+    virtual bool has_scalar_fitness() const = 0;
     virtual vector_double gradient(const vector_double &) const = 0;
     virtual bool has_gradient() const = 0;
     virtual sparsity_pattern gradient_sparsity() const = 0;
@@ -548,6 +563,20 @@ struct PAGMO_DLL_PUBLIC_INLINE_CLASS prob_inner final : prob_inner_base {
             return pagmo::has_batch_fitness<T>::value;
         }
     }
+    double scalar_fitness([[maybe_unused]] const double *dv) const final
+    {
+        if constexpr (pagmo::has_scalar_fitness<T>::value) {
+            return m_value.scalar_fitness(dv);
+        } else {
+            pagmo_throw(not_implemented_error,
+                        "The scalar_fitness() method has been invoked, but it is not implemented in a UDP of type '"
+                            + get_name_impl(m_value) + "'");
+        }
+    }
+    bool has_scalar_fitness() const final
+    {
+        return pagmo::has_scalar_fitness<T>::value;
+    }
     vector_double::size_type get_nobj() const final
     {
         return get_nobj_impl(m_value);
@@ -908,6 +937,8 @@ namespace detail
 PAGMO_DLL_PUBLIC void prob_check_dv(const problem &, const double *, vector_double::size_type);
 PAGMO_DLL_PUBLIC void prob_check_fv(const problem &, const double *, vector_double::size_type);
 PAGMO_DLL_PUBLIC vector_double prob_invoke_mem_batch_fitness(const problem &, const vector_double &, bool);
+PAGMO_DLL_PUBLIC void prob_check_budget_target(const problem &, const double *, vector_double::size_type);
+PAGMO_DLL_PUBLIC void prob_merge_fevals(const problem &, unsigned long long);
 
 } // namespace detail
 
@@ -968,6 +999,7 @@ PAGMO_DLL_PUBLIC vector_double prob_invoke_mem_batch_fitness(const problem &, co
  * vector_double::size_type get_nix() const;
  * vector_double batch_fitness(const vector_double &) const;
  * bool has_batch_fitness() const;
+ * double scalar_fitness(const double *) const;
  * bool has_gradient() const;
  * vector_double gradient(const vector_double &) const;
  * bool has_gradient_sparsity() const;
@@ -986,6 +1018,12 @@ PAGMO_DLL_PUBLIC vector_double prob_invoke_mem_batch_fitness(const problem &, co
  * See the documentation of the corresponding methods in this class for details on how the optional
  * methods in the UDP are used by pagmo::problem.
  *
+ * Copies of a problem whose UDP provides the thread_safety::constant guarantee share the same UDP instance
+ * (see the copy constructor). UDPs which do not provide such guarantee but which contain large amounts
+ * of immutable data (e.g., rotation matrices or lookup tables) can still be made cheap to copy by storing such
+ * data via reference-counted pointers to const (e.g., <tt>std::shared_ptr<const T></tt>), as done
+ * by pagmo::cec2013 and pagmo::cec2014.
+ *
  * \verbatim embed:rst:leading-asterisk
  * .. warning::
  *
@@ -1169,6 +1207,8 @@ private:
     // Make friends with the batch_fitness() invocation helper.
     friend PAGMO_DLL_PUBLIC vector_double detail::prob_invoke_mem_batch_fitness(const problem &, const vector_double &,
                                                                                 bool);
+    // Make friends with the fevals merging helper.
+    friend PAGMO_DLL_PUBLIC void detail::prob_merge_fevals(const problem &, unsigned long long);
 #endif
 
 public:
@@ -1199,6 +1239,20 @@ public:
         return m_has_batch_fitness;
     }
 
+    // Scalar fitness.
+    double scalar_fitness(const vector_double &) const;
+
+    /// Check if the UDP is capable of scalar fitness evaluation.
+    /**
+     * This method will return \p true if the UDP satisfies pagmo::has_scalar_fitness, \p false otherwise.
+     *
+     * @return a flag signalling the availability of the <tt>%scalar_fitness()</tt> method in the UDP.
+     */
+    bool has_scalar_fitness() const
+    {
+        return m_has_scalar_fitness;
+    }
+
     // Gradient.
     vector_double gradient(const vector_double &) const;
 
@@ -1448,13 +1502,31 @@ public:
 
     /// Increment the number of fitness evaluations.
     /**
-     * This method will increase the internal counter of fitness evaluations by \p n.
+     * This method will increase the internal counter of fitness evaluations by \p n. If an evaluation
+     * budget has been set (see problem::set_budget()), \p n fitness evaluations will also be consumed
+     * from the budget.
      *
      * @param n the amount by which the internal counter of fitness evaluations will be increased.
      */
     void increment_fevals(unsigned long long n) const
     {
         m_fevals.fetch_add(n, std::memory_order_relaxed);
+        if (m_budget) {
+            m_budget->consume(n);
+        }
+    }
+
+    // Set the evaluation budget.
+    void set_budget(std::shared_ptr<evaluation_budget>);
+
+    /// Get the evaluation budget.
+    /**
+     * @return a reference to the pointer to the evaluation budget of \p this
+     * (which will be null if no budget has been set).
+     */
+    const std::shared_ptr<evaluation_budget> &get_budget() const
+    {
+        return m_budget;
     }
 
     /// Number of gradient evaluations.
@@ -1470,6 +1542,17 @@ public:
         return m_gevals.load(std::memory_order_relaxed);
     }
 
+    /// Increment the number of gradient evaluations.
+    /**
+     * This method will increase the internal counter of gradient evaluations by \p n.
+     *
+     * @param n the amount by which the internal counter of gradient evaluations will be increased.
+     */
+    void increment_gevals(unsigned long long n) const
+    {
+        m_gevals.fetch_add(n, std::memory_order_relaxed);
+    }
+
     /// Number of hessians evaluations.
     /**
      * Each time a call to problem::hessians() successfully completes, an internal counter is increased by one.
@@ -1483,6 +1566,17 @@ public:
         return m_hevals.load(std::memory_order_relaxed);
     }
 
+    /// Increment the number of hessians evaluations.
+    /**
+     * This method will increase the internal counter of hessians evaluations by \p n.
+     *
+     * @param n the amount by which the internal counter of hessians evaluations will be increased.
+     */
+    void increment_hevals(unsigned long long n) const
+    {
+        m_hevals.fetch_add(n, std::memory_order_relaxed);
+    }
+
     // Set the seed for the stochastic variables.
     void set_seed(unsigned);
 
@@ -1614,11 +1708,16 @@ public:
     template <typename Archive>
     void save(Archive &ar, unsigned) const
     {
-        detail::to_archive(ar, m_ptr, m_fevals.load(std::memory_order_relaxed),
+        // NOTE: the UDP is serialised via a raw pointer, in the same way as Boost serialises
+        // an std::unique_ptr. This is safe even if the UDP is shared with other problems,
+        // because address tracking is disabled for the UDPs (see above): each problem
+        // will thus save (and, upon loading, own) a separate copy of the UDP.
+        const detail::prob_inner_base *const udp_ptr = m_ptr.get();
+        detail::to_archive(ar, udp_ptr, m_fevals.load(std::memory_order_relaxed),
                            m_gevals.load(std::memory_order_relaxed), m_hevals.load(std::memory_order_relaxed), m_lb,
-                           m_ub, m_nobj, m_nec, m_nic, m_nix, m_c_tol, m_has_batch_fitness, m_has_gradient,
-                           m_has_gradient_sparsity, m_has_hessians, m_has_hessians_sparsity, m_has_set_seed, m_name,
-                           m_gs_dim, m_hs_dim, m_thread_safety);
+                           m_ub, m_nobj, m_nec, m_nic, m_nix, m_c_tol, m_has_batch_fitness, m_has_scalar_fitness,
+                           m_has_gradient, m_has_gradient_sparsity, m_has_hessians, m_has_hessians_sparsity,
+                           m_has_set_seed, m_name, m_gs_dim, m_hs_dim, m_thread_safety);
     }
 
     /// Load from archive.
@@ -1634,12 +1733,16 @@ public:
     {
         // Deserialize in a separate object and move it in later, for exception safety.
         problem tmp_prob;
+        detail::prob_inner_base *udp_ptr = nullptr;
+        ar >> udp_ptr;
+        tmp_prob.m_ptr.reset(udp_ptr);
         unsigned long long fevals, gevals, hevals;
-        detail::from_archive(ar, tmp_prob.m_ptr, fevals, gevals, hevals, tmp_prob.m_lb, tmp_prob.m_ub, tmp_prob.m_nobj,
+        detail::from_archive(ar, fevals, gevals, hevals, tmp_prob.m_lb, tmp_prob.m_ub, tmp_prob.m_nobj,
                              tmp_prob.m_nec, tmp_prob.m_nic, tmp_prob.m_nix, tmp_prob.m_c_tol,
-                             tmp_prob.m_has_batch_fitness, tmp_prob.m_has_gradient, tmp_prob.m_has_gradient_sparsity,
-                             tmp_prob.m_has_hessians, tmp_prob.m_has_hessians_sparsity, tmp_prob.m_has_set_seed,
-                             tmp_prob.m_name, tmp_prob.m_gs_dim, tmp_prob.m_hs_dim, tmp_prob.m_thread_safety);
+                             tmp_prob.m_has_batch_fitness, tmp_prob.m_has_scalar_fitness, tmp_prob.m_has_gradient,
+                             tmp_prob.m_has_gradient_sparsity, tmp_prob.m_has_hessians,
+                             tmp_prob.m_has_hessians_sparsity, tmp_prob.m_has_set_seed, tmp_prob.m_name,
+                             tmp_prob.m_gs_dim, tmp_prob.m_hs_dim, tmp_prob.m_thread_safety);
         tmp_prob.m_fevals.store(fevals, std::memory_order_relaxed);
         tmp_prob.m_gevals.store(gevals, std::memory_order_relaxed);
         tmp_prob.m_hevals.store(hevals, std::memory_order_relaxed);
@@ -1655,9 +1758,14 @@ private:
         assert(m_ptr.get() != nullptr);
         return m_ptr.get();
     }
+    // NOTE: the mutable access to the UDP will first make sure
+    // that the UDP is not shared with other problems.
     detail::prob_inner_base *ptr()
     {
         assert(m_ptr.get() != nullptr);
+        if (m_ptr.use_count() > 1) {
+            m_ptr = m_ptr->clone();
+        }
         return m_ptr.get();
     }
 
@@ -1668,14 +1776,18 @@ private:
     void check_hessians_vector(const std::vector<vector_double> &) const;
 
 private:
-    // Pointer to the inner base problem
-    std::unique_ptr<detail::prob_inner_base> m_ptr;
+    // Pointer to the inner base problem. If the UDP provides the
+    // thread_safety::constant guarantee, copies of the problem share the
+    // UDP, which is cloned only upon mutable access (see ptr()).
+    std::shared_ptr<detail::prob_inner_base> m_ptr;
     // Counter for calls to the fitness
     mutable std::atomic<unsigned long long> m_fevals;
     // Counter for calls to the gradient
     mutable std::atomic<unsigned long long> m_gevals;
     // Counter for calls to the hessians
     mutable std::atomic<unsigned long long> m_hevals;
+    // The evaluation budget (shared by copies, not serialised).
+    std::shared_ptr<evaluation_budget> m_budget;
     // Various problem properties determined at construction time
     // from the concrete problem. These will be constant for the lifetime
     // of problem, but we cannot mark them as such because we want to be
@@ -1688,6 +1800,7 @@ private:
     vector_double::size_type m_nix;
     vector_double m_c_tol;
     bool m_has_batch_fitness;
+    bool m_has_scalar_fitness;
     bool m_has_gradient;
     bool m_has_gradient_sparsity;
     bool m_has_hessians;
@@ -29,12 +29,14 @@ see https://www.gnu.org/licenses/. */
 #ifndef PAGMO_PROBLEMS_CEC2013_HPP
 #define PAGMO_PROBLEMS_CEC2013_HPP
 
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include <pagmo/detail/visibility.hpp>
 #include <pagmo/problem.hpp>
+#include <pagmo/s11n.hpp>
 #include <pagmo/types.hpp>
 
 namespace pagmo
@@ -86,7 +88,10 @@ public:
     std::string get_name() const;
     // Object serialization
     template <typename Archive>
-    void serialize(Archive &, unsigned);
+    void save(Archive &, unsigned) const;
+    template <typename Archive>
+    void load(Archive &, unsigned);
+    BOOST_SERIALIZATION_SPLIT_MEMBER()
 
 private:
     PAGMO_DLL_LOCAL void sphere_func(const double *x, double *f, const unsigned nx, const double *Os, const double *Mr,
@@ -148,9 +153,9 @@ private:
 
     // problem id
     unsigned m_prob_id;
-    // problem data
-    std::vector<double> m_rotation_matrix;
-    std::vector<double> m_origin_shift;
+    // problem data (immutable, shared between copies)
+    std::shared_ptr<const std::vector<double>> m_rotation_matrix;
+    std::shared_ptr<const std::vector<double>> m_origin_shift;
 
     // pre-allocated stuff for speed
     mutable std::vector<double> m_y;
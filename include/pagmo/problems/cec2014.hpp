@@ -34,12 +34,14 @@ see https://www.gnu.org/licenses/. */
 #ifndef PAGMO_PROBLEMS_CEC2014_HPP
 #define PAGMO_PROBLEMS_CEC2014_HPP
 
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include <pagmo/detail/visibility.hpp>
 #include <pagmo/problem.hpp>
+#include <pagmo/s11n.hpp>
 #include <pagmo/types.hpp>
 
 namespace pagmo
@@ -102,12 +104,15 @@ public:
      */
     const vector_double &get_origin_shift() const
     {
-        return m_origin_shift;
+        return *m_origin_shift;
     }
 
     // Object serialization
     template <typename Archive>
-    void serialize(Archive &, unsigned);
+    void save(Archive &, unsigned) const;
+    template <typename Archive>
+    void load(Archive &, unsigned);
+    BOOST_SERIALIZATION_SPLIT_MEMBER()
 
 private:
     /* Sphere */
@@ -221,10 +226,10 @@ private:
     PAGMO_DLL_LOCAL void cf_cal(const double *x, double *f, const unsigned nx, const double *Os, double *delta,
                                 double *bias, double *fit, int cf_num) const;
 
-    // problem data
-    vector_double m_origin_shift;
-    vector_double m_rotation_matrix;
-    std::vector<int> m_shuffle;
+    // problem data (immutable, shared between copies)
+    std::shared_ptr<const vector_double> m_origin_shift;
+    std::shared_ptr<const vector_double> m_rotation_matrix;
+    std::shared_ptr<const std::vector<int>> m_shuffle;
 
     // auxiliary vectors
     mutable vector_double m_z;
@@ -63,6 +63,8 @@ struct PAGMO_DLL_PUBLIC schwefel {
     schwefel(unsigned dim = 1u);
     // Fitness computation
     vector_double fitness(const vector_double &) const;
+    // Scalar fitness computation
+    double scalar_fitness(const double *) const;
     // Box-bounds
     std::pair<vector_double, vector_double> get_bounds() const;
     /// Problem name
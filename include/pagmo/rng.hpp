@@ -29,6 +29,11 @@ see https://www.gnu.org/licenses/. */
 #ifndef PAGMO_RNG_HPP
 #define PAGMO_RNG_HPP
 
+#include <array>
+#include <cstdint>
+#include <ios>
+#include <iostream>
+#include <limits>
 #include <random>
 
 #include <pagmo/detail/visibility.hpp>
@@ -39,8 +44,220 @@ namespace pagmo
 namespace detail
 {
 
-// PaGMO makes use of the 32-bit Mersenne Twister by Matsumoto and Nishimura, 1998.
-using random_engine_type = std::mt19937;
+// Counter-based pseudo-random engine implementing the Philox4x32-10
+// generator by Salmon et al., 2011 ("Parallel random numbers: as easy as 1, 2, 3").
+//
+// The state of the engine consists of a 64-bit key (the seed) and a 128-bit counter,
+// plus a small buffer for the output of the current block. Each block of 4 32-bit
+// values is a pure function of the key and of the counter, thus any position in the
+// sequence can be accessed in O(1), both via discard() and via the stateless block()
+// function. The upper 64 bits of the counter are used as a stream index, so that
+// independent and reproducible streams can be derived from the same seed (e.g.,
+// one for each iteration of a parallel loop) via split().
+class philox4x32
+{
+public:
+    using result_type = std::uint32_t;
+    using block_type = std::array<result_type, 4>;
+
+    static constexpr result_type default_seed = 20111115u;
+
+    static constexpr result_type min()
+    {
+        return 0;
+    }
+    static constexpr result_type max()
+    {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    philox4x32() : philox4x32(default_seed) {}
+    explicit philox4x32(result_type s)
+    {
+        seed(s);
+    }
+    // Construct an engine positioned at the beginning of the block
+    // with index counter in the stream with index stream.
+    philox4x32(std::uint64_t s, std::uint64_t stream, std::uint64_t counter)
+        : m_key{lo(s), hi(s)}, m_ctr{lo(counter), hi(counter), lo(stream), hi(stream)}, m_buf{}, m_idx(4)
+    {
+    }
+
+    void seed(result_type s = default_seed)
+    {
+        m_key = {s, 0};
+        m_ctr = {0, 0, 0, 0};
+        m_buf = {0, 0, 0, 0};
+        m_idx = 4;
+    }
+
+    result_type operator()()
+    {
+        if (m_idx == 4u) {
+            m_buf = philox(m_ctr, m_key);
+            increment();
+            m_idx = 0;
+        }
+        return m_buf[m_idx++];
+    }
+
+    void discard(unsigned long long z)
+    {
+        // Consume what is left in the current block.
+        const auto avail = static_cast<unsigned long long>(4u - m_idx);
+        if (z <= avail) {
+            m_idx += static_cast<unsigned>(z);
+            return;
+        }
+        z -= avail;
+        // Skip whole blocks.
+        advance((z - 1u) / 4u);
+        // Generate the block containing the new position.
+        m_buf = philox(m_ctr, m_key);
+        increment();
+        m_idx = static_cast<unsigned>((z - 1u) % 4u) + 1u;
+    }
+
+    // Stream index and position (in blocks) within the stream of the next
+    // block to be generated.
+    std::uint64_t get_stream() const
+    {
+        return join(m_ctr[2], m_ctr[3]);
+    }
+    std::uint64_t get_counter() const
+    {
+        return join(m_ctr[0], m_ctr[1]);
+    }
+
+    // Create an engine with the same key, positioned at the
+    // beginning of the stream with index stream.
+    philox4x32 split(std::uint64_t stream) const
+    {
+        return philox4x32(join(m_key[0], m_key[1]), stream, 0);
+    }
+
+    // Stateless access: the block of 4 values at position counter
+    // in the stream with index stream generated from the seed s.
+    static block_type block(std::uint64_t s, std::uint64_t stream, std::uint64_t counter)
+    {
+        return philox({lo(counter), hi(counter), lo(stream), hi(stream)}, {lo(s), hi(s)});
+    }
+
+    friend bool operator==(const philox4x32 &a, const philox4x32 &b)
+    {
+        return a.m_key == b.m_key && a.m_ctr == b.m_ctr && a.m_idx == b.m_idx && (a.m_idx == 4u || a.m_buf == b.m_buf);
+    }
+    friend bool operator!=(const philox4x32 &a, const philox4x32 &b)
+    {
+        return !(a == b);
+    }
+
+    template <typename CharT, typename Traits>
+    friend std::basic_ostream<CharT, Traits> &operator<<(std::basic_ostream<CharT, Traits> &os, const philox4x32 &e)
+    {
+        const auto flags = os.flags();
+        os.flags(std::ios_base::dec | std::ios_base::left);
+        const auto sp = os.widen(' ');
+        os << e.m_key[0] << sp << e.m_key[1];
+        for (auto c : e.m_ctr) {
+            os << sp << c;
+        }
+        os << sp << e.m_idx;
+        os.flags(flags);
+        return os;
+    }
+    template <typename CharT, typename Traits>
+    friend std::basic_istream<CharT, Traits> &operator>>(std::basic_istream<CharT, Traits> &is, philox4x32 &e)
+    {
+        const auto flags = is.flags();
+        is.flags(std::ios_base::dec | std::ios_base::skipws);
+        philox4x32 tmp;
+        is >> tmp.m_key[0] >> tmp.m_key[1] >> tmp.m_ctr[0] >> tmp.m_ctr[1] >> tmp.m_ctr[2] >> tmp.m_ctr[3]
+            >> tmp.m_idx;
+        if (is && tmp.m_idx <= 4u) {
+            // NOTE: the output buffer is not serialised, recompute it
+            // from the previous counter value.
+            if (tmp.m_idx < 4u) {
+                auto prev = tmp;
+                prev.decrement();
+                tmp.m_buf = philox(prev.m_ctr, tmp.m_key);
+            }
+            e = tmp;
+        } else {
+            is.setstate(std::ios_base::failbit);
+        }
+        is.flags(flags);
+        return is;
+    }
+
+private:
+    static result_type lo(std::uint64_t n)
+    {
+        return static_cast<result_type>(n & 0xffffffffu);
+    }
+    static result_type hi(std::uint64_t n)
+    {
+        return static_cast<result_type>(n >> 32);
+    }
+    static std::uint64_t join(result_type l, result_type h)
+    {
+        return static_cast<std::uint64_t>(l) | (static_cast<std::uint64_t>(h) << 32);
+    }
+    static block_type philox(block_type ctr, std::array<result_type, 2> key)
+    {
+        for (auto r = 0; r < 10; ++r) {
+            if (r) {
+                // Bump the key.
+                key[0] += 0x9E3779B9u;
+                key[1] += 0xBB67AE85u;
+            }
+            const auto p0 = static_cast<std::uint64_t>(0xD2511F53u) * ctr[0];
+            const auto p1 = static_cast<std::uint64_t>(0xCD9E8D57u) * ctr[2];
+            ctr = {hi(p1) ^ ctr[1] ^ key[0], lo(p1), hi(p0) ^ ctr[3] ^ key[1], lo(p0)};
+        }
+        return ctr;
+    }
+    // Increment the 128-bit counter by one.
+    void increment()
+    {
+        for (auto &c : m_ctr) {
+            if (++c) {
+                break;
+            }
+        }
+    }
+    // Decrement the 128-bit counter by one.
+    void decrement()
+    {
+        for (auto &c : m_ctr) {
+            if (c--) {
+                break;
+            }
+        }
+    }
+    // Add n to the 128-bit counter.
+    void advance(std::uint64_t n)
+    {
+        const auto old = get_counter();
+        const auto cur = old + n;
+        m_ctr[0] = lo(cur);
+        m_ctr[1] = hi(cur);
+        if (cur < old) {
+            // Carry into the stream index.
+            if (++m_ctr[2] == 0u) {
+                ++m_ctr[3];
+            }
+        }
+    }
+
+    std::array<result_type, 2> m_key;
+    block_type m_ctr;
+    block_type m_buf;
+    unsigned m_idx;
+};
+
+// PaGMO makes use of the counter-based Philox4x32-10 engine.
+using random_engine_type = philox4x32;
 
 } // namespace detail
 
@@ -49,11 +266,11 @@ using random_engine_type = std::mt19937;
  * This class intends to be a thread-safe substitute for std::random_device,
  * allowing, at the same time, precise global seed control throughout PaGMO.
  * It offers the user access to a global Pseudo Random Sequence generated by the
- * 32-bit Mersenne Twister by Matsumoto and Nishimura, 1998.
+ * counter-based Philox4x32-10 generator by Salmon et al., 2011.
  * Such a PRS can be accessed by all PaGMO classes via the static method
- * random_device::next(). The seed of this global Pseudo Random Sequence can
- * be set by the method random_device::set_seed(), else by default is initialized
- * once at run-time using std::random_device.
+ * random_device::next(), which does not need any locking. The seed of this global
+ * Pseudo Random Sequence can be set by the method random_device::set_seed(),
+ * else by default is initialized once at run-time using std::random_device.
  */
 struct PAGMO_DLL_PUBLIC random_device {
     static unsigned next();
@@ -30,16 +30,22 @@ see https://www.gnu.org/licenses/. */
 #define PAGMO_S11N_HPP
 
 #include <cstddef>
+#include <cstdint>
 #include <locale>
 #include <random>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 #include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include <boost/config.hpp>
 #include <boost/mpl/greater.hpp>
 #include <boost/mpl/int.hpp>
 #include <boost/mpl/integral_c.hpp>
+#include <boost/serialization/array_wrapper.hpp>
 #include <boost/serialization/base_object.hpp>
 #include <boost/serialization/export.hpp>
 #include <boost/serialization/serialization.hpp>
@@ -60,6 +66,9 @@ see https://www.gnu.org/licenses/. */
 #include <boost/archive/text_oarchive.hpp>
 
 #include <pagmo/detail/s11n_wrappers.hpp>
+#include <pagmo/exceptions.hpp>
+#include <pagmo/rng.hpp>
+#include <pagmo/types.hpp>
 
 namespace pagmo
 {
@@ -86,6 +95,89 @@ struct tuple_s11n<0> {
     }
 };
 
+// Bulk serialization of a vector of vectors of arithmetic values
+// (e.g., the decision/fitness vectors of a population).
+//
+// Instead of serializing each vector separately, with its own size header,
+// we write a single header containing an endianness tag, the number
+// of vectors and their (common) size, followed by the values
+// of each vector stored as an array. With binary archives, each array
+// is then saved/loaded via a single raw memory copy. If the vectors
+// do not have all the same size, their sizes are written after
+// the header.
+//
+// NOTE: the endianness tag allows to detect binary archives which were
+// produced on a machine with a different byte order.
+constexpr std::uint32_t bulk_s11n_endian_tag = 0x01020304ul;
+// Marker for vectors of different sizes.
+constexpr unsigned long long bulk_s11n_ragged = static_cast<unsigned long long>(-1);
+
+template <typename Archive, typename T>
+inline void bulk_save(Archive &ar, const std::vector<std::vector<T>> &vv)
+{
+    static_assert(std::is_arithmetic<T>::value, "Bulk serialization is available only for arithmetic types.");
+
+    // Check if all the vectors have the same size.
+    auto size = vv.empty() ? 0ull : static_cast<unsigned long long>(vv[0].size());
+    for (const auto &v : vv) {
+        if (v.size() != size) {
+            size = bulk_s11n_ragged;
+            break;
+        }
+    }
+
+    to_archive(ar, bulk_s11n_endian_tag, static_cast<unsigned long long>(vv.size()), size);
+    if (size == bulk_s11n_ragged) {
+        std::vector<unsigned long long> sizes;
+        sizes.reserve(vv.size());
+        for (const auto &v : vv) {
+            sizes.push_back(static_cast<unsigned long long>(v.size()));
+        }
+        ar << sizes;
+    }
+    for (const auto &v : vv) {
+        if (!v.empty()) {
+            ar << boost::serialization::make_array(v.data(), v.size());
+        }
+    }
+}
+
+template <typename Archive, typename T>
+inline void bulk_load(Archive &ar, std::vector<std::vector<T>> &vv)
+{
+    static_assert(std::is_arithmetic<T>::value, "Bulk serialization is available only for arithmetic types.");
+
+    std::uint32_t tag;
+    unsigned long long n, size;
+    from_archive(ar, tag, n, size);
+    if (tag != bulk_s11n_endian_tag) {
+        pagmo_throw(std::runtime_error, "Cannot load a vector of vectors from an archive: the archive was produced "
+                                        "on a machine with a different byte order, or it is corrupted");
+    }
+
+    std::vector<unsigned long long> sizes;
+    if (size == bulk_s11n_ragged) {
+        ar >> sizes;
+        if (sizes.size() != n) {
+            pagmo_throw(std::runtime_error, "Cannot load a vector of vectors from an archive: the number of vectors ("
+                                                + std::to_string(n) + ") is inconsistent with the number of sizes ("
+                                                + std::to_string(sizes.size()) + ")");
+        }
+    }
+
+    // Load into a temporary, for exception safety.
+    std::vector<std::vector<T>> tmp;
+    tmp.reserve(static_cast<typename std::vector<std::vector<T>>::size_type>(n));
+    for (decltype(n) i = 0; i < n; ++i) {
+        tmp.emplace_back(static_cast<typename std::vector<T>::size_type>(sizes.empty() ? size : sizes[i]));
+        auto &v = tmp.back();
+        if (!v.empty()) {
+            ar >> boost::serialization::make_array(v.data(), v.size());
+        }
+    }
+    vv = std::move(tmp);
+}
+
 } // namespace detail
 
 } // namespace pagmo
@@ -112,6 +204,33 @@ struct tracking_level<std::tuple<Args...>> {
     BOOST_STATIC_ASSERT((mpl::greater<implementation_level<std::tuple<Args...>>, mpl::int_<primitive_type>>::value));
 };
 
+// Bulk serialization for groups of individuals (IDs, dvs and fvs),
+// which are used by the migration machinery. This overload is more specialised
+// than the generic tuple serialization above.
+template <class Archive>
+inline void save(Archive &ar, pagmo::individuals_group_t const &g, unsigned)
+{
+    ar << std::get<0>(g);
+    pagmo::detail::bulk_save(ar, std::get<1>(g));
+    pagmo::detail::bulk_save(ar, std::get<2>(g));
+}
+
+template <class Archive>
+inline void load(Archive &ar, pagmo::individuals_group_t &g, unsigned)
+{
+    pagmo::individuals_group_t tmp;
+    ar >> std::get<0>(tmp);
+    pagmo::detail::bulk_load(ar, std::get<1>(tmp));
+    pagmo::detail::bulk_load(ar, std::get<2>(tmp));
+    g = std::move(tmp);
+}
+
+template <class Archive>
+inline void serialize(Archive &ar, pagmo::individuals_group_t &g, unsigned version)
+{
+    split_free(ar, g, version);
+}
+
 // Implement serialization for the Mersenne twister engine.
 template <class Archive, class UIntType, std::size_t w, std::size_t n, std::size_t m, std::size_t r, UIntType a,
           std::size_t u, UIntType d, std::size_t s, UIntType b, std::size_t t, UIntType c, std::size_t l, UIntType f>
@@ -160,6 +279,45 @@ struct tracking_level<std::mersenne_twister_engine<UIntType, w, n, m, r, a, u, d
             mpl::int_<primitive_type>>::value));
 };
 
+// Implement serialization for the Philox engine.
+template <class Archive>
+inline void save(Archive &ar, pagmo::detail::philox4x32 const &e, unsigned)
+{
+    std::ostringstream oss;
+    // Use the "C" locale.
+    oss.imbue(std::locale::classic());
+    oss << e;
+    ar << oss.str();
+}
+
+template <class Archive>
+inline void load(Archive &ar, pagmo::detail::philox4x32 &e, unsigned)
+{
+    std::istringstream iss;
+    // Use the "C" locale.
+    iss.imbue(std::locale::classic());
+    std::string tmp;
+    ar >> tmp;
+    iss.str(tmp);
+    iss >> e;
+}
+
+template <class Archive>
+inline void serialize(Archive &ar, pagmo::detail::philox4x32 &e, unsigned version)
+{
+    split_free(ar, e, version);
+}
+
+// Set the tracking to track_never for the Philox engine.
+template <>
+struct tracking_level<pagmo::detail::philox4x32> {
+    typedef mpl::integral_c_tag tag;
+    typedef mpl::int_<track_never> type;
+    BOOST_STATIC_CONSTANT(int, value = tracking_level::type::value);
+    BOOST_STATIC_ASSERT(
+        (mpl::greater<implementation_level<pagmo::detail::philox4x32>, mpl::int_<primitive_type>>::value));
+};
+
 } // namespace serialization
 
 } // namespace boost
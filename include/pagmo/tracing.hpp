@@ -0,0 +1,116 @@
+/* Copyright 2017-2020 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#ifndef PAGMO_TRACING_HPP
+#define PAGMO_TRACING_HPP
+
+#include <atomic>
+#include <initializer_list>
+#include <iostream>
+#include <string>
+
+#include <pagmo/detail/visibility.hpp>
+
+namespace pagmo
+{
+
+namespace detail
+{
+
+// Global flag signalling whether tracing is active.
+PAGMO_DLL_PUBLIC extern std::atomic<bool> trace_flag;
+
+// Fast check for the tracing status, used in the
+// instrumented code paths.
+inline bool trace_enabled()
+{
+    return trace_flag.load(std::memory_order_relaxed);
+}
+
+// A named integral argument attached to a trace event.
+// NOTE: key must point to a string with static storage
+// duration (e.g., a string literal).
+struct trace_arg {
+    const char *key;
+    long long value;
+};
+
+// Record an instant event in the buffer of the calling thread.
+// NOTE: name and cat must point to strings with static
+// storage duration, and at most 3 arguments are recorded.
+PAGMO_DLL_PUBLIC void trace_instant(const char *, const char *, std::initializer_list<trace_arg> = {});
+
+// RAII helper that records a begin event on construction
+// and the matching end event on destruction. If tracing is disabled
+// at construction time, no event will be recorded.
+class PAGMO_DLL_PUBLIC trace_span
+{
+public:
+    explicit trace_span(const char *, const char *, std::initializer_list<trace_arg> = {});
+    ~trace_span();
+
+    trace_span(const trace_span &) = delete;
+    trace_span(trace_span &&) = delete;
+    trace_span &operator=(const trace_span &) = delete;
+    trace_span &operator=(trace_span &&) = delete;
+
+private:
+    const char *m_name;
+    const char *m_cat;
+    bool m_active;
+};
+
+} // namespace detail
+
+/// Timeline tracer.
+/**
+ * This class gives access to the opt-in tracing facility of pagmo. When tracing is enabled,
+ * pagmo will record begin/end events for each iteration of island::evolve(), for each migration
+ * exchange between islands (including the source and destination islands and the number of migrants),
+ * for each invocation of pagmo::bfe, and for the lifetime of each child process spawned by
+ * pagmo::fork_island.
+ *
+ * Events are stored in per-thread buffers which are appended to without any locking. The recorded
+ * timeline can be exported in the Chrome trace-event JSON format (which can be loaded, e.g.,
+ * in ``chrome://tracing`` or in Perfetto) via tracer::dump() or tracer::save().
+ *
+ * Tracing is disabled by default.
+ */
+struct PAGMO_DLL_PUBLIC tracer {
+    static void enable();
+    static void disable();
+    static bool is_enabled();
+    static void clear();
+    static unsigned long long get_n_events();
+    static void dump(std::ostream &);
+    static void save(const std::string &);
+};
+
+} // namespace pagmo
+
+#endif
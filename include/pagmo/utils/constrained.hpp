@@ -32,6 +32,7 @@ see https://www.gnu.org/licenses/. */
 #include <algorithm>
 #include <cmath>
 #include <utility>
+#include <vector>
 
 #include <pagmo/detail/custom_comparisons.hpp>
 #include <pagmo/detail/visibility.hpp>
@@ -79,6 +80,42 @@ inline std::pair<vector_double::size_type, double> test_ineq_constraints(It1 cin
     return std::pair<vector_double::size_type, double>(n, std::sqrt(l2));
 }
 
+// The outcome of the test of the constraints of a fitness vector, as used by compare_fc():
+// the number of satisfied constraints and two measures of the violation (l1 is used when
+// the fitness vector is the first argument of the comparison, l2 when it is the second).
+// Computing it once per fitness vector avoids re-testing the constraints at each comparison.
+struct fc_summary {
+    vector_double::size_type n;
+    double l1;
+    double l2;
+};
+
+// Tests the constraints of the fitness vector f. No checks are performed on the input.
+inline fc_summary make_fc_summary(const vector_double &f, vector_double::size_type neq, const vector_double &tol)
+{
+    auto ceq = test_eq_constraints(f.data() + 1, f.data() + 1 + neq, tol.data());
+    auto cineq = test_ineq_constraints(f.data() + 1 + neq, f.data() + f.size(), tol.data() + neq);
+    return fc_summary{ceq.first + cineq.first, ceq.second + cineq.second,
+                      std::sqrt(ceq.second * ceq.second + cineq.second * cineq.second)};
+}
+
+// Compares the fitness vectors with objectives f1 and f2 and constraint summaries s1 and s2,
+// nc being the number of constraints. Returns true if the first fitness vector is "better"
+// than the second, according to the strict ordering described in compare_fc().
+inline bool compare_fc_summary(double f1, const fc_summary &s1, double f2, const fc_summary &s2,
+                               vector_double::size_type nc)
+{
+    if (s1.n == s2.n) {   // same number of constraints satistfied
+        if (s1.n == nc) { // fitness decides
+            return less_than_f(f1, f2);
+        } else { // l2 norm decides
+            return less_than_f(s1.l1, s2.l2);
+        }
+    } else { // number of constraints satisfied decides
+        return s1.n > s2.n;
+    }
+}
+
 } // namespace detail
 
 // Compares two fitness vectors in a single-objective, constrained, case (from a vector of tolerances)
@@ -96,5 +133,29 @@ PAGMO_DLL_PUBLIC std::vector<pop_size_t> sort_population_con(const std::vector<v
 PAGMO_DLL_PUBLIC std::vector<pop_size_t> sort_population_con(const std::vector<vector_double> &,
                                                              vector_double::size_type, double = 0.);
 
+// Index of the best fitness vector in a single-objective, constrained, case (from a vector of tolerances)
+PAGMO_DLL_PUBLIC pop_size_t min_element_population_con(const std::vector<vector_double> &, vector_double::size_type,
+                                                       const vector_double &);
+
+// Index of the best fitness vector in a single-objective, constrained, case (from a scalar tolerance)
+PAGMO_DLL_PUBLIC pop_size_t min_element_population_con(const std::vector<vector_double> &, vector_double::size_type,
+                                                       double = 0.);
+
+// Index of the worst fitness vector in a single-objective, constrained, case (from a vector of tolerances)
+PAGMO_DLL_PUBLIC pop_size_t max_element_population_con(const std::vector<vector_double> &, vector_double::size_type,
+                                                       const vector_double &);
+
+// Index of the worst fitness vector in a single-objective, constrained, case (from a scalar tolerance)
+PAGMO_DLL_PUBLIC pop_size_t max_element_population_con(const std::vector<vector_double> &, vector_double::size_type,
+                                                       double = 0.);
+
+// Selects the best N individuals in a single-objective, constrained, case (from a vector of tolerances)
+PAGMO_DLL_PUBLIC std::vector<pop_size_t> select_best_N_con(const std::vector<vector_double> &, pop_size_t,
+                                                           vector_double::size_type, const vector_double &);
+
+// Selects the best N individuals in a single-objective, constrained, case (from a scalar tolerance)
+PAGMO_DLL_PUBLIC std::vector<pop_size_t> select_best_N_con(const std::vector<vector_double> &, pop_size_t,
+                                                           vector_double::size_type, double = 0.);
+
 } // namespace pagmo
 #endif
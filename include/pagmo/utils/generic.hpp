@@ -29,6 +29,7 @@ see https://www.gnu.org/licenses/. */
 #ifndef PAGMO_UTILS_GENERIC_HPP
 #define PAGMO_UTILS_GENERIC_HPP
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <limits>
@@ -398,6 +399,27 @@ PAGMO_DLL_PUBLIC std::vector<std::vector<vector_double::size_type>> kNN(const st
 namespace detail
 {
 
+// Rearranges the range [first, last) so that [first, middle) contains the smallest
+// elements of the range according to comp, sorted in ascending order. The order of
+// the elements in [middle, last) is unspecified. This has the same effect as
+// std::partial_sort(), but it runs in O(n + k log k) rather than O(n log k),
+// where n is the size of [first, last) and k the size of [first, middle).
+template <typename RandomIt, typename Compare>
+inline void select_top_k(RandomIt first, RandomIt middle, RandomIt last, Compare comp)
+{
+    assert(first <= middle && middle <= last);
+    std::nth_element(first, middle, last, comp);
+    std::sort(first, middle, comp);
+}
+
+} // namespace detail
+
+// Selects the best N individuals in a single-objective, unconstrained, case
+PAGMO_DLL_PUBLIC std::vector<pop_size_t> select_best_N_so(const std::vector<vector_double> &, pop_size_t);
+
+namespace detail
+{
+
 // modifies a chromosome so that it will be in the bounds. elements that are off are resampled at random in the bounds
 template <typename Rng>
 inline void force_bounds_random(vector_double &x, const vector_double &lb, const vector_double &ub, Rng &r_engine)
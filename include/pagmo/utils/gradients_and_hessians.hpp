@@ -34,6 +34,8 @@ see https://www.gnu.org/licenses/. */
 #include <stdexcept>
 #include <vector>
 
+#include <pagmo/bfe.hpp>
+#include <pagmo/detail/visibility.hpp>
 #include <pagmo/exceptions.hpp>
 #include <pagmo/problem.hpp>
 #include <pagmo/types.hpp>
@@ -242,6 +244,25 @@ vector_double estimate_gradient_h(Func f, const vector_double &x, double dx = 1e
     }
     return gradient;
 }
+
+// Heuristic to estimate the sparsity pattern (batch version).
+PAGMO_DLL_PUBLIC sparsity_pattern estimate_sparsity(const problem &, const bfe &, const vector_double &,
+                                                    double = 1e-8);
+
+// Numerical computation of the gradient (low-order, batch version).
+PAGMO_DLL_PUBLIC vector_double estimate_gradient(const problem &, const bfe &, const vector_double &, double = 1e-8);
+
+// Numerical computation of the gradient (high-order, batch version).
+PAGMO_DLL_PUBLIC vector_double estimate_gradient_h(const problem &, const bfe &, const vector_double &, double = 1e-2);
+
+// Numerical computation of the sparse gradient (batch version).
+PAGMO_DLL_PUBLIC vector_double estimate_sparse_gradient(const problem &, const bfe &, const vector_double &,
+                                                        double = 1e-8);
+
+// Numerical computation of the Hessians (batch version).
+PAGMO_DLL_PUBLIC std::vector<vector_double> estimate_hessians(const problem &, const bfe &, const vector_double &,
+                                                              double = 1e-4);
+
 } // namespace pagmo
 // namespace pagmo
 
@@ -56,6 +56,17 @@ namespace detail
 PAGMO_DLL_PUBLIC void reksum(std::vector<std::vector<double>> &, const std::vector<pop_size_t> &, pop_size_t,
                              pop_size_t, std::vector<double> = std::vector<double>());
 
+// The decomposition methods supported by decompose_objectives().
+enum class decomposition_method { weighted, tchebycheff, bi };
+
+// Convert the name of a decomposition method into a decomposition_method.
+PAGMO_DLL_PUBLIC decomposition_method decomposition_method_from_string(const std::string &);
+
+// Decomposes the nf objectives in f given the weights w and the reference point ref_point.
+// No checks are performed and no memory is allocated.
+PAGMO_DLL_PUBLIC double decompose_objectives_impl(const double *, const double *, const double *,
+                                                  vector_double::size_type, decomposition_method);
+
 } // namespace detail
 
 // Pareto-dominance
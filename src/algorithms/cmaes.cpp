@@ -30,7 +30,6 @@ see https://www.gnu.org/licenses/. */
 #include <cmath>
 #include <iomanip>
 #include <iostream>
-#include <numeric>
 #include <random>
 #include <sstream>
 #include <stdexcept>
@@ -39,7 +38,7 @@ see https://www.gnu.org/licenses/. */
 
 #include <pagmo/algorithm.hpp>
 #include <pagmo/algorithms/cmaes.hpp>
-#include <pagmo/detail/custom_comparisons.hpp>
+#include <pagmo/bfe.hpp>
 #include <pagmo/detail/eigen.hpp>
 #include <pagmo/detail/eigen_s11n.hpp>
 #include <pagmo/exceptions.hpp>
@@ -47,6 +46,11 @@ see https://www.gnu.org/licenses/. */
 #include <pagmo/population.hpp>
 #include <pagmo/s11n.hpp>
 #include <pagmo/types.hpp>
+#include <pagmo/utils/generic.hpp>
+
+// NOTE: apparently this must be included *after*
+// the other serialization headers.
+#include <boost/serialization/optional.hpp>
 
 namespace pagmo
 {
@@ -191,7 +195,13 @@ population cmaes::evolve(population pop) const
     Eigen::MatrixXd Dinv = Eigen::MatrixXd::Identity(_(dim), _(dim));
     Eigen::MatrixXd Cold = Eigen::MatrixXd::Identity(_(dim), _(dim));
     Eigen::VectorXd tmp = Eigen::VectorXd::Zero(_(dim));
-    std::vector<Eigen::VectorXd> elite(mu, tmp);
+    // The elite of each generation, stored column-wise.
+    Eigen::MatrixXd elite(_(dim), _(mu));
+    // The normally distributed samples and the offspring of each generation, stored column-wise.
+    // The offspring are stored contiguously in xs, so that they can be passed as they are to a bfe.
+    Eigen::MatrixXd Z(_(dim), _(lam));
+    vector_double xs(dim * lam, 0.);
+    Eigen::Map<Eigen::MatrixXd> X(xs.data(), _(dim), _(lam));
     vector_double dumb(dim, 0.);
 
     // If the algorithm is called for the first time on this problem dimension / pop size or if m_memory is false we
@@ -237,21 +247,29 @@ population cmaes::evolve(population pop) const
     // HERE WE START THE JUICE OF THE ALGORITHM      //
     // ----------------------------------------------//
     Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> es(_(dim));
+    // The product B * D, which maps the normally distributed samples into the
+    // coordinate system of C. It changes only when C is decomposed, and, D being
+    // diagonal, it is refreshed in O(N^2).
+    Eigen::MatrixXd BD = B * D.diagonal().asDiagonal();
     for (decltype(m_gen) gen = 1u; gen <= m_gen; ++gen) {
         // 1 - We generate and evaluate lam new individuals
+        // 1a - we create lam randomly normal distributed vectors
         for (decltype(lam) i = 0u; i < lam; ++i) {
-            // 1a - we create a randomly normal distributed vector
             for (decltype(dim) j = 0u; j < dim; ++j) {
-                tmp(_(j)) = normally_distributed_number(m_e);
+                Z(_(j), _(i)) = normally_distributed_number(m_e);
             }
-            // 1b - and store its transformed value in the newpop
-            newpop[i] = mean + (sigma * B * D * tmp);
         }
+        // 1b - and transform them all at once with a single matrix product
+        X.noalias() = BD * Z;
+        X *= sigma;
+        X.colwise() += mean;
+        // The flatness in chromosome, measured on the last sample.
+        const auto dx = (X.col(_(lam - 1u)) - mean).norm();
 
         // 1bis - Check the exit conditions and logs
         // Exit condition on xtol
         {
-            if ((sigma * B * D * tmp).norm() < m_xtol) {
+            if (dx < m_xtol) {
                 if (m_verbosity > 0u) {
                     std::cout << "Exit condition -- xtol < " << m_xtol << std::endl;
                 }
@@ -273,8 +291,6 @@ population cmaes::evolve(population pop) const
         if (m_verbosity > 0u) {
             // Every m_verbosity generations print a log line
             if (gen % m_verbosity == 1u || m_verbosity == 1u) {
-                // The population flattness in chromosome
-                auto dx = (sigma * B * D * tmp).norm();
                 // The population flattness in fitness
                 auto idx_b = pop.best_idx();
                 auto idx_w = pop.worst_idx();
@@ -297,10 +313,10 @@ population cmaes::evolve(population pop) const
         if (m_force_bounds) {
             for (decltype(lam) i = 0u; i < lam; ++i) {
                 for (decltype(dim) j = 0u; j < dim; ++j) {
-                    if (newpop[i](_(j)) < lb[j]) {
-                        newpop[i](_(j)) = lb[j];
-                    } else if (newpop[i](_(j)) > ub[j]) {
-                        newpop[i](_(j)) = ub[j];
+                    if (X(_(j), _(i)) < lb[j]) {
+                        X(_(j), _(i)) = lb[j];
+                    } else if (X(_(j), _(i)) > ub[j]) {
+                        X(_(j), _(i)) = ub[j];
                     }
                 }
             }
@@ -312,31 +328,30 @@ population cmaes::evolve(population pop) const
             pop.get_problem().set_seed(std::uniform_int_distribution<unsigned>()(m_e));
         }
         // Reinsertion
-        for (decltype(lam) i = 0u; i < lam; ++i) {
-            for (decltype(dim) j = 0u; j < dim; ++j) {
-                dumb[j] = newpop[i](_(j));
+        if (m_bfe) {
+            // bfe is available:
+            const auto fitnesses = (*m_bfe)(prob, xs);
+            for (decltype(lam) i = 0u; i < lam; ++i) {
+                dumb.assign(xs.data() + i * dim, xs.data() + (i + 1u) * dim);
+                pop.set_xf(i, dumb, {fitnesses[i]});
+            }
+        } else {
+            // bfe not available:
+            for (decltype(lam) i = 0u; i < lam; ++i) {
+                dumb.assign(xs.data() + i * dim, xs.data() + (i + 1u) * dim);
+                pop.set_x(i, dumb);
             }
-            pop.set_x(i, dumb);
         }
         counteval += lam;
         // 4 - We extract the elite from this generation.
-        std::vector<population::size_type> best_idx(lam);
-        std::iota(best_idx.begin(), best_idx.end(), population::size_type(0));
-        std::sort(best_idx.begin(), best_idx.end(), [&pop](population::size_type idx1, population::size_type idx2) {
-            return detail::less_than_f(pop.get_f()[idx1][0], pop.get_f()[idx2][0]);
-        });
-        best_idx.resize(mu); // not needed?
+        // NOTE: only the mu best individuals need to be sorted.
+        const auto best_idx = select_best_N_so(pop.get_f(), mu);
         for (decltype(mu) i = 0u; i < mu; ++i) {
-            for (decltype(dim) j = 0u; j < dim; ++j) {
-                elite[i](_(j)) = pop.get_x()[best_idx[i]][j];
-            }
+            elite.col(_(i)) = Eigen::Map<const Eigen::VectorXd>(pop.get_x()[best_idx[i]].data(), _(dim));
         }
         // 5 - Compute the new mean of the elite storing the old one
         meanold = mean;
-        mean = elite[0] * weights(0);
-        for (decltype(mu) i = 1u; i < mu; ++i) {
-            mean += elite[i] * weights(_(i));
-        }
+        mean.noalias() = elite * weights;
         // 6 - Update evolution paths
         ps = (1. - cs) * ps + std::sqrt(cs * (2. - cs) * mueff) * invsqrtC * (mean - meanold) / sigma;
         double hsig = 0.;
@@ -346,10 +361,9 @@ population cmaes::evolve(population pop) const
         pc = (1. - cc) * pc + hsig * std::sqrt(cc * (2. - cc) * mueff) * (mean - meanold) / sigma;
         // 7 - Adapt Covariance Matrix
         Cold = C;
-        C = (elite[0] - meanold) * (elite[0] - meanold).transpose() * weights(0);
-        for (decltype(mu) i = 1u; i < mu; ++i) {
-            C += (elite[i] - meanold) * (elite[i] - meanold).transpose() * weights(_(i));
-        }
+        // Rank-mu update as a single matrix product.
+        elite.colwise() -= meanold;
+        C.noalias() = elite * weights.asDiagonal() * elite.transpose();
         C /= sigma * sigma;
         C = (1. - c1 - cmu) * Cold + cmu * C + c1 * ((pc * pc.transpose()) + (1. - hsig) * cc * (2. - cc) * Cold);
         // 8 - Adapt sigma
@@ -370,6 +384,7 @@ population cmaes::evolve(population pop) const
                     Dinv(_(j), _(j)) = 1. / D(_(j), _(j));
                 }
                 invsqrtC = B * Dinv * B.transpose();
+                BD = B * D.diagonal().asDiagonal();
             } // if eigendecomposition fails just skip it and keep pevious successful one.
         }
     } // end of generation loop
@@ -389,6 +404,18 @@ void cmaes::set_seed(unsigned seed)
     m_seed = seed;
 }
 
+/// Sets the batch function evaluation scheme
+/**
+ * After a call to this method, evolve() will evaluate the offspring of each
+ * generation with a single call to \p b.
+ *
+ * @param b batch function evaluation object
+ */
+void cmaes::set_bfe(const bfe &b)
+{
+    m_bfe = b;
+}
+
 /// Extra info
 /**
  * One of the optional methods of any user-defined algorithm (UDA).
@@ -442,7 +469,7 @@ void cmaes::serialize(Archive &ar, unsigned)
 {
     detail::archive(ar, m_gen, m_cc, m_cs, m_c1, m_cmu, m_sigma0, m_ftol, m_xtol, m_memory, m_force_bounds, sigma, mean,
                     variation, newpop, B, D, C, invsqrtC, pc, ps, counteval, eigeneval, m_e, m_seed, m_verbosity,
-                    m_log);
+                    m_log, m_bfe);
 }
 
 } // namespace pagmo
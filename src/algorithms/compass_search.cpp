@@ -26,22 +26,30 @@ You should have received copies of the GNU General Public License and the
 GNU Lesser General Public License along with the PaGMO library.  If not,
 see https://www.gnu.org/licenses/. */
 
+#include <algorithm>
 #include <cmath>
 #include <iomanip>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <pagmo/algorithm.hpp>
 #include <pagmo/algorithms/compass_search.hpp>
 #include <pagmo/algorithms/not_population_based.hpp>
+#include <pagmo/bfe.hpp>
 #include <pagmo/exceptions.hpp>
 #include <pagmo/io.hpp>
 #include <pagmo/population.hpp>
 #include <pagmo/s11n.hpp>
+#include <pagmo/types.hpp>
 #include <pagmo/utils/constrained.hpp>
 
+// NOTE: apparently this must be included *after*
+// the other serialization headers.
+#include <boost/serialization/optional.hpp>
+
 namespace pagmo
 {
 
@@ -120,36 +128,67 @@ population compass_search::evolve(population pop) const
 
     double newrange = m_start_range;
 
+    // The poll points of an iteration and their fitnesses (used only if a bfe is available).
+    const auto nf = prob.get_nf();
+    vector_double poll_x, poll_f, f_poll(nf);
+    if (m_bfe) {
+        poll_x.resize(2u * dim * dim);
+    }
+
     while (newrange > m_stop_range && fevals <= m_max_fevals) {
         flag = false;
-        for (decltype(dim) i = 0u; i < dim; i++) {
-            auto x_trial = cur_best_x;
-            // move up
-            x_trial[i] = cur_best_x[i] + newrange * (ub[i] - lb[i]);
-            // feasibility correction
-            if (x_trial[i] > ub[i]) x_trial[i] = ub[i];
-            // objective function evaluation
-            auto f_trial = prob.fitness(x_trial);
-            fevals++;
-            if (compare_fc(f_trial, cur_best_f, prob.get_nec(), prob.get_c_tol())) {
-                cur_best_f = f_trial;
-                cur_best_x = x_trial;
-                flag = true;
-                break; // accept
+        if (m_bfe) {
+            // bfe is available: we build the 2n poll points (moving up and down along
+            // each coordinate, with the feasibility correction) and evaluate them at once.
+            for (decltype(dim) i = 0u; i < dim; i++) {
+                auto up = poll_x.data() + 2u * i * dim, down = up + dim;
+                std::copy(cur_best_x.begin(), cur_best_x.end(), up);
+                std::copy(cur_best_x.begin(), cur_best_x.end(), down);
+                up[i] = std::min(cur_best_x[i] + newrange * (ub[i] - lb[i]), ub[i]);
+                down[i] = std::max(cur_best_x[i] - newrange * (ub[i] - lb[i]), lb[i]);
             }
+            poll_f = (*m_bfe)(prob, poll_x);
+            fevals += static_cast<unsigned>(2u * dim);
+            // The best poll point is accepted if it improves the current best.
+            for (decltype(dim) j = 0u; j < 2u * dim; ++j) {
+                std::copy(poll_f.data() + j * nf, poll_f.data() + (j + 1u) * nf, f_poll.begin());
+                if (compare_fc(f_poll, cur_best_f, prob.get_nec(), prob.get_c_tol())) {
+                    cur_best_f = f_poll;
+                    cur_best_x.assign(poll_x.data() + j * dim, poll_x.data() + (j + 1u) * dim);
+                    flag = true;
+                }
+            }
+        } else {
+            // bfe not available:
+            for (decltype(dim) i = 0u; i < dim; i++) {
+                auto x_trial = cur_best_x;
+                // move up
+                x_trial[i] = cur_best_x[i] + newrange * (ub[i] - lb[i]);
+                // feasibility correction
+                if (x_trial[i] > ub[i]) x_trial[i] = ub[i];
+                // objective function evaluation
+                auto f_trial = prob.fitness(x_trial);
+                fevals++;
+                if (compare_fc(f_trial, cur_best_f, prob.get_nec(), prob.get_c_tol())) {
+                    cur_best_f = f_trial;
+                    cur_best_x = x_trial;
+                    flag = true;
+                    break; // accept
+                }
 
-            // move down
-            x_trial[i] = cur_best_x[i] - newrange * (ub[i] - lb[i]);
-            // feasibility correction
-            if (x_trial[i] < lb[i]) x_trial[i] = lb[i];
-            // objective function evaluation
-            f_trial = prob.fitness(x_trial);
-            fevals++;
-            if (compare_fc(f_trial, cur_best_f, prob.get_nec(), prob.get_c_tol())) {
-                cur_best_f = f_trial;
-                cur_best_x = x_trial;
-                flag = true;
-                break; // accept
+                // move down
+                x_trial[i] = cur_best_x[i] - newrange * (ub[i] - lb[i]);
+                // feasibility correction
+                if (x_trial[i] < lb[i]) x_trial[i] = lb[i];
+                // objective function evaluation
+                f_trial = prob.fitness(x_trial);
+                fevals++;
+                if (compare_fc(f_trial, cur_best_f, prob.get_nec(), prob.get_c_tol())) {
+                    cur_best_f = f_trial;
+                    cur_best_x = x_trial;
+                    flag = true;
+                    break; // accept
+                }
             }
         }
         if (!flag) {
@@ -193,6 +232,18 @@ population compass_search::evolve(population pop) const
     return pop;
 }
 
+/// Sets the batch function evaluation scheme
+/**
+ * After a call to this method, evolve() will evaluate all the poll points of an iteration
+ * in a single call to \p b.
+ *
+ * @param b batch function evaluation object
+ */
+void compass_search::set_bfe(const bfe &b)
+{
+    m_bfe = b;
+}
+
 /// Extra info
 /**
  * One of the optional methods of any user-defined algorithm (UDA).
@@ -222,7 +273,7 @@ template <typename Archive>
 void compass_search::serialize(Archive &ar, unsigned)
 {
     detail::archive(ar, boost::serialization::base_object<not_population_based>(*this), m_max_fevals, m_start_range,
-                    m_stop_range, m_reduction_coeff, m_verbosity, m_log);
+                    m_stop_range, m_reduction_coeff, m_verbosity, m_log, m_bfe);
 }
 
 } // namespace pagmo
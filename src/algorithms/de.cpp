@@ -26,18 +26,26 @@ You should have received copies of the GNU General Public License and the
 GNU Lesser General Public License along with the PaGMO library.  If not,
 see https://www.gnu.org/licenses/. */
 
+#include <algorithm>
+#include <cassert>
 #include <cmath>
+#include <cstddef>
 #include <iomanip>
 #include <iostream>
 #include <numeric>
 #include <random>
+#include <sstream>
 #include <stdexcept>
 #include <string>
+#include <tuple>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include <pagmo/algorithm.hpp>
 #include <pagmo/algorithms/de.hpp>
+#include <pagmo/async_evaluator.hpp>
+#include <pagmo/bfe.hpp>
 #include <pagmo/exceptions.hpp>
 #include <pagmo/io.hpp>
 #include <pagmo/population.hpp>
@@ -45,12 +53,181 @@ see https://www.gnu.org/licenses/. */
 #include <pagmo/types.hpp>
 #include <pagmo/utils/generic.hpp>
 
+// NOTE: apparently this must be included *after*
+// the other serialization headers.
+#include <boost/serialization/optional.hpp>
+
+
 namespace pagmo
 {
 
+namespace detail
+{
+
+namespace
+{
+
+// Create in tmp the trial vector for the individual at index i in popold,
+// according to the DE variant. gbIter is the best decision vector
+// of the previous generation. The feasibility of the trial vector
+// is enforced before returning.
+void de_make_trial(vector_double &tmp, std::vector<vector_double>::size_type i,
+                   const std::vector<vector_double> &popold, const vector_double &gbIter, const vector_double &lb,
+                   const vector_double &ub, unsigned variant, double F, double CR, random_engine_type &e)
+{
+    auto NP = popold.size();
+    auto dim = lb.size();
+    std::uniform_real_distribution<double> drng(0., 1.); // to generate a number in [0, 1)
+    // to generate a random index for the chromosome
+    std::uniform_int_distribution<vector_double::size_type> c_idx(0u, dim - 1u);
+    std::vector<vector_double::size_type> r(5); // indexes of 5 selected population members
+
+    /*-----We select at random 5 indexes from the population---------------------------------*/
+    std::vector<vector_double::size_type> idxs(NP);
+    std::iota(idxs.begin(), idxs.end(), vector_double::size_type(0u));
+    for (auto j = 0u; j < 5u; ++j) { // Durstenfeld's algorithm to select 5 indexes at random
+        auto idx = std::uniform_int_distribution<vector_double::size_type>(0u, NP - 1u - j)(e);
+        r[j] = idxs[idx];
+        std::swap(idxs[idx], idxs[NP - 1u - j]);
+    }
+
+    /*-------DE/best/1/exp--------------------------------------------------------------------*/
+    /*-------The oldest DE variant but still not bad. However, we have found several---------*/
+    /*-------optimization problems where misconvergence occurs.-------------------------------*/
+    if (variant == 1u) {
+        tmp = popold[i];
+        auto n = c_idx(e);
+        auto L = 0u;
+        do {
+            tmp[n] = gbIter[n] + F * (popold[r[1]][n] - popold[r[2]][n]);
+            n = (n + 1u) % dim;
+            ++L;
+        } while ((drng(e) < CR) && (L < dim));
+    }
+
+    /*-------DE/rand/1/exp-------------------------------------------------------------------*/
+    /*-------This is one of my favourite strategies. It works especially well when the-------*/
+    /*-------"gbIter[]"-schemes experience misconvergence. Try e.g. F=0.7 and CR=0.5---------*/
+    /*-------as a first guess.---------------------------------------------------------------*/
+    else if (variant == 2u) {
+        tmp = popold[i];
+        auto n = c_idx(e);
+        decltype(dim) L = 0u;
+        do {
+            tmp[n] = popold[r[0]][n] + F * (popold[r[1]][n] - popold[r[2]][n]);
+            n = (n + 1u) % dim;
+            ++L;
+        } while ((drng(e) < CR) && (L < dim));
+    }
+    /*-------DE/rand-to-best/1/exp-----------------------------------------------------------*/
+    /*-------This variant seems to be one of the best strategies. Try F=0.85 and CR=1.------*/
+    /*-------If you get misconvergence try to increase NP. If this doesn't help you----------*/
+    /*-------should play around with all three control variables.----------------------------*/
+    else if (variant == 3u) {
+        tmp = popold[i];
+        auto n = c_idx(e);
+        auto L = 0u;
+        do {
+            tmp[n] = tmp[n] + F * (gbIter[n] - tmp[n]) + F * (popold[r[0]][n] - popold[r[1]][n]);
+            n = (n + 1u) % dim;
+            ++L;
+        } while ((drng(e) < CR) && (L < dim));
+    }
+    /*-------DE/best/2/exp is another powerful variant worth trying--------------------------*/
+    else if (variant == 4u) {
+        tmp = popold[i];
+        auto n = c_idx(e);
+        auto L = 0u;
+        do {
+            tmp[n] = gbIter[n] + (popold[r[0]][n] + popold[r[1]][n] - popold[r[2]][n] - popold[r[3]][n]) * F;
+            n = (n + 1u) % dim;
+            ++L;
+        } while ((drng(e) < CR) && (L < dim));
+    }
+    /*-------DE/rand/2/exp seems to be a robust optimizer for many functions-------------------*/
+    else if (variant == 5u) {
+        tmp = popold[i];
+        auto n = c_idx(e);
+        auto L = 0u;
+        do {
+            tmp[n] = popold[r[4]][n]
+                     + (popold[r[0]][n] + popold[r[1]][n] - popold[r[2]][n] - popold[r[3]][n]) * F;
+            n = (n + 1u) % dim;
+            ++L;
+        } while ((drng(e) < CR) && (L < dim));
+    }
+
+    /*=======Essentially same strategies but BINOMIAL CROSSOVER===============================*/
+    /*-------DE/best/1/bin--------------------------------------------------------------------*/
+    else if (variant == 6u) {
+        tmp = popold[i];
+        auto n = c_idx(e);
+        for (decltype(dim) L = 0u; L < dim; ++L) { /* perform Dc binomial trials */
+            if ((drng(e) < CR) || L + 1u == dim) { /* change at least one parameter */
+                tmp[n] = gbIter[n] + F * (popold[r[1]][n] - popold[r[2]][n]);
+            }
+            n = (n + 1u) % dim;
+        }
+    }
+    /*-------DE/rand/1/bin-------------------------------------------------------------------*/
+    else if (variant == 7u) {
+        tmp = popold[i];
+        auto n = c_idx(e);
+        for (decltype(dim) L = 0u; L < dim; ++L) { /* perform Dc binomial trials */
+            if ((drng(e) < CR) || L + 1u == dim) { /* change at least one parameter */
+                tmp[n] = popold[r[0]][n] + F * (popold[r[1]][n] - popold[r[2]][n]);
+            }
+            n = (n + 1u) % dim;
+        }
+    }
+    /*-------DE/rand-to-best/1/bin-----------------------------------------------------------*/
+    else if (variant == 8u) {
+        tmp = popold[i];
+        auto n = c_idx(e);
+        for (decltype(dim) L = 0u; L < dim; ++L) { /* perform Dc binomial trials */
+            if ((drng(e) < CR) || L + 1u == dim) { /* change at least one parameter */
+                tmp[n] = tmp[n] + F * (gbIter[n] - tmp[n]) + F * (popold[r[0]][n] - popold[r[1]][n]);
+            }
+            n = (n + 1u) % dim;
+        }
+    }
+    /*-------DE/best/2/bin--------------------------------------------------------------------*/
+    else if (variant == 9u) {
+        tmp = popold[i];
+        auto n = c_idx(e);
+        for (decltype(dim) L = 0u; L < dim; ++L) { /* perform Dc binomial trials */
+            if ((drng(e) < CR) || L + 1u == dim) { /* change at least one parameter */
+                tmp[n]
+                    = gbIter[n] + (popold[r[0]][n] + popold[r[1]][n] - popold[r[2]][n] - popold[r[3]][n]) * F;
+            }
+            n = (n + 1u) % dim;
+        }
+    }
+    /*-------DE/rand/2/bin--------------------------------------------------------------------*/
+    else if (variant == 10u) {
+        tmp = popold[i];
+        auto n = c_idx(e);
+        for (decltype(dim) L = 0u; L < dim; ++L) { /* perform Dc binomial trials */
+            if ((drng(e) < CR) || L + 1u == dim) { /* change at least one parameter */
+                tmp[n] = popold[r[4]][n]
+                         + (popold[r[0]][n] + popold[r[1]][n] - popold[r[2]][n] - popold[r[3]][n]) * F;
+            }
+            n = (n + 1u) % dim;
+        }
+    }
+
+    // Trial mutation now in tmp, force feasibility.
+    // detail::force_bounds_reflection(tmp, lb, ub); // TODO: check if this choice is better
+    force_bounds_random(tmp, lb, ub, e);
+}
+
+} // namespace
+
+} // namespace detail
+
 de::de(unsigned gen, double F, double CR, unsigned variant, double ftol, double xtol, unsigned seed)
     : m_gen(gen), m_F(F), m_CR(CR), m_variant(variant), m_Ftol(ftol), m_xtol(xtol), m_e(seed), m_seed(seed),
-      m_verbosity(0u), m_log()
+      m_verbosity(0u), m_log(), m_async_n_workers(0u)
 {
     if (variant < 1u || variant > 10u) {
         pagmo_throw(std::invalid_argument,
@@ -116,10 +293,7 @@ population de::evolve(population pop) const
     m_log.clear();
 
     // Some vectors used during evolution are declared.
-    vector_double tmp(dim);                              // contains the mutated candidate
-    std::uniform_real_distribution<double> drng(0., 1.); // to generate a number in [0, 1)
-    std::uniform_int_distribution<vector_double::size_type> c_idx(
-        0u, dim - 1u); // to generate a random index for the chromosome
+    vector_double tmp(dim); // contains the mutated candidate
 
     // We extract from pop the chromosomes and fitness associated
     auto popold = pop.get_x();
@@ -133,172 +307,10 @@ population de::evolve(population pop) const
     auto gbfit = fit[best_idx];
     // the best decision vector of a generation
     auto gbIter = gbX;
-    std::vector<vector_double::size_type> r(5); // indexes of 5 selected population members
-
-    // Main DE iterations
-    for (decltype(m_gen) gen = 1u; gen <= m_gen; ++gen) {
-        // Start of the loop through the population
-        for (decltype(NP) i = 0u; i < NP; ++i) {
-            /*-----We select at random 5 indexes from the population---------------------------------*/
-            std::vector<vector_double::size_type> idxs(NP);
-            std::iota(idxs.begin(), idxs.end(), vector_double::size_type(0u));
-            for (auto j = 0u; j < 5u; ++j) { // Durstenfeld's algorithm to select 5 indexes at random
-                auto idx = std::uniform_int_distribution<vector_double::size_type>(0u, NP - 1u - j)(m_e);
-                r[j] = idxs[idx];
-                std::swap(idxs[idx], idxs[NP - 1u - j]);
-            }
-
-            /*-------DE/best/1/exp--------------------------------------------------------------------*/
-            /*-------The oldest DE variant but still not bad. However, we have found several---------*/
-            /*-------optimization problems where misconvergence occurs.-------------------------------*/
-            if (m_variant == 1u) {
-                tmp = popold[i];
-                auto n = c_idx(m_e);
-                auto L = 0u;
-                do {
-                    tmp[n] = gbIter[n] + m_F * (popold[r[1]][n] - popold[r[2]][n]);
-                    n = (n + 1u) % dim;
-                    ++L;
-                } while ((drng(m_e) < m_CR) && (L < dim));
-            }
-
-            /*-------DE/rand/1/exp-------------------------------------------------------------------*/
-            /*-------This is one of my favourite strategies. It works especially well when the-------*/
-            /*-------"gbIter[]"-schemes experience misconvergence. Try e.g. m_F=0.7 and m_CR=0.5---------*/
-            /*-------as a first guess.---------------------------------------------------------------*/
-            else if (m_variant == 2u) {
-                tmp = popold[i];
-                auto n = c_idx(m_e);
-                decltype(dim) L = 0u;
-                do {
-                    tmp[n] = popold[r[0]][n] + m_F * (popold[r[1]][n] - popold[r[2]][n]);
-                    n = (n + 1u) % dim;
-                    ++L;
-                } while ((drng(m_e) < m_CR) && (L < dim));
-            }
-            /*-------DE/rand-to-best/1/exp-----------------------------------------------------------*/
-            /*-------This variant seems to be one of the best strategies. Try m_F=0.85 and m_CR=1.------*/
-            /*-------If you get misconvergence try to increase NP. If this doesn't help you----------*/
-            /*-------should play around with all three control variables.----------------------------*/
-            else if (m_variant == 3u) {
-                tmp = popold[i];
-                auto n = c_idx(m_e);
-                auto L = 0u;
-                do {
-                    tmp[n] = tmp[n] + m_F * (gbIter[n] - tmp[n]) + m_F * (popold[r[0]][n] - popold[r[1]][n]);
-                    n = (n + 1u) % dim;
-                    ++L;
-                } while ((drng(m_e) < m_CR) && (L < dim));
-            }
-            /*-------DE/best/2/exp is another powerful variant worth trying--------------------------*/
-            else if (m_variant == 4u) {
-                tmp = popold[i];
-                auto n = c_idx(m_e);
-                auto L = 0u;
-                do {
-                    tmp[n] = gbIter[n] + (popold[r[0]][n] + popold[r[1]][n] - popold[r[2]][n] - popold[r[3]][n]) * m_F;
-                    n = (n + 1u) % dim;
-                    ++L;
-                } while ((drng(m_e) < m_CR) && (L < dim));
-            }
-            /*-------DE/rand/2/exp seems to be a robust optimizer for many functions-------------------*/
-            else if (m_variant == 5u) {
-                tmp = popold[i];
-                auto n = c_idx(m_e);
-                auto L = 0u;
-                do {
-                    tmp[n] = popold[r[4]][n]
-                             + (popold[r[0]][n] + popold[r[1]][n] - popold[r[2]][n] - popold[r[3]][n]) * m_F;
-                    n = (n + 1u) % dim;
-                    ++L;
-                } while ((drng(m_e) < m_CR) && (L < dim));
-            }
-
-            /*=======Essentially same strategies but BINOMIAL CROSSOVER===============================*/
-            /*-------DE/best/1/bin--------------------------------------------------------------------*/
-            else if (m_variant == 6u) {
-                tmp = popold[i];
-                auto n = c_idx(m_e);
-                for (decltype(dim) L = 0u; L < dim; ++L) {     /* perform Dc binomial trials */
-                    if ((drng(m_e) < m_CR) || L + 1u == dim) { /* change at least one parameter */
-                        tmp[n] = gbIter[n] + m_F * (popold[r[1]][n] - popold[r[2]][n]);
-                    }
-                    n = (n + 1u) % dim;
-                }
-            }
-            /*-------DE/rand/1/bin-------------------------------------------------------------------*/
-            else if (m_variant == 7u) {
-                tmp = popold[i];
-                auto n = c_idx(m_e);
-                for (decltype(dim) L = 0u; L < dim; ++L) {     /* perform Dc binomial trials */
-                    if ((drng(m_e) < m_CR) || L + 1u == dim) { /* change at least one parameter */
-                        tmp[n] = popold[r[0]][n] + m_F * (popold[r[1]][n] - popold[r[2]][n]);
-                    }
-                    n = (n + 1u) % dim;
-                }
-            }
-            /*-------DE/rand-to-best/1/bin-----------------------------------------------------------*/
-            else if (m_variant == 8u) {
-                tmp = popold[i];
-                auto n = c_idx(m_e);
-                for (decltype(dim) L = 0u; L < dim; ++L) {     /* perform Dc binomial trials */
-                    if ((drng(m_e) < m_CR) || L + 1u == dim) { /* change at least one parameter */
-                        tmp[n] = tmp[n] + m_F * (gbIter[n] - tmp[n]) + m_F * (popold[r[0]][n] - popold[r[1]][n]);
-                    }
-                    n = (n + 1u) % dim;
-                }
-            }
-            /*-------DE/best/2/bin--------------------------------------------------------------------*/
-            else if (m_variant == 9u) {
-                tmp = popold[i];
-                auto n = c_idx(m_e);
-                for (decltype(dim) L = 0u; L < dim; ++L) {     /* perform Dc binomial trials */
-                    if ((drng(m_e) < m_CR) || L + 1u == dim) { /* change at least one parameter */
-                        tmp[n]
-                            = gbIter[n] + (popold[r[0]][n] + popold[r[1]][n] - popold[r[2]][n] - popold[r[3]][n]) * m_F;
-                    }
-                    n = (n + 1u) % dim;
-                }
-            }
-            /*-------DE/rand/2/bin--------------------------------------------------------------------*/
-            else if (m_variant == 10u) {
-                tmp = popold[i];
-                auto n = c_idx(m_e);
-                for (decltype(dim) L = 0u; L < dim; ++L) {     /* perform Dc binomial trials */
-                    if ((drng(m_e) < m_CR) || L + 1u == dim) { /* change at least one parameter */
-                        tmp[n] = popold[r[4]][n]
-                                 + (popold[r[0]][n] + popold[r[1]][n] - popold[r[2]][n] - popold[r[3]][n]) * m_F;
-                    }
-                    n = (n + 1u) % dim;
-                }
-            }
-
-            // Trial mutation now in tmp. force feasibility and see how good this choice really was.
-            // a) feasibility
-            // detail::force_bounds_reflection(tmp, lb, ub); // TODO: check if this choice is better
-            detail::force_bounds_random(tmp, lb, ub, m_e);
-            // b) how good?
-            auto newfitness = prob.fitness(tmp); /* Evaluates tmp[] */
-            if (newfitness[0] <= fit[i][0]) {    /* improved objective function value ? */
-                fit[i] = newfitness;
-                popnew[i] = tmp;
-                // updates the individual in pop (avoiding to recompute the objective function)
-                pop.set_xf(i, popnew[i], newfitness);
-
-                if (newfitness[0] <= gbfit[0]) {
-                    /* if so...*/
-                    gbfit = newfitness; /* reset gbfit to new low...*/
-                    gbX = popnew[i];
-                }
-            } else {
-                popnew[i] = popold[i];
-            }
-        } // End of one generation
-        /* Save best population member of current iteration */
-        gbIter = gbX;
-        /* swap population arrays. New generation becomes old one */
-        std::swap(popold, popnew);
 
+    // Checks the exit conditions and takes care of logs and prints at the end of
+    // the generation gen. Returns true if the evolution must stop.
+    auto end_of_generation = [&](unsigned gen) {
         // Check the exit conditions
         double dx = 0., df = 0.;
         best_idx = pop.best_idx();
@@ -310,7 +322,7 @@ population de::evolve(population pop) const
             if (m_verbosity > 0u) {
                 std::cout << "Exit condition -- xtol < " << m_xtol << '\n';
             }
-            return pop;
+            return true;
         }
 
         df = std::abs(pop.get_f()[worst_idx][0] - pop.get_f()[best_idx][0]);
@@ -318,22 +330,13 @@ population de::evolve(population pop) const
             if (m_verbosity > 0u) {
                 std::cout << "Exit condition -- ftol < " << m_Ftol << '\n';
             }
-            return pop;
+            return true;
         }
 
         // Logs and prints (verbosity modes > 1: a line is added every m_verbosity generations)
         if (m_verbosity > 0u) {
             // Every m_verbosity generations print a log line
             if (gen % m_verbosity == 1u || m_verbosity == 1u) {
-                best_idx = pop.best_idx();
-                worst_idx = pop.worst_idx();
-                dx = 0.;
-                // The population flattness in chromosome
-                for (decltype(dim) i = 0u; i < dim; ++i) {
-                    dx += std::abs(pop.get_x()[worst_idx][i] - pop.get_x()[best_idx][i]);
-                }
-                // The population flattness in fitness
-                df = std::abs(pop.get_f()[worst_idx][0] - pop.get_f()[best_idx][0]);
                 // Every 50 lines print the column names
                 if (count % 50u == 1u) {
                     print("\n", std::setw(7), "Gen:", std::setw(15), "Fevals:", std::setw(15), "Best:", std::setw(15),
@@ -346,6 +349,122 @@ population de::evolve(population pop) const
                 m_log.emplace_back(gen, prob.get_fevals() - fevals0, pop.get_f()[best_idx][0], dx, df);
             }
         }
+        return false;
+    };
+
+    if (m_async) {
+        // Steady-state DE: up to get_n_workers() trial vectors are kept under evaluation at all times.
+        // As soon as the fitness of a trial becomes available, the trial competes with
+        // its target individual and, if successful, immediately replaces it, and a new trial is
+        // created from the updated population. A generation here corresponds to NP evaluations.
+        async_evaluator ev(prob, *m_async, m_async_n_workers);
+        const auto n_evals = static_cast<unsigned long long>(m_gen) * NP;
+        unsigned long long n_submitted = 0, n_completed = 0;
+        // The index of the target individual of each trial under evaluation.
+        std::unordered_map<unsigned long long, decltype(NP)> targets;
+        decltype(NP) next_target = 0u;
+        auto submit_trial = [&]() {
+            detail::de_make_trial(tmp, next_target, popold, gbX, lb, ub, m_variant, m_F, m_CR, m_e);
+            targets.emplace(ev.submit(tmp), next_target);
+            next_target = (next_target + 1u) % NP;
+            ++n_submitted;
+        };
+
+        while (n_submitted < n_evals && ev.get_n_pending() < ev.get_n_workers()) {
+            submit_trial();
+        }
+        while (n_completed < n_evals) {
+            auto res = ev.wait();
+            ++n_completed;
+            const auto t_it = targets.find(std::get<0>(res));
+            assert(t_it != targets.end());
+            const auto i = t_it->second;
+            targets.erase(t_it);
+            auto &newfitness = std::get<2>(res);
+            if (newfitness[0] <= fit[i][0]) {
+                fit[i] = newfitness;
+                popold[i] = std::move(std::get<1>(res));
+                pop.set_xf(i, popold[i], newfitness);
+                if (newfitness[0] <= gbfit[0]) {
+                    gbfit = newfitness;
+                    gbX = popold[i];
+                }
+            }
+            if (n_submitted < n_evals) {
+                submit_trial();
+            }
+            if (n_completed % NP == 0u && end_of_generation(static_cast<unsigned>(n_completed / NP))) {
+                return pop;
+            }
+        }
+        if (m_verbosity) {
+            std::cout << "Exit condition -- generations = " << m_gen << '\n';
+        }
+        return pop;
+    }
+
+    // Selection of the trial vector tmp, whose fitness is newfitness, against the individual i.
+    auto select_trial = [&](decltype(NP) i, const vector_double &newfitness) {
+        if (newfitness[0] <= fit[i][0]) { /* improved objective function value ? */
+            fit[i] = newfitness;
+            popnew[i] = tmp;
+            // updates the individual in pop (avoiding to recompute the objective function)
+            pop.set_xf(i, popnew[i], newfitness);
+
+            if (newfitness[0] <= gbfit[0]) {
+                /* if so...*/
+                gbfit = newfitness; /* reset gbfit to new low...*/
+                gbX = popnew[i];
+            }
+        } else {
+            popnew[i] = popold[i];
+        }
+    };
+
+    // The trial vectors of a generation and their fitnesses (used only if a bfe is available).
+    vector_double batch_x, batch_f;
+    vector_double newfitness(1u);
+    if (m_bfe) {
+        batch_x.resize(NP * dim);
+    }
+
+    // Main DE iterations
+    for (decltype(m_gen) gen = 1u; gen <= m_gen; ++gen) {
+        if (m_bfe) {
+            // bfe is available: we create all the trial vectors first...
+            for (decltype(NP) i = 0u; i < NP; ++i) {
+                detail::de_make_trial(tmp, i, popold, gbIter, lb, ub, m_variant, m_F, m_CR, m_e);
+                std::copy(tmp.begin(), tmp.end(), batch_x.begin() + static_cast<std::ptrdiff_t>(i * dim));
+            }
+            // ... evaluate them in one go ...
+            batch_f = (*m_bfe)(prob, batch_x);
+            // ... and then run the selection.
+            for (decltype(NP) i = 0u; i < NP; ++i) {
+                const auto it = batch_x.begin() + static_cast<std::ptrdiff_t>(i * dim);
+                std::copy(it, it + static_cast<std::ptrdiff_t>(dim), tmp.begin());
+                newfitness[0] = batch_f[i];
+                select_trial(i, newfitness);
+            }
+        } else {
+            // bfe not available: the trial vectors are evaluated one by one.
+            for (decltype(NP) i = 0u; i < NP; ++i) {
+                detail::de_make_trial(tmp, i, popold, gbIter, lb, ub, m_variant, m_F, m_CR, m_e);
+                // Trial mutation now in tmp, see how good this choice really was (the fitness
+                // is taken from the deduplication index of the population, if possible).
+                if (!pop.lookup_f(tmp, newfitness)) {
+                    newfitness[0] = prob.scalar_fitness(tmp);
+                }
+                select_trial(i, newfitness);
+            }
+        } // End of one generation
+        /* Save best population member of current iteration */
+        gbIter = gbX;
+        /* swap population arrays. New generation becomes old one */
+        std::swap(popold, popnew);
+
+        if (end_of_generation(gen)) {
+            return pop;
+        }
     } // end main DE iterations
     if (m_verbosity) {
         std::cout << "Exit condition -- generations = " << m_gen << '\n';
@@ -363,6 +482,33 @@ void de::set_seed(unsigned seed)
     m_seed = seed;
 }
 
+/// Sets the batch function evaluation scheme
+/**
+ * After a call to this method, evolve() will evaluate the trial vectors of each generation
+ * in a single call to \p b.
+ *
+ * @param b batch function evaluation object
+ */
+void de::set_bfe(const bfe &b)
+{
+    m_bfe = b;
+}
+
+/// Sets the asynchronous evaluation mode
+/**
+ * After a call to this method, evolve() will run a steady-state variant of DE in which
+ * the fitness evaluations are performed asynchronously by a pagmo::async_evaluator. The bfe, if set,
+ * is not used in this mode.
+ *
+ * @param backend the backend of the asynchronous evaluator.
+ * @param n_workers the number of concurrent evaluations (if zero, the number of hardware threads will be used).
+ */
+void de::set_async(async_backend backend, unsigned n_workers)
+{
+    m_async = backend;
+    m_async_n_workers = n_workers;
+}
+
 /// Extra info
 /**
  * One of the optional methods of any user-defined algorithm (UDA).
@@ -371,10 +517,18 @@ void de::set_seed(unsigned seed)
  */
 std::string de::get_extra_info() const
 {
-    return "\tGenerations: " + std::to_string(m_gen) + "\n\tParameter F: " + std::to_string(m_F)
-           + "\n\tParameter CR: " + std::to_string(m_CR) + "\n\tVariant: " + std::to_string(m_variant)
-           + "\n\tStopping xtol: " + std::to_string(m_xtol) + "\n\tStopping ftol: " + std::to_string(m_Ftol)
-           + "\n\tVerbosity: " + std::to_string(m_verbosity) + "\n\tSeed: " + std::to_string(m_seed);
+    std::string retval = "\tGenerations: " + std::to_string(m_gen) + "\n\tParameter F: " + std::to_string(m_F)
+                         + "\n\tParameter CR: " + std::to_string(m_CR) + "\n\tVariant: " + std::to_string(m_variant)
+                         + "\n\tStopping xtol: " + std::to_string(m_xtol) + "\n\tStopping ftol: "
+                         + std::to_string(m_Ftol) + "\n\tVerbosity: " + std::to_string(m_verbosity)
+                         + "\n\tSeed: " + std::to_string(m_seed);
+    if (m_async) {
+        std::ostringstream oss;
+        oss << *m_async;
+        retval += "\n\tAsynchronous evaluation: " + oss.str() + " (" + std::to_string(m_async_n_workers)
+                  + " workers)";
+    }
+    return retval;
 }
 
 /// Object serialization
@@ -388,7 +542,8 @@ std::string de::get_extra_info() const
 template <typename Archive>
 void de::serialize(Archive &ar, unsigned)
 {
-    detail::archive(ar, m_gen, m_F, m_CR, m_variant, m_Ftol, m_xtol, m_e, m_seed, m_verbosity, m_log);
+    detail::archive(ar, m_gen, m_F, m_CR, m_variant, m_Ftol, m_xtol, m_e, m_seed, m_verbosity, m_log, m_async,
+                    m_async_n_workers, m_bfe);
 }
 
 } // namespace pagmo
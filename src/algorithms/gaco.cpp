@@ -49,6 +49,7 @@ see https://www.gnu.org/licenses/. */
 #include <pagmo/s11n.hpp>
 #include <pagmo/types.hpp>
 #include <pagmo/utils/constrained.hpp>
+#include <pagmo/utils/generic.hpp>
 
 // NOTE: apparently this must be included *after*
 // the other serialization headers.
@@ -124,6 +125,7 @@ population gaco::evolve(population pop) const
     std::uniform_real_distribution<> dist(0, 1);
     std::normal_distribution<> gauss{0., 1.};
     vector_double penalties(pop_size);
+    vector_double sorted_penalties(m_ker);
     // I declare a vector where I will store the positions of the various individuals:
     std::vector<decltype(penalties.size())> sort_list(penalties.size());
     // I create the vector of vectors where I will store all the new ants which will be generated:
@@ -198,11 +200,15 @@ population gaco::evolve(population pop) const
 
         // 2 - update and sort solutions in the sol_archive, based on the computed penalties
         // We fill it with 0,1,2,3,...,K
+        // NOTE: only the best m_ker individuals enter the solution archive, hence
+        // only those need to be sorted.
         std::iota(std::begin(sort_list), std::end(sort_list), decltype(penalties.size())(0));
-        std::sort(sort_list.begin(), sort_list.end(),
-                  [&penalties](decltype(penalties.size()) idx1, decltype(penalties.size()) idx2) {
-                      return detail::less_than_f(penalties[idx1], penalties[idx2]);
-                  });
+        detail::select_top_k(sort_list.begin(),
+                             sort_list.begin() + static_cast<decltype(sort_list)::difference_type>(m_ker),
+                             sort_list.end(),
+                             [&penalties](decltype(penalties.size()) idx1, decltype(penalties.size()) idx2) {
+                                 return detail::less_than_f(penalties[idx1], penalties[idx2]);
+                             });
 
         if (m_memory == true && m_counter > 1) {
             sol_archive = m_sol_archive;
@@ -226,9 +232,11 @@ population gaco::evolve(population pop) const
             }
 
         } else {
-            // This sorts the penalties from the smallest ([0]) to the biggest ([end])
-            std::sort(penalties.begin(), penalties.end(), detail::less_than_f<double>);
-            update_sol_archive(pop, penalties, sort_list, sol_archive);
+            // This stores the best m_ker penalties from the smallest ([0]) to the biggest ([m_ker - 1])
+            for (decltype(m_ker) i = 0u; i < m_ker; ++i) {
+                sorted_penalties[i] = penalties[sort_list[i]];
+            }
+            update_sol_archive(pop, sorted_penalties, sort_list, sol_archive);
             if (m_memory == true) {
                 m_sol_archive = sol_archive;
             }
@@ -552,8 +560,8 @@ double gaco::penalty_computation(const vector_double &f, const population &pop,
  * Function which updates the solution archive, if better solutions are found
  *
  * @param[in] pop Population: the current population is passed
- * @param[in] sorted_vector Stored penalty vector: the vector in which the penalties of the current population are
- * stored from the best to the worst is passed
+ * @param[in] sorted_vector Stored penalty vector: the vector in which the best penalties of the current population
+ * are stored from the best to the worst is passed
  * @param[in] sorted_list Positions of stored penalties: this represents the positions of the individuals wrt their
  * penalties as they are stored in the stored_vector
  * @param[in] sol_archive Solution archive: the solution archive is useful for retrieving the current
@@ -164,9 +164,13 @@ population ihs::evolve(population pop) const
             }
         }
 
-        // 4 - We fix the new decision vector within the bounds and evaluate
+        // 4 - We fix the new decision vector within the bounds and evaluate (the fitness
+        // is taken from the deduplication index of the population, if possible)
         detail::force_bounds_reflection(new_x, lb, ub);
-        auto new_f = prob.fitness(new_x);
+        vector_double new_f;
+        if (!pop.lookup_f(new_x, new_f)) {
+            new_f = prob.fitness(new_x);
+        }
 
         // 5 - We insert the new decision vector in the population
         if (prob.get_nobj() == 1u) {      // Single objective case
@@ -800,7 +800,8 @@ unsigned ipopt_internal_test()
  * The individual selection and replacement criteria can be set via set_selection(const std::string &),
  * set_selection(population::size_type), set_replacement(const std::string &) and
  * set_replacement(population::size_type). The return status of the Ipopt optimisation run will be recorded (it can
- * be fetched with get_last_opt_result()).
+ * be fetched with get_last_opt_result()). If the number of starts is greater than one (see set_n_starts()),
+ * several individuals will be optimised and reinserted into \p pop.
  *
  * @param pop the population to be optimised.
  *
@@ -825,86 +826,151 @@ population ipopt::evolve(population pop) const
 
     auto &prob = pop.get_problem();
 
-    // Setup of the initial guess. Store also the original fitness
-    // of the selected individual, old_f, for later use.
-    auto sel_xf = select_individual(pop);
-    vector_double initial_guess(std::move(sel_xf.first)), old_f(std::move(sel_xf.second));
-
-    // Check the initial guess.
+    // Check an initial guess.
     // NOTE: this should be guaranteed by the population's invariants.
-    assert(initial_guess.size() == prob.get_nx());
     const auto bounds = prob.get_bounds();
-    for (decltype(bounds.first.size()) i = 0; i < bounds.first.size(); ++i) {
-        if (std::isnan(initial_guess[i])) {
-            pagmo_throw(std::invalid_argument,
-                        "the value of the initial guess at index " + std::to_string(i) + " is NaN");
+    auto check_initial_guess = [&bounds](const vector_double &initial_guess) {
+        assert(initial_guess.size() == bounds.first.size());
+        for (decltype(bounds.first.size()) i = 0; i < bounds.first.size(); ++i) {
+            if (std::isnan(initial_guess[i])) {
+                pagmo_throw(std::invalid_argument,
+                            "the value of the initial guess at index " + std::to_string(i) + " is NaN");
+            }
+            if (initial_guess[i] < bounds.first[i] || initial_guess[i] > bounds.second[i]) {
+                pagmo_throw(std::invalid_argument, "the value of the initial guess at index " + std::to_string(i)
+                                                       + " is outside the problem's bounds");
+            }
         }
-        if (initial_guess[i] < bounds.first[i] || initial_guess[i] > bounds.second[i]) {
-            pagmo_throw(std::invalid_argument, "the value of the initial guess at index " + std::to_string(i)
-                                                   + " is outside the problem's bounds");
+    };
+
+    // Run an Ipopt optimisation starting from initial_guess. The return status is written
+    // into status, and the Ipopt problem (containing the solution, the log, etc.) is returned.
+    auto run_ipopt = [this, &prob](const vector_double &initial_guess, unsigned verbosity,
+                                   Ipopt::ApplicationReturnStatus &status) {
+        // Initialize the Ipopt machinery, following the tutorial.
+        Ipopt::SmartPtr<Ipopt::TNLP> nlp = ::new detail::ipopt_nlp(prob, initial_guess, verbosity);
+        Ipopt::SmartPtr<Ipopt::IpoptApplication> app = ::IpoptApplicationFactory();
+        app->RethrowNonIpoptException(true);
+
+        // Logic for the handling of constraints tolerances. The logic is as follows:
+        // - if the user provides the "constr_viol_tol" option, use that *unconditionally*. Otherwise,
+        // - compute the minimum tolerance min_tol among those provided by the problem. If zero, ignore
+        //   it and use the ipopt default value for "constr_viol_tol" (1e-4). Otherwise, use min_tol as the value for
+        //   "constr_viol_tol".
+        if (prob.get_nc() && !m_numeric_opts.count("constr_viol_tol")) {
+            const auto c_tol = prob.get_c_tol();
+            assert(!c_tol.empty());
+            const double min_tol = *std::min_element(c_tol.begin(), c_tol.end());
+            if (min_tol > 0.) {
+                const auto tmp_p = std::make_pair(std::string("constr_viol_tol"), min_tol);
+                detail::ipopt_opt_checker(app->Options()->SetNumericValue(tmp_p.first, tmp_p.second), tmp_p,
+                                          "numeric");
+            }
         }
-    }
 
-    // Initialize the Ipopt machinery, following the tutorial.
-    Ipopt::SmartPtr<Ipopt::TNLP> nlp = ::new detail::ipopt_nlp(pop.get_problem(), initial_guess, m_verbosity);
-    // Store a reference to the derived class for later use.
-    auto &inlp = dynamic_cast<detail::ipopt_nlp &>(*nlp);
-    Ipopt::SmartPtr<Ipopt::IpoptApplication> app = ::IpoptApplicationFactory();
-    app->RethrowNonIpoptException(true);
-
-    // Logic for the handling of constraints tolerances. The logic is as follows:
-    // - if the user provides the "constr_viol_tol" option, use that *unconditionally*. Otherwise,
-    // - compute the minimum tolerance min_tol among those provided by the problem. If zero, ignore
-    //   it and use the ipopt default value for "constr_viol_tol" (1e-4). Otherwise, use min_tol as the value for
-    //   "constr_viol_tol".
-    if (prob.get_nc() && !m_numeric_opts.count("constr_viol_tol")) {
-        const auto c_tol = prob.get_c_tol();
-        assert(!c_tol.empty());
-        const double min_tol = *std::min_element(c_tol.begin(), c_tol.end());
-        if (min_tol > 0.) {
-            const auto tmp_p = std::make_pair(std::string("constr_viol_tol"), min_tol);
-            detail::ipopt_opt_checker(app->Options()->SetNumericValue(tmp_p.first, tmp_p.second), tmp_p, "numeric");
+        // Logic for the hessians computation:
+        // - if the problem does *not* provide the hessians, and the "hessian_approximation" is *not*
+        //   set, then we set it to "limited-memory".
+        // This way, problems without hessians will work out of the box.
+        if (!prob.has_hessians() && !m_string_opts.count("hessian_approximation")) {
+            const auto tmp_p = std::make_pair(std::string("hessian_approximation"), std::string("limited-memory"));
+            detail::ipopt_opt_checker(app->Options()->SetStringValue(tmp_p.first, tmp_p.second), tmp_p, "string");
         }
-    }
 
-    // Logic for the hessians computation:
-    // - if the problem does *not* provide the hessians, and the "hessian_approximation" is *not*
-    //   set, then we set it to "limited-memory".
-    // This way, problems without hessians will work out of the box.
-    if (!prob.has_hessians() && !m_string_opts.count("hessian_approximation")) {
-        const auto tmp_p = std::make_pair(std::string("hessian_approximation"), std::string("limited-memory"));
-        detail::ipopt_opt_checker(app->Options()->SetStringValue(tmp_p.first, tmp_p.second), tmp_p, "string");
-    }
+        // Logic for print_level: change the default to zero.
+        if (!m_integer_opts.count("print_level")) {
+            const auto tmp_p = std::make_pair(std::string("print_level"), Ipopt::Index(0));
+            detail::ipopt_opt_checker(app->Options()->SetIntegerValue(tmp_p.first, tmp_p.second), tmp_p, "integer");
+        }
 
-    // Logic for print_level: change the default to zero.
-    if (!m_integer_opts.count("print_level")) {
-        const auto tmp_p = std::make_pair(std::string("print_level"), Ipopt::Index(0));
-        detail::ipopt_opt_checker(app->Options()->SetIntegerValue(tmp_p.first, tmp_p.second), tmp_p, "integer");
-    }
+        // Set the other options.
+        for (const auto &p : m_string_opts) {
+            detail::ipopt_opt_checker(app->Options()->SetStringValue(p.first, p.second), p, "string");
+        }
+        for (const auto &p : m_numeric_opts) {
+            detail::ipopt_opt_checker(app->Options()->SetNumericValue(p.first, p.second), p, "numeric");
+        }
+        for (const auto &p : m_integer_opts) {
+            detail::ipopt_opt_checker(app->Options()->SetIntegerValue(p.first, p.second), p, "integer");
+        }
 
-    // Set the other options.
-    for (const auto &p : m_string_opts) {
-        detail::ipopt_opt_checker(app->Options()->SetStringValue(p.first, p.second), p, "string");
-    }
-    for (const auto &p : m_numeric_opts) {
-        detail::ipopt_opt_checker(app->Options()->SetNumericValue(p.first, p.second), p, "numeric");
-    }
-    for (const auto &p : m_integer_opts) {
-        detail::ipopt_opt_checker(app->Options()->SetIntegerValue(p.first, p.second), p, "integer");
-    }
+        // NOTE: Initialize() can take a filename as input, defaults to "ipopt.opt". This is a file
+        // which is supposed to contain ipopt's options. Since we can set the options from the code,
+        // let's disable this functionality by passing an empty string.
+        const Ipopt::ApplicationReturnStatus init_status = app->Initialize("");
+        if (init_status != Ipopt::Solve_Succeeded) {
+            // LCOV_EXCL_START
+            pagmo_throw(std::runtime_error,
+                        "the initialisation of the ipopt algorithm failed. The return status code is: "
+                            + detail::ipopt_results.at(init_status));
+            // LCOV_EXCL_STOP
+        }
+        // Run the optimisation.
+        status = app->OptimizeTNLP(nlp);
+
+        return nlp;
+    };
+
+    if (m_n_starts > 1u) {
+        // Multistart mode. We first pick the starting points and the individuals to be replaced,
+        // and we check all the initial guesses before starting any optimisation.
+        const auto sel = select_indices(pop, m_n_starts);
+        const auto rep = replace_indices(pop, m_n_starts);
+        const auto n_starts = sel.size();
+        std::vector<vector_double> xs(n_starts), old_fs(n_starts), new_fs(n_starts);
+        for (decltype(sel.size()) k = 0; k < n_starts; ++k) {
+            xs[k] = pop.get_x()[sel[k]];
+            old_fs[k] = pop.get_f()[sel[k]];
+            check_initial_guess(xs[k]);
+        }
 
-    // NOTE: Initialize() can take a filename as input, defaults to "ipopt.opt". This is a file
-    // which is supposed to contain ipopt's options. Since we can set the options from the code,
-    // let's disable this functionality by passing an empty string.
-    const Ipopt::ApplicationReturnStatus status = app->Initialize("");
-    if (status != Ipopt::Solve_Succeeded) {
-        // LCOV_EXCL_START
-        pagmo_throw(std::runtime_error, "the initialisation of the ipopt algorithm failed. The return status code is: "
-                                            + detail::ipopt_results.at(status));
-        // LCOV_EXCL_STOP
+        // Run the optimisations, with no logging.
+        // NOTE: Ipopt is not thread-safe, thus the optimisations are run one after the other.
+        std::vector<Ipopt::ApplicationReturnStatus> results(n_starts, Ipopt::Solve_Succeeded);
+        for (decltype(sel.size()) k = 0; k < n_starts; ++k) {
+            auto nlp = run_ipopt(xs[k], 0u, results[k]);
+            auto &inlp = dynamic_cast<detail::ipopt_nlp &>(*nlp);
+            if (inlp.m_eptr) {
+                std::rethrow_exception(inlp.m_eptr);
+            }
+            xs[k] = inlp.m_sol;
+            new_fs[k] = prob.fitness(xs[k]);
+        }
+
+        // The status of the optimisation which produced the best individual is recorded.
+        decltype(sel.size()) best = 0;
+        for (decltype(sel.size()) k = 1; k < n_starts; ++k) {
+            if (compare_fc(new_fs[k], new_fs[best], prob.get_nec(), prob.get_c_tol())) {
+                best = k;
+            }
+        }
+        m_last_opt_res = results[best];
+        m_log.clear();
+        if (m_verbosity) {
+            std::cout << "\nOptimisation return status (best of " << n_starts
+                      << " starts): " << detail::ipopt_results.at(m_last_opt_res) << '\n';
+        }
+
+        // Store the new individuals into the population, but only if better than their starting points.
+        for (decltype(sel.size()) k = 0; k < n_starts; ++k) {
+            if (compare_fc(new_fs[k], old_fs[k], prob.get_nec(), prob.get_c_tol())) {
+                pop.set_xf(rep[k], xs[k], new_fs[k]);
+            }
+        }
+
+        return pop;
     }
+
+    // Setup of the initial guess. Store also the original fitness
+    // of the selected individual, old_f, for later use.
+    auto sel_xf = select_individual(pop);
+    vector_double initial_guess(std::move(sel_xf.first)), old_f(std::move(sel_xf.second));
+    check_initial_guess(initial_guess);
+
     // Run the optimisation.
-    m_last_opt_res = app->OptimizeTNLP(nlp);
+    auto nlp = run_ipopt(initial_guess, m_verbosity, m_last_opt_res);
+    // Store a reference to the derived class for later use.
+    auto &inlp = dynamic_cast<detail::ipopt_nlp &>(*nlp);
     if (m_verbosity) {
         // Print to screen the result of the optimisation, if we are being verbose.
         std::cout << "\nOptimisation return status: " << detail::ipopt_results.at(m_last_opt_res) << '\n';
@@ -929,6 +995,27 @@ population ipopt::evolve(population pop) const
     return pop;
 }
 
+/// Set the number of starts.
+/**
+ * If \p n is greater than one, evolve() will select \p n individuals via the selection policy
+ * (see not_population_based::select_indices()) and run an independent optimisation from each of them.
+ * Since Ipopt is not thread-safe, the optimisations are run sequentially. Each optimised individual, if better
+ * than its starting point, replaces one of the \p n individuals picked by the replacement policy
+ * (see not_population_based::replace_indices()). In this mode no logging is performed, and
+ * get_last_opt_result() returns the status of the optimisation which produced the best individual.
+ *
+ * @param n the desired number of starts.
+ *
+ * @throws std::invalid_argument if \p n is zero.
+ */
+void ipopt::set_n_starts(unsigned n)
+{
+    if (!n) {
+        pagmo_throw(std::invalid_argument, "The number of starts must be at least 1");
+    }
+    m_n_starts = n;
+}
+
 /// Get extra information about the algorithm.
 /**
  * @return a human-readable string containing useful information about the algorithm's properties
@@ -937,7 +1024,8 @@ population ipopt::evolve(population pop) const
 std::string ipopt::get_extra_info() const
 {
     return "\tLast optimisation return code: " + detail::ipopt_results.at(m_last_opt_res)
-           + "\n\tVerbosity: " + std::to_string(m_verbosity) + "\n\tIndividual selection "
+           + "\n\tVerbosity: " + std::to_string(m_verbosity) + "\n\tStarts: " + std::to_string(m_n_starts)
+           + "\n\tIndividual selection "
            + (boost::any_cast<population::size_type>(&m_select)
                   ? "idx: " + std::to_string(boost::any_cast<population::size_type>(m_select))
                   : "policy: " + boost::any_cast<std::string>(m_select))
@@ -960,7 +1048,7 @@ template <typename Archive>
 void ipopt::save(Archive &ar, unsigned) const
 {
     detail::to_archive(ar, boost::serialization::base_object<not_population_based>(*this), m_string_opts,
-                       m_integer_opts, m_numeric_opts, m_last_opt_res, m_verbosity, m_log);
+                       m_integer_opts, m_numeric_opts, m_last_opt_res, m_verbosity, m_log, m_n_starts);
 }
 
 /// Load from archive.
@@ -977,7 +1065,7 @@ void ipopt::load(Archive &ar, unsigned)
 {
     try {
         detail::from_archive(ar, boost::serialization::base_object<not_population_based>(*this), m_string_opts,
-                             m_integer_opts, m_numeric_opts, m_last_opt_res, m_verbosity, m_log);
+                             m_integer_opts, m_numeric_opts, m_last_opt_res, m_verbosity, m_log, m_n_starts);
         // LCOV_EXCL_START
     } catch (...) {
         *this = ipopt{};
@@ -31,12 +31,32 @@ see https://www.gnu.org/licenses/. */
 #include <iomanip>
 #include <sstream>
 #include <stdexcept>
+#include <random>
 #include <string>
+#include <vector>
 
+#if defined(_MSC_VER)
+
+// Disable a warning from MSVC in the TBB code.
+#pragma warning(push)
+#pragma warning(disable : 4324)
+
+#endif
+
+#include <tbb/parallel_for.h>
+
+#if defined(_MSC_VER)
+
+#pragma warning(pop)
+
+#endif
+
+#include <pagmo/algorithm.hpp>
 #include <pagmo/algorithms/compass_search.hpp>
 #include <pagmo/algorithms/mbh.hpp>
 #include <pagmo/exceptions.hpp>
 #include <pagmo/io.hpp>
+#include <pagmo/population.hpp>
 #include <pagmo/rng.hpp>
 #include <pagmo/s11n.hpp>
 #include <pagmo/threading.hpp>
@@ -63,7 +83,7 @@ namespace pagmo
  *
  * @throws unspecified any exception thrown by the constructor of pagmo::algorithm.
  */
-mbh::mbh() : m_algorithm(compass_search{}), m_stop(5u), m_perturb(1, 1e-2), m_verbosity(0u)
+mbh::mbh() : m_algorithm(compass_search{}), m_stop(5u), m_perturb(1, 1e-2), m_verbosity(0u), m_n_trials(1u)
 {
     const auto rnd = pagmo::random_device::next();
     m_seed = rnd;
@@ -144,23 +164,76 @@ population mbh::evolve(population pop) const
 
     // No throws, all valid: we clear the logs
     m_log.clear();
+    // Perturbs x in a neighbourhood of size m_perturb, storing the result in tmp_x.
+    vector_double tmp_x(dim);
+    auto perturb = [&](const vector_double &x) {
+        for (decltype(dim) k = 0u; k < dim; ++k) {
+            tmp_x[k] = uniform_real_from_range(std::max(x[k] - m_perturb[k] * (ub[k] - lb[k]), lb[k]),
+                                               std::min(x[k] + m_perturb[k] * (ub[k] - lb[k]), ub[k]), m_e);
+        }
+    };
     // mbh main loop
     unsigned i = 0u;
     while (i < m_stop) {
         // 1 - We make a copy of the current population
         population pop_old(pop);
-        // 2 - We perturb the current population (NP funevals are made here)
-        for (decltype(NP) j = 0u; j < NP; ++j) {
-            vector_double tmp_x(dim);
-            for (decltype(dim) k = 0u; k < dim; ++k) {
-                tmp_x[k]
-                    = uniform_real_from_range(std::max(pop.get_x()[j][k] - m_perturb[k] * (ub[k] - lb[k]), lb[k]),
-                                              std::min(pop.get_x()[j][k] + m_perturb[k] * (ub[k] - lb[k]), ub[k]), m_e);
+        if (m_n_trials == 1u) {
+            // 2 - We perturb the current population (NP funevals are made here)
+            for (decltype(NP) j = 0u; j < NP; ++j) {
+                perturb(pop.get_x()[j]);
+                pop.set_x(j, tmp_x); // fitness is evaluated here
             }
-            pop.set_x(j, tmp_x); // fitness is evaluated here
+            // 3 - We evolve the current population with the selected algorithm
+            pop = m_algorithm.evolve(pop);
+        } else {
+            // 2 - We perturb m_n_trials copies of the current population. The perturbations
+            // and the seeds of the inner algorithms are drawn here, so that the outcome
+            // does not depend on the order in which the trials are run.
+            std::vector<population> trials(m_n_trials, pop);
+            std::vector<algorithm> algos(m_n_trials, m_algorithm);
+            std::vector<std::vector<vector_double>> trials_x(m_n_trials);
+            for (decltype(trials.size()) t = 0u; t < trials.size(); ++t) {
+                for (decltype(NP) j = 0u; j < NP; ++j) {
+                    perturb(pop.get_x()[j]);
+                    trials_x[t].push_back(tmp_x);
+                }
+                if (algos[t].has_set_seed()) {
+                    algos[t].set_seed(std::uniform_int_distribution<unsigned>()(m_e));
+                }
+            }
+            // 3 - We evaluate the perturbed populations and evolve them with the selected algorithm,
+            // in parallel if the inner algorithm and the problem allow for it.
+            auto run_trial = [&trials, &algos, &trials_x, NP](decltype(trials.size()) t) {
+                for (decltype(NP) j = 0u; j < NP; ++j) {
+                    trials[t].set_x(j, trials_x[t][j]); // fitness is evaluated here
+                }
+                trials[t] = algos[t].evolve(trials[t]);
+            };
+            if (m_algorithm.get_thread_safety() >= thread_safety::basic
+                && prob.get_thread_safety() >= thread_safety::basic) {
+                tbb::parallel_for(decltype(trials.size())(0), trials.size(), run_trial);
+            } else {
+                for (decltype(trials.size()) t = 0u; t < trials.size(); ++t) {
+                    run_trial(t);
+                }
+            }
+            // We keep the best trial, accounting for the fitness evaluations made by all the trials.
+            decltype(trials.size()) best_t = 0u;
+            unsigned long long trials_fevals = 0u;
+            for (decltype(trials.size()) t = 0u; t < trials.size(); ++t) {
+                trials_fevals += trials[t].get_problem().get_fevals() - pop.get_problem().get_fevals();
+                if (t > 0u
+                    && compare_fc(trials[t].get_f()[trials[t].best_idx()],
+                                  trials[best_t].get_f()[trials[best_t].best_idx()], nec, prob.get_c_tol())) {
+                    best_t = t;
+                }
+            }
+            trials_fevals -= trials[best_t].get_problem().get_fevals() - pop.get_problem().get_fevals();
+            pop = std::move(trials[best_t]);
+            // NOTE: the trials share the evaluation budget of the problem (if any),
+            // which has thus already been charged with their fitness evaluations.
+            detail::prob_merge_fevals(pop.get_problem(), trials_fevals);
         }
-        // 3 - We evolve the current population with the selected algorithm
-        pop = m_algorithm.evolve(pop);
         i++;
         // 4 - We reset the counter if we have improved, otherwise we reset the population
         if (compare_fc(pop.get_f()[pop.best_idx()], pop_old.get_f()[pop_old.best_idx()], nec, prob.get_c_tol())) {
@@ -227,6 +300,26 @@ void mbh::set_perturb(const vector_double &perturb)
     m_perturb = perturb;
 }
 
+/// Set the number of trials.
+/**
+ * If \p n_trials is greater than one, at each step evolve() perturbs \p n_trials copies of the
+ * current population and evolves each of them with a copy of the inner algorithm. The copies
+ * of the inner algorithm are re-seeded (if they provide a <tt>set_seed()</tt> method) and, if both
+ * the inner algorithm and the problem provide at least the basic thread safety level, the trials
+ * run in parallel. The best of the resulting populations then competes with the current one.
+ *
+ * @param n_trials the number of perturbation and evolution trials run at each step.
+ *
+ * @throws std::invalid_argument if \p n_trials is zero.
+ */
+void mbh::set_n_trials(unsigned n_trials)
+{
+    if (n_trials == 0u) {
+        pagmo_throw(std::invalid_argument, "The number of trials in MBH must be at least 1");
+    }
+    m_n_trials = n_trials;
+}
+
 /// Algorithm's thread safety level.
 /**
  * The thread safety of this meta-algorithm is the minimum between the thread safety
@@ -251,6 +344,7 @@ std::string mbh::get_extra_info() const
     stream(ss, "\n\tPerturbation vector: ", m_perturb);
     stream(ss, "\n\tSeed: ", m_seed);
     stream(ss, "\n\tVerbosity: ", m_verbosity);
+    stream(ss, "\n\tTrials: ", m_n_trials);
     stream(ss, "\n\n\tInner algorithm: ", m_algorithm.get_name());
     stream(ss, "\n\tInner algorithm extra info: ");
     stream(ss, "\n", m_algorithm.get_extra_info());
@@ -268,7 +362,7 @@ std::string mbh::get_extra_info() const
 template <typename Archive>
 void mbh::serialize(Archive &ar, unsigned)
 {
-    detail::archive(ar, m_algorithm, m_stop, m_perturb, m_e, m_seed, m_verbosity, m_log);
+    detail::archive(ar, m_algorithm, m_stop, m_perturb, m_e, m_seed, m_verbosity, m_log, m_n_trials);
 }
 
 } // namespace pagmo
@@ -38,6 +38,7 @@ see https://www.gnu.org/licenses/. */
 
 #include <pagmo/algorithm.hpp>
 #include <pagmo/algorithms/moead.hpp>
+#include <pagmo/bfe.hpp>
 #include <pagmo/exceptions.hpp>
 #include <pagmo/io.hpp>
 #include <pagmo/population.hpp>
@@ -47,6 +48,10 @@ see https://www.gnu.org/licenses/. */
 #include <pagmo/utils/genetic_operators.hpp>
 #include <pagmo/utils/multi_objective.hpp>
 
+// NOTE: apparently this must be included *after*
+// the other serialization headers.
+#include <boost/serialization/optional.hpp>
+
 namespace pagmo
 {
 
@@ -149,6 +154,7 @@ population moead::evolve(population pop) const
     // Generate NP weight vectors for the decomposed problems. Will throw if the population size is not compatible
     // with the weight generation scheme chosen
     auto weights = decomposition_weights(prob.get_nf(), NP, m_weight_generation, m_e);
+    const auto method = detail::decomposition_method_from_string(m_decomposition);
     // ---------------------------------------------------------------------------------------------------------
 
     // No throws, all valid: we clear the logs
@@ -161,13 +167,74 @@ population moead::evolve(population pop) const
         0u, NP - 1u); // to generate a random index for the population
                       // Declaring the candidate chromosome
     vector_double candidate(dim);
-    // We compute, for each vector of weights, the k = m_neighbours neighbours
-    auto neigh_idxs = kNN(weights, m_neighbours);
     // We compute the initial ideal point (will be adapted along the course of the algorithm)
     vector_double ideal_point = ideal(pop.get_f());
+    // We compute, for each vector of weights, the k = m_neighbours neighbours
+    auto neigh_idxs = kNN(weights, m_neighbours);
+    // We store the weights contiguously, one weight vector after the other
+    const auto nf = prob.get_nf();
+    vector_double W(NP * nf);
+    for (decltype(NP) i = 0u; i < NP; ++i) {
+        std::copy(weights[i].begin(), weights[i].end(), W.data() + i * nf);
+    }
+    // The decomposed fitness of the objectives f for the decomposed problem i
+    auto decomposed_f = [&W, &ideal_point, nf, method](const vector_double &f, population::size_type i) {
+        return detail::decompose_objectives_impl(f.data(), W.data() + i * nf, ideal_point.data(), nf, method);
+    };
     // We create the container that will represent a pseudo-random permutation of the population indexes 1..NP
     std::vector<population::size_type> shuffle(NP);
     std::iota(shuffle.begin(), shuffle.end(), std::vector<population::size_type>::size_type(0u));
+    // The container used to pick the neighbouring problems in a random order
+    std::vector<population::size_type> shuffle2;
+    shuffle2.reserve(NP);
+    // Whether the candidate generated for the problem shuffle[i] was bred from the whole population
+    std::vector<char> whole_population(NP);
+    // The candidates and their fitnesses in the batch-synchronous mode
+    vector_double candidates(m_bfe ? NP * dim : 0u), new_f(nf);
+
+    // Updates the ideal point with the fitness new_f of the candidate generated for the problem n, and
+    // inserts the candidate into the population in place of the solutions of n and of its
+    // neighbouring problems which it improves upon.
+    auto insert_candidate = [&](population::size_type n, bool whole, const vector_double &cand,
+                                const vector_double &cand_f) {
+        // 8 - We update the ideal point
+        for (decltype(ideal_point.size()) j = 0u; j < nf; ++j) {
+            ideal_point[j] = std::min(cand_f[j], ideal_point[j]);
+        }
+        // 9 - We insert the newly found solution into the population
+        decltype(NP) size, time = 0;
+        // First try on problem n
+        if (decomposed_f(cand_f, n) < decomposed_f(pop.get_f()[n], n)) {
+            pop.set_xf(n, cand, cand_f);
+            time++;
+        }
+        // Then, on neighbouring problems up to m_limit (to preserve diversity)
+        if (whole) {
+            size = NP;
+        } else {
+            size = neigh_idxs[n].size();
+        }
+        shuffle2.resize(size);
+        std::iota(shuffle2.begin(), shuffle2.end(), std::vector<population::size_type>::size_type(0u));
+        std::shuffle(shuffle2.begin(), shuffle2.end(), m_e);
+        for (decltype(size) k = 0u; k < size; ++k) {
+            population::size_type pick;
+            if (whole) {
+                pick = shuffle2[k];
+            } else {
+                pick = neigh_idxs[n][shuffle2[k]];
+            }
+            if (decomposed_f(cand_f, pick) < decomposed_f(pop.get_f()[pick], pick)) {
+                pop.set_xf(pick, cand, cand_f);
+                time++;
+            }
+            // the maximal number of solutions updated is not allowed to exceed 'limit' if diversity is to be
+            // preserved
+            if (time >= m_limit && m_preserve_diversity) {
+                break;
+            }
+        }
+    };
 
     // Main MOEA/D loop --------------------------------------------------------------------------------------------
     for (decltype(m_gen) gen = 1u; gen <= m_gen; ++gen) {
@@ -178,7 +245,7 @@ population moead::evolve(population pop) const
                 // We compute the average decomposed fitness (ADF)
                 auto adf = 0.;
                 for (decltype(pop.size()) i = 0u; i < pop.size(); ++i) {
-                    adf += decompose_objectives(pop.get_f()[i], weights[i], ideal_point, m_decomposition)[0];
+                    adf += decomposed_f(pop.get_f()[i], i);
                 }
                 // Every 50 lines print the column names
                 if (count % 50u == 1u) {
@@ -208,19 +275,18 @@ population moead::evolve(population pop) const
         // 1 - Shuffle the population indexes
         std::shuffle(shuffle.begin(), shuffle.end(), m_e);
         // 2 - Loop over the shuffled NP decomposed problems
-        for (auto n : shuffle) {
+        for (decltype(NP) i = 0u; i < NP; ++i) {
+            const auto n = shuffle[i];
             // 3 - if the diversity preservation mechanism is active we select at random whether to consider the
             // whole
             // population or just a neighbourhood to select two parents
-            bool whole_population;
             if (drng(m_e) < m_realb || !m_preserve_diversity) {
-                whole_population = false; // neighborhood
+                whole_population[i] = false; // neighborhood
             } else {
-                whole_population = true; // whole population
+                whole_population[i] = true; // whole population
             }
             // 4 - We select two parents in the neighbourhood
-            std::vector<population::size_type> parents_idx(2);
-            parents_idx = select_parents(n, neigh_idxs, whole_population);
+            const auto parents_idx = select_parents(n, neigh_idxs, whole_population[i]);
             // 5 - Crossover using the Differential Evolution operator (binomial crossover)
             for (decltype(dim) kk = 0u; kk < dim; ++kk) {
                 if (drng(m_e) < m_CR) {
@@ -240,50 +306,26 @@ population moead::evolve(population pop) const
             }
             // 6 - We apply a further mutation using polynomial mutation
             detail::polynomial_mutation_impl(candidate, bounds, 0u, 1.0 / static_cast<double>(dim), m_eta_m, m_e);
-            // 7- We evaluate the fitness function.
-            auto new_f = prob.fitness(candidate);
-            // 8 - We update the ideal point
-            for (decltype(prob.get_nf()) j = 0u; j < prob.get_nf(); ++j) {
-                ideal_point[j] = std::min(new_f[j], ideal_point[j]);
-            }
-            std::transform(ideal_point.begin(), ideal_point.end(), new_f.begin(), ideal_point.begin(),
-                           [](double a, double b) { return std::min(a, b); });
-            // 9 - We insert the newly found solution into the population
-            decltype(NP) size, time = 0;
-            // First try on problem n
-            auto f1 = decompose_objectives(pop.get_f()[n], weights[n], ideal_point, m_decomposition);
-            auto f2 = decompose_objectives(new_f, weights[n], ideal_point, m_decomposition);
-            if (f2[0] < f1[0]) {
-                pop.set_xf(n, candidate, new_f);
-                time++;
-            }
-            // Then, on neighbouring problems up to m_limit (to preserve diversity)
-            if (whole_population) {
-                size = NP;
+            if (m_bfe) {
+                // 7 - In the batch-synchronous mode, we just store the candidate: all candidates
+                // are generated from the population at the beginning of the generation, and they are
+                // evaluated and inserted below.
+                std::copy(candidate.begin(), candidate.end(), candidates.data() + i * dim);
             } else {
-                size = neigh_idxs[n].size();
+                // 7- We evaluate the fitness function.
+                const auto new_f = prob.fitness(candidate);
+                // 8 - 9 We update the ideal point and we insert the new solution into the population
+                insert_candidate(n, whole_population[i], candidate, new_f);
             }
-            std::vector<population::size_type> shuffle2(size);
-            std::iota(shuffle2.begin(), shuffle2.end(), std::vector<population::size_type>::size_type(0u));
-            std::shuffle(shuffle2.begin(), shuffle2.end(), m_e);
-            for (decltype(size) k = 0u; k < size; ++k) {
-                population::size_type pick;
-                if (whole_population) {
-                    pick = shuffle2[k];
-                } else {
-                    pick = neigh_idxs[n][shuffle2[k]];
-                }
-                f1 = decompose_objectives(pop.get_f()[pick], weights[pick], ideal_point, m_decomposition);
-                f2 = decompose_objectives(new_f, weights[pick], ideal_point, m_decomposition);
-                if (f2[0] < f1[0]) {
-                    pop.set_xf(pick, candidate, new_f);
-                    time++;
-                }
-                // the maximal number of solutions updated is not allowed to exceed 'limit' if diversity is to be
-                // preserved
-                if (time >= m_limit && m_preserve_diversity) {
-                    break;
-                }
+        }
+        if (m_bfe) {
+            // 7 - We evaluate all the candidates at once.
+            const auto fitnesses = (*m_bfe)(prob, candidates);
+            // 8 - 9 We update the ideal point and we insert the new solutions into the population
+            for (decltype(NP) i = 0u; i < NP; ++i) {
+                std::copy(candidates.data() + i * dim, candidates.data() + (i + 1u) * dim, candidate.begin());
+                std::copy(fitnesses.data() + i * nf, fitnesses.data() + (i + 1u) * nf, new_f.begin());
+                insert_candidate(shuffle[i], whole_population[i], candidate, new_f);
             }
         }
     }
@@ -300,6 +342,20 @@ void moead::set_seed(unsigned seed)
     m_seed = seed;
 }
 
+/// Sets the batch function evaluation scheme
+/**
+ * After a call to this method, evolve() will run a batch-synchronous variant of MOEA/D: at each
+ * generation, the candidates for all the decomposed problems are first generated from the current
+ * population, then they are evaluated with a single call to \p b and, finally, they are inserted
+ * into the population.
+ *
+ * @param b batch function evaluation object
+ */
+void moead::set_bfe(const bfe &b)
+{
+    m_bfe = b;
+}
+
 /// Extra info
 /**
  * One of the optional methods of any user-defined algorithm (UDA).
@@ -334,7 +390,7 @@ template <typename Archive>
 void moead::serialize(Archive &ar, unsigned)
 {
     detail::archive(ar, m_gen, m_weight_generation, m_decomposition, m_neighbours, m_CR, m_F, m_eta_m, m_realb, m_limit,
-                    m_preserve_diversity, m_e, m_seed, m_verbosity, m_log);
+                    m_preserve_diversity, m_e, m_seed, m_verbosity, m_log, m_bfe);
 }
 
 std::vector<population::size_type>
@@ -744,7 +744,7 @@ nlopt::nlopt(const nlopt &other)
       m_sc_stopval(other.m_sc_stopval), m_sc_ftol_rel(other.m_sc_ftol_rel), m_sc_ftol_abs(other.m_sc_ftol_abs),
       m_sc_xtol_rel(other.m_sc_xtol_rel), m_sc_xtol_abs(other.m_sc_xtol_abs), m_sc_maxeval(other.m_sc_maxeval),
       m_sc_maxtime(other.m_sc_maxtime), m_verbosity(other.m_verbosity), m_log(other.m_log),
-      m_loc_opt(other.m_loc_opt ? std::make_unique<nlopt>(*other.m_loc_opt) : nullptr)
+      m_n_starts(other.m_n_starts), m_loc_opt(other.m_loc_opt ? std::make_unique<nlopt>(*other.m_loc_opt) : nullptr)
 {
 }
 
@@ -756,7 +756,8 @@ nlopt::nlopt(const nlopt &other)
  * set_selection(population::size_type), set_replacement(const std::string &) and
  * set_replacement(population::size_type). The NLopt solver will run until one of the stopping criteria
  * is satisfied, and the return status of the NLopt solver will be recorded (it can be fetched with
- * get_last_opt_result()).
+ * get_last_opt_result()). If the number of starts is greater than one (see set_n_starts()),
+ * several individuals will be optimised and reinserted into \p pop.
  *
  * @param pop the population to be optimised.
  *
@@ -782,6 +783,84 @@ population nlopt::evolve(population pop) const
 
     auto &prob = pop.get_problem();
 
+    // Check an initial guess.
+    // NOTE: this should be guaranteed by the population's invariants.
+    const auto bounds = prob.get_bounds();
+    auto check_initial_guess = [&bounds](const vector_double &initial_guess) {
+        assert(initial_guess.size() == bounds.first.size());
+        for (decltype(bounds.first.size()) i = 0; i < bounds.first.size(); ++i) {
+            if (std::isnan(initial_guess[i])) {
+                pagmo_throw(std::invalid_argument,
+                            "the value of the initial guess at index " + std::to_string(i) + " is NaN");
+            }
+            if (initial_guess[i] < bounds.first[i] || initial_guess[i] > bounds.second[i]) {
+                pagmo_throw(std::invalid_argument, "the value of the initial guess at index " + std::to_string(i)
+                                                       + " is outside the problem's bounds");
+            }
+        }
+    };
+
+    if (m_n_starts > 1u) {
+        // Multistart mode. We first pick the starting points and the individuals to be replaced,
+        // and we store the original fitnesses of the starting points for later use.
+        const auto sel = select_indices(pop, m_n_starts);
+        const auto rep = replace_indices(pop, m_n_starts);
+        const auto n_starts = sel.size();
+        std::vector<vector_double> xs(n_starts), old_fs(n_starts), new_fs(n_starts);
+        std::vector<::nlopt_result> results(n_starts, NLOPT_SUCCESS);
+        for (decltype(sel.size()) k = 0; k < n_starts; ++k) {
+            xs[k] = pop.get_x()[sel[k]];
+            old_fs[k] = pop.get_f()[sel[k]];
+            check_initial_guess(xs[k]);
+        }
+
+        // Run the optimisations. Each one uses its own nlopt obj, with no screen output and no logging.
+        run_multistart(prob, n_starts, [&](problem &p, population::size_type k) {
+            detail::nlopt_obj no(detail::nlopt_names.left.at(m_algo), p, m_sc_stopval, m_sc_ftol_rel,
+                                 m_sc_ftol_abs, m_sc_xtol_rel, m_sc_xtol_abs, m_sc_maxeval, m_sc_maxtime, 0);
+            no.set_bounds();
+            no.set_objfun();
+            no.set_eq_constraints();
+            no.set_ineq_constraints();
+            if (m_loc_opt) {
+                detail::nlopt_obj no_loc(detail::nlopt_names.left.at(m_loc_opt->m_algo), p,
+                                         m_loc_opt->m_sc_stopval, m_loc_opt->m_sc_ftol_rel, m_loc_opt->m_sc_ftol_abs,
+                                         m_loc_opt->m_sc_xtol_rel, m_loc_opt->m_sc_xtol_abs,
+                                         m_loc_opt->m_sc_maxeval, m_loc_opt->m_sc_maxtime, 0);
+                ::nlopt_set_local_optimizer(no.m_value.get(), no_loc.m_value.get());
+            }
+            double objval;
+            results[k] = ::nlopt_optimize(no.m_value.get(), xs[k].data(), &objval);
+            if (no.m_eptr) {
+                std::rethrow_exception(no.m_eptr);
+            }
+            new_fs[k] = p.fitness(xs[k]);
+        });
+
+        // The status of the optimisation which produced the best individual is recorded.
+        decltype(sel.size()) best = 0;
+        for (decltype(sel.size()) k = 1; k < n_starts; ++k) {
+            if (compare_fc(new_fs[k], new_fs[best], prob.get_nec(), prob.get_c_tol())) {
+                best = k;
+            }
+        }
+        m_last_opt_result = results[best];
+        m_log.clear();
+        if (m_verbosity) {
+            std::cout << "\nOptimisation return status (best of " << n_starts
+                      << " starts): " << detail::nlopt_res2string(m_last_opt_result) << '\n';
+        }
+
+        // Store the new individuals into the population, but only if better than their starting points.
+        for (decltype(sel.size()) k = 0; k < n_starts; ++k) {
+            if (compare_fc(new_fs[k], old_fs[k], prob.get_nec(), prob.get_c_tol())) {
+                pop.set_xf(rep[k], xs[k], new_fs[k]);
+            }
+        }
+
+        return pop;
+    }
+
     // Create the nlopt obj.
     // NOTE: this will check also the problem's properties.
     detail::nlopt_obj no(detail::nlopt_names.left.at(m_algo), prob, m_sc_stopval, m_sc_ftol_rel, m_sc_ftol_abs,
@@ -805,19 +884,7 @@ population nlopt::evolve(population pop) const
     vector_double initial_guess(std::move(sel_xf.first)), old_f(std::move(sel_xf.second));
 
     // Check the initial guess.
-    // NOTE: this should be guaranteed by the population's invariants.
-    assert(initial_guess.size() == prob.get_nx());
-    const auto bounds = prob.get_bounds();
-    for (decltype(bounds.first.size()) i = 0; i < bounds.first.size(); ++i) {
-        if (std::isnan(initial_guess[i])) {
-            pagmo_throw(std::invalid_argument,
-                        "the value of the initial guess at index " + std::to_string(i) + " is NaN");
-        }
-        if (initial_guess[i] < bounds.first[i] || initial_guess[i] > bounds.second[i]) {
-            pagmo_throw(std::invalid_argument, "the value of the initial guess at index " + std::to_string(i)
-                                                   + " is outside the problem's bounds");
-        }
-    }
+    check_initial_guess(initial_guess);
 
     // Run the optimisation and store the status returned by NLopt.
     double objval;
@@ -867,7 +934,8 @@ std::string nlopt::get_extra_info() const
     auto retval = "\tNLopt version: " + std::to_string(major) + "." + std::to_string(minor) + "."
                   + std::to_string(bugfix) + "\n\tSolver: '" + m_algo
                   + "'\n\tLast optimisation return code: " + detail::nlopt_res2string(m_last_opt_result)
-                  + "\n\tVerbosity: " + std::to_string(m_verbosity) + "\n\tIndividual selection "
+                  + "\n\tVerbosity: " + std::to_string(m_verbosity) + "\n\tStarts: " + std::to_string(m_n_starts)
+                  + "\n\tIndividual selection "
                   + (boost::any_cast<population::size_type>(&m_select)
                          ? "idx: " + std::to_string(boost::any_cast<population::size_type>(m_select))
                          : "policy: " + boost::any_cast<std::string>(m_select))
@@ -968,6 +1036,28 @@ void nlopt::set_xtol_abs(double xtol_abs)
     m_sc_xtol_abs = xtol_abs;
 }
 
+/// Set the number of starts.
+/**
+ * If \p n is greater than one, evolve() will select \p n individuals via the selection policy
+ * (see not_population_based::select_indices()) and run an independent optimisation from each of them.
+ * The optimisations run concurrently if the problem provides at least the basic thread safety level
+ * (see not_population_based::run_multistart()). Each optimised individual, if better than its starting
+ * point, replaces one of the \p n individuals picked by the replacement policy
+ * (see not_population_based::replace_indices()). In this mode no logging is performed, and
+ * get_last_opt_result() returns the status of the optimisation which produced the best individual.
+ *
+ * @param n the desired number of starts.
+ *
+ * @throws std::invalid_argument if \p n is zero.
+ */
+void nlopt::set_n_starts(unsigned n)
+{
+    if (!n) {
+        pagmo_throw(std::invalid_argument, "The number of starts must be at least 1");
+    }
+    m_n_starts = n;
+}
+
 /// Set the local optimizer.
 /**
  * Some NLopt algorithms rely on other NLopt algorithms as local/subsidiary optimizers.
@@ -1015,7 +1105,7 @@ void nlopt::save(Archive &ar, unsigned) const
 {
     detail::to_archive(ar, boost::serialization::base_object<not_population_based>(*this), m_algo, m_last_opt_result,
                        m_sc_stopval, m_sc_ftol_rel, m_sc_ftol_abs, m_sc_xtol_rel, m_sc_xtol_abs, m_sc_maxeval,
-                       m_sc_maxtime, m_verbosity, m_log);
+                       m_sc_maxtime, m_verbosity, m_log, m_n_starts);
     if (m_loc_opt) {
         detail::to_archive(ar, true, *m_loc_opt);
     } else {
@@ -1038,7 +1128,7 @@ void nlopt::load(Archive &ar, unsigned)
     try {
         detail::from_archive(ar, boost::serialization::base_object<not_population_based>(*this), m_algo,
                              m_last_opt_result, m_sc_stopval, m_sc_ftol_rel, m_sc_ftol_abs, m_sc_xtol_rel,
-                             m_sc_xtol_abs, m_sc_maxeval, m_sc_maxtime, m_verbosity, m_log);
+                             m_sc_xtol_abs, m_sc_maxeval, m_sc_maxtime, m_verbosity, m_log, m_n_starts);
         bool with_local;
         ar >> with_local;
         if (with_local) {
@@ -26,19 +26,42 @@ You should have received copies of the GNU General Public License and the
 GNU Lesser General Public License along with the PaGMO library.  If not,
 see https://www.gnu.org/licenses/. */
 
+#include <algorithm>
 #include <cassert>
+#include <functional>
+#include <numeric>
 #include <random>
 #include <stdexcept>
 #include <string>
 #include <utility>
+#include <vector>
+
+#if defined(_MSC_VER)
+
+// Disable a warning from MSVC in the TBB code.
+#pragma warning(push)
+#pragma warning(disable : 4324)
+
+#endif
+
+#include <tbb/parallel_for.h>
+
+#if defined(_MSC_VER)
+
+#pragma warning(pop)
+
+#endif
 
 #include <boost/any.hpp>
 
 #include <pagmo/algorithms/not_population_based.hpp>
 #include <pagmo/exceptions.hpp>
 #include <pagmo/population.hpp>
+#include <pagmo/problem.hpp>
 #include <pagmo/rng.hpp>
+#include <pagmo/threading.hpp>
 #include <pagmo/types.hpp>
+#include <pagmo/utils/constrained.hpp>
 
 namespace pagmo
 {
@@ -51,7 +74,7 @@ namespace pagmo
  */
 not_population_based::not_population_based()
     : m_select(std::string("best")), m_replace(std::string("best")), m_rselect_seed(random_device::next()),
-      m_e(static_cast<std::mt19937::result_type>(m_rselect_seed))
+      m_e(static_cast<detail::random_engine_type::result_type>(m_rselect_seed))
 {
 }
 
@@ -63,7 +86,7 @@ not_population_based::not_population_based()
 void not_population_based::set_random_sr_seed(unsigned seed)
 {
     m_rselect_seed = seed;
-    m_e.seed(static_cast<std::mt19937::result_type>(m_rselect_seed));
+    m_e.seed(static_cast<detail::random_engine_type::result_type>(m_rselect_seed));
 }
 
 /// Set the individual selection policy.
@@ -253,4 +276,152 @@ void not_population_based::replace_individual(population &pop, const vector_doub
     }
 }
 
+namespace detail
+{
+
+namespace
+{
+
+// Implementation of not_population_based::select_indices() and not_population_based::replace_indices():
+// pick the indices of n individuals in pop according to the policy (or index) stored in p.
+// name is used in the error messages.
+std::vector<population::size_type> nbp_policy_indices(const population &pop, population::size_type n,
+                                                      const boost::any &p, random_engine_type &e,
+                                                      const std::string &name)
+{
+    n = std::min(n, pop.size());
+    if (boost::any_cast<std::string>(&p)) {
+        const auto &s_p = boost::any_cast<const std::string &>(p);
+        if (s_p == "random") {
+            // n distinct random indices, via a partial Durstenfeld shuffle.
+            std::vector<population::size_type> idxs(pop.size());
+            std::iota(idxs.begin(), idxs.end(), population::size_type(0));
+            for (population::size_type i = 0; i < n; ++i) {
+                std::uniform_int_distribution<population::size_type> dist(i, pop.size() - 1u);
+                std::swap(idxs[i], idxs[dist(e)]);
+            }
+            idxs.resize(n);
+            return idxs;
+        }
+        assert(s_p == "best" || s_p == "worst");
+        const auto &prob = pop.get_problem();
+        if (prob.get_nobj() > 1u) {
+            pagmo_throw(std::invalid_argument,
+                        "The best and worst individuals can only be extracted in single objective problems");
+        }
+        if (s_p == "best") {
+            return select_best_N_con(pop.get_f(), n, prob.get_nec(), prob.get_c_tol());
+        }
+        auto idxs = sort_population_con(pop.get_f(), prob.get_nec(), prob.get_c_tol());
+        std::reverse(idxs.begin(), idxs.end());
+        idxs.resize(n);
+        return idxs;
+    }
+    const auto idx = boost::any_cast<population::size_type>(p);
+    if (n > 1u) {
+        pagmo_throw(std::invalid_argument, "cannot " + name + " " + std::to_string(n)
+                                               + " individuals when an index is used as " + name + " policy");
+    }
+    if (idx >= pop.size()) {
+        pagmo_throw(std::invalid_argument, "cannot " + name + " the individual at index " + std::to_string(idx)
+                                               + ": the population has a size of only "
+                                               + std::to_string(pop.size()));
+    }
+    return std::vector<population::size_type>(n, idx);
+}
+
+} // namespace
+
+} // namespace detail
+
+/// Select the indices of several individuals.
+/**
+ * This method will select up to \p n distinct individuals from the input population \p pop, returning
+ * their indices. The selection is done according to the currently active selection policy:
+ * - if not_population_based::m_select is <tt>"best"</tt>, then the indices of the \p n best individuals
+ *   are returned, from the best to the worst,
+ * - if not_population_based::m_select is <tt>"worst"</tt>, then the indices of the \p n worst individuals
+ *   are returned, from the worst to the best,
+ * - if not_population_based::m_select is <tt>"random"</tt>, then the indices of \p n randomly-selected
+ *   individuals are returned,
+ * - if not_population_based::m_select is an index, then \p n must not be greater than one, and the
+ *   index is returned.
+ *
+ * If \p n is greater than the size of \p pop, all the individuals in \p pop will be selected.
+ *
+ * @param pop the input population.
+ * @param n the number of individuals to be selected.
+ *
+ * @return the indices of the selected individuals.
+ *
+ * @throws std::invalid_argument if not_population_based::m_select is an index and either \p n is greater than one
+ * or the index is not smaller than the size of \p pop, or if not_population_based::m_select is <tt>"best"</tt> or
+ * <tt>"worst"</tt> and the problem is multi-objective.
+ * @throws unspecified any exception thrown by pagmo::select_best_N_con() or pagmo::sort_population_con().
+ */
+std::vector<population::size_type> not_population_based::select_indices(const population &pop,
+                                                                        population::size_type n) const
+{
+    return detail::nbp_policy_indices(pop, n, m_select, m_e, "select");
+}
+
+/// Select the indices of several individuals to be replaced.
+/**
+ * This method works like select_indices(), but it uses the currently active replacement policy
+ * (not_population_based::m_replace) in place of the selection policy.
+ *
+ * @param pop the input population.
+ * @param n the number of individuals to be replaced.
+ *
+ * @return the indices of the individuals to be replaced.
+ *
+ * @throws unspecified any exception thrown by select_indices().
+ */
+std::vector<population::size_type> not_population_based::replace_indices(const population &pop,
+                                                                         population::size_type n) const
+{
+    return detail::nbp_policy_indices(pop, n, m_replace, m_e, "replace");
+}
+
+/// Run several independent optimisations, concurrently if possible.
+/**
+ * This method will invoke \p f once for each index in the <tt>[0, n)</tt> range, passing
+ * as first argument a problem on which the optimisation identified by the index can be
+ * performed. The invocations run concurrently if the thread safety level of \p prob allows it:
+ * - if \p prob provides the thread_safety::constant level, \p f is always passed \p prob itself,
+ * - if \p prob provides the thread_safety::basic level, \p f is passed a copy of \p prob, and
+ *   the fitness, gradient and hessians evaluations made on the copies are added to the counters of
+ *   \p prob at the end,
+ * - otherwise, the invocations are serial and \p f is always passed \p prob itself.
+ *
+ * @param prob the problem to be optimised.
+ * @param n the number of optimisations.
+ * @param f the function performing a single optimisation.
+ *
+ * @throws unspecified any exception thrown by \p f, by the copy of \p prob or by the TBB library.
+ */
+void not_population_based::run_multistart(problem &prob, population::size_type n,
+                                          const std::function<void(problem &, population::size_type)> &f) const
+{
+    const auto ts = prob.get_thread_safety();
+    if (n > 1u && ts >= thread_safety::constant) {
+        tbb::parallel_for(population::size_type(0), n, [&prob, &f](population::size_type i) { f(prob, i); });
+    } else if (n > 1u && ts == thread_safety::basic) {
+        const auto fevals0 = prob.get_fevals(), gevals0 = prob.get_gevals(), hevals0 = prob.get_hevals();
+        std::vector<problem> probs(n, prob);
+        tbb::parallel_for(population::size_type(0), n, [&probs, &f](population::size_type i) { f(probs[i], i); });
+        for (const auto &p : probs) {
+            // NOTE: the copies share the evaluation budget of prob (if any),
+            // which has thus already been charged with their fitness evaluations.
+            detail::prob_merge_fevals(prob, p.get_fevals() - fevals0);
+            prob.increment_gevals(p.get_gevals() - gevals0);
+            prob.increment_hevals(p.get_hevals() - hevals0);
+        }
+    } else {
+        for (population::size_type i = 0; i < n; ++i) {
+            f(prob, i);
+        }
+    }
+}
+
 } // namespace pagmo
@@ -41,6 +41,7 @@ see https://www.gnu.org/licenses/. */
 
 #include <pagmo/algorithm.hpp>
 #include <pagmo/algorithms/nsga2.hpp>
+#include <pagmo/async_evaluator.hpp>
 #include <pagmo/exceptions.hpp>
 #include <pagmo/io.hpp>
 #include <pagmo/population.hpp>
@@ -58,7 +59,8 @@ namespace pagmo
 {
 
 nsga2::nsga2(unsigned gen, double cr, double eta_c, double m, double eta_m, unsigned seed)
-    : m_gen(gen), m_cr(cr), m_eta_c(eta_c), m_m(m), m_eta_m(eta_m), m_e(seed), m_seed(seed), m_verbosity(0u)
+    : m_gen(gen), m_cr(cr), m_eta_c(eta_c), m_m(m), m_eta_m(eta_m), m_e(seed), m_seed(seed), m_verbosity(0u),
+      m_async_n_workers(0u)
 {
     if (cr >= 1. || cr < 0.) {
         pagmo_throw(std::invalid_argument, "The crossover probability must be in the [0,1[ range, while a value of "
@@ -139,9 +141,8 @@ population nsga2::evolve(population pop) const
     std::iota(shuffle1.begin(), shuffle1.end(), vector_double::size_type(0));
     std::iota(shuffle2.begin(), shuffle2.end(), vector_double::size_type(0));
 
-    // Main NSGA-II loop
-    for (decltype(m_gen) gen = 1u; gen <= m_gen; gen++) {
-        // 0 - Logs and prints (verbosity modes > 1: a line is added every m_verbosity generations)
+    // Logs and prints (verbosity modes > 1: a line is added every m_verbosity generations).
+    auto log_generation = [&](unsigned gen) {
         if (m_verbosity > 0u) {
             // Every m_verbosity generations print a log line
             if (gen % m_verbosity == 1u || m_verbosity == 1u) {
@@ -172,19 +173,15 @@ population nsga2::evolve(population pop) const
                 m_log.emplace_back(gen, prob.get_fevals() - fevals0, ideal_point);
             }
         }
+    };
 
-        // At each generation we make a copy of the population into popnew
-        population popnew(pop);
-
-        // We create some pseudo-random permutation of the poulation indexes
-        std::shuffle(shuffle1.begin(), shuffle1.end(), m_e);
-        std::shuffle(shuffle2.begin(), shuffle2.end(), m_e);
-
-        // 1 - We compute crowding distance and non dominated rank for the current population
+    // Non dominated ranks and crowding distances of the current population.
+    std::vector<vector_double::size_type> ndr(NP);
+    vector_double pop_cd(NP);
+    auto rank_population = [&]() {
         auto fnds_res = fast_non_dominated_sorting(pop.get_f());
         auto ndf = std::get<0>(fnds_res); // non dominated fronts [[0,3,2],[1,5,6],[4],...]
-        vector_double pop_cd(NP);         // crowding distances of the whole population
-        auto ndr = std::get<3>(fnds_res); // non domination rank [0,1,0,0,2,1,1, ... ]
+        ndr = std::get<3>(fnds_res);      // non domination rank [0,1,0,0,2,1,1, ... ]
         for (const auto &front_idxs : ndf) {
             if (front_idxs.size() == 1u) { // handles the case where the front has collapsed to one point
                 pop_cd[front_idxs[0]] = std::numeric_limits<double>::infinity();
@@ -204,6 +201,82 @@ population nsga2::evolve(population pop) const
                 }
             }
         }
+    };
+
+    if (m_async) {
+        // Steady-state NSGA-II: up to get_n_workers() offspring are kept under evaluation at all times. As soon as
+        // the fitness of an offspring becomes available, the offspring competes for survival with the current
+        // population according to the crowded comparison operator, and a new offspring is created from the
+        // updated population. A generation here corresponds to NP evaluations.
+        async_evaluator ev(prob, *m_async, m_async_n_workers);
+        const auto n_evals = static_cast<unsigned long long>(m_gen) * NP;
+        unsigned long long n_submitted = 0, n_completed = 0;
+        std::uniform_int_distribution<vector_double::size_type> idx_dist(0u, NP - 1u);
+        // Offspring created but not yet submitted for evaluation (the crossover
+        // creates the offspring in pairs).
+        std::vector<vector_double> offspring;
+        auto submit_offspring = [&]() {
+            if (offspring.empty()) {
+                parent1_idx = detail::mo_tournament_selection_impl(idx_dist(m_e), idx_dist(m_e), ndr, pop_cd, m_e);
+                parent2_idx = detail::mo_tournament_selection_impl(idx_dist(m_e), idx_dist(m_e), ndr, pop_cd, m_e);
+                children = detail::sbx_crossover_impl(pop.get_x()[parent1_idx], pop.get_x()[parent2_idx], bounds, dim_i,
+                                                      m_cr, m_eta_c, m_e);
+                detail::polynomial_mutation_impl(children.first, bounds, dim_i, m_m, m_eta_m, m_e);
+                detail::polynomial_mutation_impl(children.second, bounds, dim_i, m_m, m_eta_m, m_e);
+                offspring.push_back(std::move(children.second));
+                offspring.push_back(std::move(children.first));
+            }
+            ev.submit(offspring.back());
+            offspring.pop_back();
+            ++n_submitted;
+        };
+
+        log_generation(1u);
+        rank_population();
+        while (n_submitted < n_evals && ev.get_n_pending() < ev.get_n_workers()) {
+            submit_offspring();
+        }
+        std::vector<bool> survives(NP + 1u);
+        while (n_completed < n_evals) {
+            auto res = ev.wait();
+            ++n_completed;
+            // The offspring (at index NP) competes with the whole population.
+            auto fits = pop.get_f();
+            fits.push_back(std::get<2>(res));
+            best_idx = select_best_N_mo(fits, NP);
+            std::fill(survives.begin(), survives.end(), false);
+            for (auto idx : best_idx) {
+                survives[idx] = true;
+            }
+            const auto discarded = static_cast<population::size_type>(
+                std::find(survives.begin(), survives.end(), false) - survives.begin());
+            if (discarded != NP) {
+                pop.set_xf(discarded, std::get<1>(res), std::get<2>(res));
+                rank_population();
+            }
+            if (n_completed % NP == 0u && n_completed < n_evals) {
+                log_generation(static_cast<unsigned>(n_completed / NP) + 1u);
+            }
+            if (n_submitted < n_evals) {
+                submit_offspring();
+            }
+        }
+        return pop;
+    }
+
+    // Main NSGA-II loop
+    for (decltype(m_gen) gen = 1u; gen <= m_gen; gen++) {
+        log_generation(gen);
+
+        // At each generation we make a copy of the population into popnew
+        population popnew(pop);
+
+        // We create some pseudo-random permutation of the poulation indexes
+        std::shuffle(shuffle1.begin(), shuffle1.end(), m_e);
+        std::shuffle(shuffle2.begin(), shuffle2.end(), m_e);
+
+        // 1 - We compute crowding distance and non dominated rank for the current population
+        rank_population();
 
         // 3 - We then loop thorugh all individuals with increment 4 to select two pairs of parents that will
         // each create 2 new offspring
@@ -325,6 +398,21 @@ void nsga2::set_bfe(const bfe &b)
     m_bfe = b;
 }
 
+/// Sets the asynchronous evaluation mode
+/**
+ * After a call to this method, evolve() will run a steady-state variant of NSGA-II in which
+ * the offspring are evaluated asynchronously by a pagmo::async_evaluator. The bfe, if set,
+ * is not used in this mode.
+ *
+ * @param backend the backend of the asynchronous evaluator.
+ * @param n_workers the number of concurrent evaluations (if zero, the number of hardware threads will be used).
+ */
+void nsga2::set_async(async_backend backend, unsigned n_workers)
+{
+    m_async = backend;
+    m_async_n_workers = n_workers;
+}
+
 /// Extra info
 /**
  * Returns extra information on the algorithm.
@@ -341,6 +429,9 @@ std::string nsga2::get_extra_info() const
     stream(ss, "\n\tDistribution index for mutation: ", m_eta_m);
     stream(ss, "\n\tSeed: ", m_seed);
     stream(ss, "\n\tVerbosity: ", m_verbosity);
+    if (m_async) {
+        stream(ss, "\n\tAsynchronous evaluation: ", *m_async, " (", m_async_n_workers, " workers)");
+    }
     return ss.str();
 }
 
@@ -355,7 +446,8 @@ std::string nsga2::get_extra_info() const
 template <typename Archive>
 void nsga2::serialize(Archive &ar, unsigned)
 {
-    detail::archive(ar, m_gen, m_cr, m_eta_c, m_m, m_eta_m, m_e, m_seed, m_verbosity, m_log, m_bfe);
+    detail::archive(ar, m_gen, m_cr, m_eta_c, m_m, m_eta_m, m_e, m_seed, m_verbosity, m_log, m_bfe, m_async,
+                    m_async_n_workers);
 }
 
 } // namespace pagmo
@@ -46,6 +46,8 @@ see https://www.gnu.org/licenses/. */
 #include <pagmo/types.hpp>
 #include <pagmo/utils/generic.hpp>
 
+#include "../detail/pso_swarm.hpp"
+
 namespace pagmo
 {
 
@@ -146,30 +148,30 @@ population pso::evolve(population pop) const
     m_log.clear();
 
     auto swarm_size = pop.size();
-    // Some vectors used are allocated here.
-    vector_double dummy(dim, 0.); // used for initialisation purposes
-
-    std::vector<vector_double> X(swarm_size, dummy); // particles' current positions
-    std::vector<vector_double> fit(swarm_size);      // particles' current fitness values
+    // The state of the swarm is stored in row-major matrices, one row per particle.
+    vector_double X(swarm_size * dim); // particles' current positions
+    vector_double fit(swarm_size);     // particles' current fitness values
 
-    std::vector<vector_double> lbX(swarm_size, dummy); // particles' previous best positions
-    std::vector<vector_double> lbfit(swarm_size);      // particles' fitness values at their previous best positions
+    vector_double lbX(swarm_size * dim); // particles' previous best positions
+    vector_double lbfit(swarm_size);     // particles' fitness values at their previous best positions
 
     // swarm topology (iterators over indexes of each particle's neighbors in the swarm)
     std::vector<std::vector<decltype(swarm_size)>> neighb(swarm_size);
-    // search space position of particles' best neighbor
+    // search space position of the best particle in the swarm (tracked only when using topology 1)
     vector_double best_neighb(dim, 0.);
     // fitness at the best found search space position (tracked only when using topologies 1 or 4)
-    vector_double best_fit;
+    double best_fit = 0.;
     // flag indicating whether the best solution's fitness improved (tracked only when using topologies 1 or 4)
     bool best_fit_improved;
 
     vector_double minv(dim), maxv(dim); // Maximum and minimum velocity allowed
 
     double vwidth; // Temporary variable
-    double new_x;  // Temporary variable
 
-    std::uniform_real_distribution<double> drng(0., 1.); // to generate a number in [0, 1)
+    // Random coefficients of the velocity update of a particle, and
+    // work buffers.
+    vector_double r1(dim), r2(dim), r_fips, sum_forces(dim);
+    vector_double xp(dim), fp(1u);
 
     // Initialise the minimum and maximum velocity
     for (decltype(dim) i = 0u; i < dim; ++i) {
@@ -180,19 +182,19 @@ population pso::evolve(population pop) const
 
     // Copy the particle positions and their fitness
     for (decltype(swarm_size) i = 0u; i < swarm_size; ++i) {
-        X[i] = pop.get_x()[i];
-        lbX[i] = pop.get_x()[i];
+        std::copy(pop.get_x()[i].begin(), pop.get_x()[i].end(), X.data() + i * dim);
+        std::copy(pop.get_x()[i].begin(), pop.get_x()[i].end(), lbX.data() + i * dim);
 
-        fit[i] = pop.get_f()[i];
-        lbfit[i] = pop.get_f()[i];
+        fit[i] = pop.get_f()[i][0];
+        lbfit[i] = pop.get_f()[i][0];
     }
 
     // Initialize the particle velocities if necessary
-    if ((m_V.size() != swarm_size) || (!m_memory)) {
-        m_V = std::vector<vector_double>(swarm_size, dummy);
+    if ((m_V.size() != swarm_size * dim) || (!m_memory)) {
+        m_V.resize(swarm_size * dim);
         for (decltype(swarm_size) i = 0u; i < swarm_size; ++i) {
             for (decltype(dim) j = 0u; j < dim; ++j) {
-                m_V[i][j] = uniform_real_from_range(minv[j], maxv[j], m_e);
+                m_V[i * dim + j] = uniform_real_from_range(minv[j], maxv[j], m_e);
             }
         }
     }
@@ -208,7 +210,7 @@ population pso::evolve(population pop) const
         case 4:
             initialize_topology__adaptive_random(neighb);
             // need to track improvements in best found fitness, to know when to rewire
-            best_fit = pop.get_f()[pop.best_idx()];
+            best_fit = pop.get_f()[pop.best_idx()][0];
             break;
         case 2:
         default:
@@ -216,10 +218,6 @@ population pso::evolve(population pop) const
     }
     // auxiliary variables specific to the Fully Informed Particle Swarm variant
     double acceleration_coefficient = m_eta1 + m_eta2;
-    double sum_forces;
-
-    double r1 = 0.;
-    double r2 = 0.;
 
     /* --- Main PSO loop ---
      */
@@ -228,144 +226,73 @@ population pso::evolve(population pop) const
         best_fit_improved = false;
         // For each particle in the swarm
         for (decltype(swarm_size) p = 0u; p < swarm_size; ++p) {
-
-            // identify the current particle's best neighbour
-            // . not needed if m_neighb_type == 1 (gbest): best_neighb directly tracked in this function
-            // . not needed if m_variant == 6 (FIPS): all neighbours are considered, no need to identify the best
-            // one
-            if (m_neighb_type != 1u && m_variant != 6u)
-                best_neighb = particle__get_best_neighbor(p, neighb, lbX, lbfit);
-
-            /*-------PSO canonical (with inertia weight) ---------------------------------------------*/
-            /*-------Original algorithm used in the first PaGMO paper (~2007) ------------------------*/
-            if (m_variant == 1u) {
-                for (decltype(dim) d = 0u; d < dim; ++d) {
-                    r1 = drng(m_e);
-                    r2 = drng(m_e);
-                    m_V[p][d] = m_omega * m_V[p][d] + m_eta1 * r1 * (lbX[p][d] - X[p][d])
-                                + m_eta2 * r2 * (best_neighb[d] - X[p][d]);
-                }
-            }
-
-            /*-------PSO canonical (with inertia weight) ---------------------------------------------*/
-            /*-------and with equal random weights of social and cognitive components-----------------*/
-            /*-------Check with Rastrigin-------------------------------------------------------------*/
-            else if (m_variant == 2u) {
-                for (decltype(dim) d = 0u; d < dim; ++d) {
-                    r1 = drng(m_e);
-                    m_V[p][d] = m_omega * m_V[p][d] + m_eta1 * r1 * (lbX[p][d] - X[p][d])
-                                + m_eta2 * r1 * (best_neighb[d] - X[p][d]);
-                }
-            }
-
-            /*-------PSO variant (commonly mistaken in literature for the canonical)----------------*/
-            /*-------Same random number for all components------------------------------------------*/
-            else if (m_variant == 3u) {
-                r1 = drng(m_e);
-                r2 = drng(m_e);
-                for (decltype(dim) d = 0u; d < dim; ++d) {
-                    m_V[p][d] = m_omega * m_V[p][d] + m_eta1 * r1 * (lbX[p][d] - X[p][d])
-                                + m_eta2 * r2 * (best_neighb[d] - X[p][d]);
-                }
-            }
-
-            /*-------PSO variant (commonly mistaken in literature for the canonical)----------------*/
-            /*-------Same random number for all components------------------------------------------*/
-            /*-------and with equal random weights of social and cognitive components---------------*/
-            else if (m_variant == 4u) {
-                r1 = drng(m_e);
-                for (decltype(dim) d = 0u; d < dim; ++d) {
-                    m_V[p][d] = m_omega * m_V[p][d] + m_eta1 * r1 * (lbX[p][d] - X[p][d])
-                                + m_eta2 * r1 * (best_neighb[d] - X[p][d]);
-                }
-            }
-
-            /*-------PSO variant with constriction coefficients------------------------------------*/
-            /*  ''Clerc's analysis of the iterative system led him to propose a strategy for the
-             *  placement of "constriction coefficients" on the terms of the formulas; these
-             *  coefficients controlled the convergence of the particle and allowed an elegant and
-             *  well-explained method for preventing explosion, ensuring convergence, and
-             *  eliminating the arbitrary Vmax parameter. The analysis also takes the guesswork
-             *  out of setting the values of phi_1 and phi_2.''
-             *  ''this is the canonical particle swarm algorithm of today.''
-             *  [Poli et al., 2007] http://dx.doi.org/10.1007/s11721-007-0002-0
-             *  [Clerc and Kennedy, 2002] http://dx.doi.org/10.1109/4235.985692
-             *
-             *  This being the canonical PSO of today, this variant is set as the default in PaGMO.
-             *-------------------------------------------------------------------------------------*/
-            else if (m_variant == 5u) {
-                for (decltype(dim) d = 0u; d < dim; ++d) {
-                    r1 = drng(m_e);
-                    r2 = drng(m_e);
-                    m_V[p][d] = m_omega
-                                * (m_V[p][d] + m_eta1 * r1 * (lbX[p][d] - X[p][d])
-                                   + m_eta2 * r2 * (best_neighb[d] - X[p][d]));
-                }
-            }
-
-            /*-------Fully Informed Particle Swarm-------------------------------------------------*/
-            /*  ''Whereas in the traditional algorithm each particle is affected by its own
-             *  previous performance and the single best success found in its neighborhood, in
-             *  Mendes' fully informed particle swarm (FIPS), the particle is affected by all its
-             *  neighbors, sometimes with no influence from its own previous success.''
-             *  ''With good parameters, FIPS appears to find better solutions in fewer iterations
-             *  than the canonical algorithm, but it is much more dependent on the population topology.''
-             *  [Poli et al., 2007] http://dx.doi.org/10.1007/s11721-007-0002-0
-             *  [Mendes et al., 2004] http://dx.doi.org/10.1109/TEVC.2004.826074
-             *-------------------------------------------------------------------------------------*/
-            else if (m_variant == 6u) {
-                for (decltype(dim) d = 0u; d < dim; ++d) {
-                    sum_forces = 0.;
-                    for (decltype(neighb[p].size()) n = 0u; n < neighb[p].size(); ++n) {
-                        sum_forces += drng(m_e) * acceleration_coefficient * (lbX[neighb[p][n]][d] - X[p][d]);
-                    }
-                    m_V[p][d] = m_omega * (m_V[p][d] + sum_forces / static_cast<double>(neighb[p].size()));
-                }
+            const auto Vp = m_V.data() + p * dim;
+            const auto Xp = X.data() + p * dim;
+            const auto lbXp = lbX.data() + p * dim;
+
+            if (m_variant == 6u) {
+                /*-------Fully Informed Particle Swarm-------------------------------------------------*/
+                /*  ''Whereas in the traditional algorithm each particle is affected by its own
+                 *  previous performance and the single best success found in its neighborhood, in
+                 *  Mendes' fully informed particle swarm (FIPS), the particle is affected by all its
+                 *  neighbors, sometimes with no influence from its own previous success.''
+                 *  ''With good parameters, FIPS appears to find better solutions in fewer iterations
+                 *  than the canonical algorithm, but it is much more dependent on the population topology.''
+                 *  [Poli et al., 2007] http://dx.doi.org/10.1007/s11721-007-0002-0
+                 *  [Mendes et al., 2004] http://dx.doi.org/10.1109/TEVC.2004.826074
+                 *-------------------------------------------------------------------------------------*/
+                // NOTE: all neighbours are considered, no need to identify the best one.
+                detail::pso_draw_fips_coefficients(dim, neighb[p].size(), r_fips, m_e);
+                detail::pso_update_velocity_fips(m_omega, acceleration_coefficient, Vp, Xp, lbX, neighb[p],
+                                                 r_fips.data(), sum_forces.data(), dim);
+            } else {
+                // identify the current particle's best neighbour
+                // . not needed if m_neighb_type == 1 (gbest): best_neighb directly tracked in this function
+                const auto gp = (m_neighb_type == 1u)
+                                    ? best_neighb.data()
+                                    : lbX.data() + particle__get_best_neighbor(p, neighb, lbfit) * dim;
+
+                /*-------Variants 1 and 2: PSO canonical (with inertia weight), with different (1)
+                 *       or equal (2) random weights of social and cognitive components.
+                 *       Variant 1 is the original algorithm used in the first PaGMO paper (~2007).
+                 *-------Variants 3 and 4: PSO variant (commonly mistaken in literature for the canonical)
+                 *       with the same random number for all components, with different (3) or equal (4)
+                 *       random weights of social and cognitive components.
+                 *-------Variant 5: PSO variant with constriction coefficients----------------------------*/
+                /*  ''Clerc's analysis of the iterative system led him to propose a strategy for the
+                 *  placement of "constriction coefficients" on the terms of the formulas; these
+                 *  coefficients controlled the convergence of the particle and allowed an elegant and
+                 *  well-explained method for preventing explosion, ensuring convergence, and
+                 *  eliminating the arbitrary Vmax parameter. The analysis also takes the guesswork
+                 *  out of setting the values of phi_1 and phi_2.''
+                 *  ''this is the canonical particle swarm algorithm of today.''
+                 *  [Poli et al., 2007] http://dx.doi.org/10.1007/s11721-007-0002-0
+                 *  [Clerc and Kennedy, 2002] http://dx.doi.org/10.1109/4235.985692
+                 *
+                 *  This being the canonical PSO of today, this variant is set as the default in PaGMO.
+                 *-------------------------------------------------------------------------------------*/
+                detail::pso_draw_coefficients(m_variant, r1, r2, m_e);
+                detail::pso_update_velocity(m_variant, m_omega, m_eta1, m_eta2, Vp, Xp, lbXp, gp, r1.data(),
+                                            r2.data(), dim);
             }
 
             // We now check that the velocity does not exceed the maximum allowed per component
             // and we perform the position update and the feasibility correction
-            for (decltype(dim) d = 0u; d < dim; ++d) {
-
-                if (m_V[p][d] > maxv[d]) {
-                    m_V[p][d] = maxv[d];
-                }
+            detail::pso_update_position(Vp, Xp, minv, maxv, lb, ub);
 
-                else if (m_V[p][d] < minv[d]) {
-                    m_V[p][d] = minv[d];
-                }
-
-                // update position
-                new_x = X[p][d] + m_V[p][d];
-
-                // feasibility correction
-                // (velocity updated to that which would have taken the previous position
-                // to the newly corrected feasible position)
-                if (new_x < lb[d]) {
-                    new_x = lb[d];
-                    m_V[p][d] = 0.;
-                    //					new_x = boost::uniform_real<double>(lb[d],ub[d])(m_drng);
-                    //					V[p][d] = new_x - X[p][d];
-                } else if (new_x > ub[d]) {
-                    new_x = ub[d];
-                    m_V[p][d] = 0.;
-                    //					new_x = boost::uniform_real<double>(lb[d],ub[d])(m_drng);
-                    //					V[p][d] = new_x - X[p][d];
-                }
-                X[p][d] = new_x;
-            }
             // We evaluate here the new individual fitness
             // as to be able to update the global best in real time
-            fit[p] = prob.fitness(X[p]);
+            std::copy(Xp, Xp + dim, xp.begin());
+            fit[p] = prob.scalar_fitness(xp);
 
             if (fit[p] <= lbfit[p]) {
                 // update the particle's previous best position
                 lbfit[p] = fit[p];
-                lbX[p] = X[p];
+                std::copy(Xp, Xp + dim, lbXp);
                 // update the best position observed so far by any particle in the swarm
                 // (only performed if swarm topology is gbest)
                 if ((m_neighb_type == 1u || m_neighb_type == 4u) && (fit[p] <= best_fit)) {
-                    best_neighb = X[p];
+                    best_neighb = xp;
                     best_fit = fit[p];
                     best_fit_improved = true;
                 }
@@ -380,35 +307,27 @@ population pso::evolve(population pop) const
                 // We compute the number of fitness evaluations made
                 auto feval_count = prob.get_fevals() - fevals0;
                 // We compute the average across the swarm of the best fitness encountered
-                vector_double local_fits(swarm_size);
-                for (decltype(swarm_size) i = 0u; i < swarm_size; ++i) {
-                    local_fits[i] = lbfit[i][0];
-                }
-                auto lb_avg = std::accumulate(local_fits.begin(), local_fits.end(), 0.)
-                              / static_cast<double>(local_fits.size());
+                auto lb_avg = std::accumulate(lbfit.begin(), lbfit.end(), 0.) / static_cast<double>(lbfit.size());
                 // We compute the best fitness encounterd so far across generations and across the swarm
-                // TODO: distance returns a signed type that can be overflown by the local_fits::size_type
-                auto idx_best = std::distance(std::begin(local_fits),
-                                              std::min_element(std::begin(local_fits), std::end(local_fits)));
-                auto best = local_fits[static_cast<vector_double::size_type>(idx_best)];
+                auto best = *std::min_element(std::begin(lbfit), std::end(lbfit));
                 // We compute a measure for the average particle velocity across the swarm
                 auto mean_velocity = 0.;
-                for (decltype(m_V.size()) i = 0u; i < m_V.size(); ++i) {
-                    for (decltype(m_V[i].size()) j = 0u; j < m_V[i].size(); ++j) {
+                for (decltype(swarm_size) i = 0u; i < swarm_size; ++i) {
+                    for (decltype(dim) j = 0u; j < dim; ++j) {
                         if (ub[j] > lb[j]) {
-                            mean_velocity += std::abs(m_V[i][j] / (ub[j] - lb[j]));
+                            mean_velocity += std::abs(m_V[i * dim + j] / (ub[j] - lb[j]));
                         } // else 0
                     }
-                    mean_velocity /= static_cast<double>(m_V[i].size());
+                    mean_velocity /= static_cast<double>(dim);
                 }
                 // We compute the average distance across particles (NOTE: N^2 complexity)
                 auto avg_dist = 0.;
-                for (decltype(X.size()) i = 0u; i < X.size(); ++i) {
-                    for (decltype(X.size()) j = i + 1u; j < X.size(); ++j) {
-                        auto x1 = X[i];
-                        auto x2 = X[j];
+                for (decltype(swarm_size) i = 0u; i < swarm_size; ++i) {
+                    for (decltype(swarm_size) j = i + 1u; j < swarm_size; ++j) {
+                        const auto x1 = X.data() + i * dim;
+                        const auto x2 = X.data() + j * dim;
                         double acc = 0.;
-                        for (decltype(x1.size()) k = 0u; k < x1.size(); ++k) {
+                        for (decltype(dim) k = 0u; k < dim; ++k) {
                             if (ub[k] > lb[k]) {
                                 acc += (x1[k] - x2[k]) * (x1[k] - x2[k]) / (ub[k] - lb[k]) / (ub[k] - lb[k]);
                             } // else 0
@@ -416,7 +335,7 @@ population pso::evolve(population pop) const
                         avg_dist += std::sqrt(acc);
                     }
                 }
-                avg_dist /= ((static_cast<double>(X.size()) - 1u) * static_cast<double>(X.size())) / 2.;
+                avg_dist /= ((static_cast<double>(swarm_size) - 1u) * static_cast<double>(swarm_size)) / 2.;
                 // We start printing
                 // Every 50 lines print the column names
                 if (count % 50u == 1u) {
@@ -437,7 +356,9 @@ population pso::evolve(population pop) const
 
     // copy particles' positions & velocities back to the main population
     for (decltype(swarm_size) i = 0u; i < swarm_size; ++i) {
-        pop.set_xf(i, lbX[i], lbfit[i]);
+        std::copy(lbX.data() + i * dim, lbX.data() + (i + 1u) * dim, xp.begin());
+        fp[0] = lbfit[i];
+        pop.set_xf(i, xp, fp);
     }
     return pop;
 }
@@ -497,14 +418,13 @@ void pso::serialize(Archive &ar, unsigned)
  *
  *  @param pidx index to the particle under consideration
  *  @param neighb definition of the swarm's topology
- *  @param lbX particles' previous best positions
  *  @param lbfit particles' fitness values at their previous best positions
- *  @return best position already visited by any of the considered particle's neighbours
+ *  @return index of the particle whose previous best position is the best one among the considered particle's
+ *  neighbours
  */
-vector_double pso::particle__get_best_neighbor(population::size_type pidx,
-                                               std::vector<std::vector<vector_double::size_type>> &neighb,
-                                               const std::vector<vector_double> &lbX,
-                                               const std::vector<vector_double> &lbfit) const
+population::size_type pso::particle__get_best_neighbor(population::size_type pidx,
+                                                       std::vector<std::vector<vector_double::size_type>> &neighb,
+                                                       const vector_double &lbfit) const
 {
     population::size_type bnidx; // neighbour index; best neighbour index
 
@@ -523,11 +443,11 @@ vector_double pso::particle__get_best_neighbor(population::size_type pidx,
             // iterate over indexes of the particle's neighbours, and identify the best
             bnidx = neighb[pidx][0];
             for (decltype(neighb[pidx].size()) nidx = 1u; nidx < neighb[pidx].size(); ++nidx) {
-                if (lbfit[neighb[pidx][nidx]][0] <= lbfit[bnidx][0]) {
+                if (lbfit[neighb[pidx][nidx]] <= lbfit[bnidx]) {
                     bnidx = neighb[pidx][nidx];
                 }
             }
-            return lbX[bnidx];
+            return bnidx;
     }
 }
 
@@ -551,13 +471,13 @@ vector_double pso::particle__get_best_neighbor(population::size_type pidx,
  *  @param[out] gbfit best fitness value in the swarm
  *  @param[out] neighb definition of the swarm's topology
  */
-void pso::initialize_topology__gbest(const population &pop, vector_double &gbX, vector_double &gbfit,
+void pso::initialize_topology__gbest(const population &pop, vector_double &gbX, double &gbfit,
                                      std::vector<std::vector<vector_double::size_type>> &neighb) const
 {
     // The best position already visited by the swarm will be tracked in pso::evolve() as particles are evaluated.
     // Here we define the initial values of the variables that will do that tracking.
     gbX = pop.get_x()[pop.best_idx()];
-    gbfit = pop.get_f()[pop.best_idx()];
+    gbfit = pop.get_f()[pop.best_idx()][0];
 
     /* The usage of a gbest swarm topology along with a FIPS (fully informed particle swarm) velocity update formula
      * is discouraged. However, because a user might still configure such a setup, we must ensure FIPS has access to
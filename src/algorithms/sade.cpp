@@ -26,7 +26,9 @@ You should have received copies of the GNU General Public License and the
 GNU Lesser General Public License along with the PaGMO library.  If not,
 see https://www.gnu.org/licenses/. */
 
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <iomanip>
 #include <iostream>
 #include <numeric>
@@ -39,6 +41,7 @@ see https://www.gnu.org/licenses/. */
 
 #include <pagmo/algorithm.hpp>
 #include <pagmo/algorithms/sade.hpp>
+#include <pagmo/bfe.hpp>
 #include <pagmo/exceptions.hpp>
 #include <pagmo/io.hpp>
 #include <pagmo/population.hpp>
@@ -46,6 +49,10 @@ see https://www.gnu.org/licenses/. */
 #include <pagmo/types.hpp>
 #include <pagmo/utils/generic.hpp>
 
+// NOTE: apparently this must be included *after*
+// the other serialization headers.
+#include <boost/serialization/optional.hpp>
+
 namespace pagmo
 {
 
@@ -162,6 +169,40 @@ population sade::evolve(population pop) const
     double gbIterCR = gbCR;
     // We initialize the global best for F and CR as the first individual (this will soon be forgotten)
 
+    // Selection of the trial vector tmp, whose fitness is newfitness, against the individual i.
+    // F and CR are the parameters used to create the trial vector.
+    auto select_trial = [&](decltype(NP) i, const vector_double &newfitness, double F, double CR) {
+        if (newfitness[0] <= fit[i][0]) { /* improved objective function value ? */
+            fit[i] = newfitness;
+            popnew[i] = tmp;
+            // updates the individual in pop (avoiding to recompute the objective function)
+            pop.set_xf(i, popnew[i], newfitness);
+            // Update the adapted parameters
+            m_CR[i] = CR;
+            m_F[i] = F;
+
+            if (newfitness[0] <= gbfit[0]) {
+                /* if so...*/
+                gbfit = newfitness; /* reset gbfit to new low...*/
+                gbX = popnew[i];
+                gbF = F;   /* these were forgotten in PaGMOlegacy */
+                gbCR = CR; /* these were forgotten in PaGMOlegacy */
+            }
+        } else {
+            popnew[i] = popold[i];
+        }
+    };
+
+    // The trial vectors of a generation, their fitnesses and the adapted parameters
+    // used to create them (used only if a bfe is available).
+    vector_double batch_x, batch_f, batch_F, batch_CR;
+    vector_double newfitness(1u);
+    if (m_bfe) {
+        batch_x.resize(NP * dim);
+        batch_F.resize(NP);
+        batch_CR.resize(NP);
+    }
+
     // Main DE iterations
     for (decltype(m_gen) gen = 1u; gen <= m_gen; ++gen) {
         // Start of the loop through the population
@@ -500,28 +541,27 @@ population sade::evolve(population pop) const
                     tmp[j] = uniform_real_from_range(lb[j], ub[j], m_e);
                 }
             }
-            // b) how good?
-            auto newfitness = prob.fitness(tmp); /* Evaluates tmp[] */
-            if (newfitness[0] <= fit[i][0]) {    /* improved objective function value ? */
-                fit[i] = newfitness;
-                popnew[i] = tmp;
-                // updates the individual in pop (avoiding to recompute the objective function)
-                pop.set_xf(i, popnew[i], newfitness);
-                // Update the adapted parameters
-                m_CR[i] = CR;
-                m_F[i] = F;
-
-                if (newfitness[0] <= gbfit[0]) {
-                    /* if so...*/
-                    gbfit = newfitness; /* reset gbfit to new low...*/
-                    gbX = popnew[i];
-                    gbF = F;   /* these were forgotten in PaGMOlegacy */
-                    gbCR = CR; /* these were forgotten in PaGMOlegacy */
-                }
-            } else {
-                popnew[i] = popold[i];
+            if (m_bfe) {
+                // b) bfe is available: the selection is deferred until the trial
+                // vectors of the whole generation have been evaluated.
+                std::copy(tmp.begin(), tmp.end(), batch_x.begin() + static_cast<std::ptrdiff_t>(i * dim));
+                batch_F[i] = F;
+                batch_CR[i] = CR;
+                continue;
             }
+            // b) how good?
+            select_trial(i, prob.fitness(tmp), F, CR);
         } // End of one generation
+        if (m_bfe) {
+            // Evaluate the trial vectors in one go and run the selection.
+            batch_f = (*m_bfe)(prob, batch_x);
+            for (decltype(NP) i = 0u; i < NP; ++i) {
+                const auto it = batch_x.begin() + static_cast<std::ptrdiff_t>(i * dim);
+                std::copy(it, it + static_cast<std::ptrdiff_t>(dim), tmp.begin());
+                newfitness[0] = batch_f[i];
+                select_trial(i, newfitness, batch_F[i], batch_CR[i]);
+            }
+        }
         /* Save best population member of current iteration */
         gbIter = gbX;
         gbIterF = gbF;
@@ -596,6 +636,18 @@ void sade::set_seed(unsigned seed)
     m_seed = seed;
 }
 
+/// Sets the batch function evaluation scheme
+/**
+ * After a call to this method, evolve() will evaluate the trial vectors of each generation
+ * in a single call to \p b.
+ *
+ * @param b batch function evaluation object
+ */
+void sade::set_bfe(const bfe &b)
+{
+    m_bfe = b;
+}
+
 /// Extra info
 /**
  * One of the optional methods of any user-defined algorithm (UDA).
@@ -628,7 +680,7 @@ template <typename Archive>
 void sade::serialize(Archive &ar, unsigned)
 {
     detail::archive(ar, m_gen, m_F, m_CR, m_variant, m_variant_adptv, m_Ftol, m_xtol, m_memory, m_e, m_seed,
-                    m_verbosity, m_log);
+                    m_verbosity, m_log, m_bfe);
 }
 
 } // namespace pagmo
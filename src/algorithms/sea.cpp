@@ -112,8 +112,12 @@ population sea::evolve(population pop) const
                 }
             }
         }
-        // 3 - Insert the offspring into the population if better
-        auto offspring_f = prob.fitness(offspring);
+        // 3 - Insert the offspring into the population if better (the fitness
+        // is taken from the deduplication index of the population, if possible)
+        vector_double offspring_f;
+        if (!pop.lookup_f(offspring, offspring_f)) {
+            offspring_f = prob.fitness(offspring);
+        }
         auto improvement = pop.get_f()[worst_idx][0] - offspring_f[0];
         if (improvement >= 0.) {
             pop.set_xf(worst_idx, offspring, offspring_f);
@@ -0,0 +1,455 @@
+/* Copyright 2017-2020 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <pagmo/algorithm.hpp>
+#include <pagmo/algorithms/sep_cmaes.hpp>
+#include <pagmo/bfe.hpp>
+#include <pagmo/detail/custom_comparisons.hpp>
+#include <pagmo/exceptions.hpp>
+#include <pagmo/io.hpp>
+#include <pagmo/population.hpp>
+#include <pagmo/s11n.hpp>
+#include <pagmo/types.hpp>
+#include <pagmo/utils/generic.hpp>
+
+// NOTE: apparently this must be included *after*
+// the other serialization headers.
+#include <boost/serialization/optional.hpp>
+
+namespace pagmo
+{
+
+sep_cmaes::sep_cmaes(unsigned gen, double cc, double cs, double c1, double cmu, double sigma0, double ftol,
+                     double xtol, bool memory, bool force_bounds, unsigned seed)
+    : m_gen(gen), m_cc(cc), m_cs(cs), m_c1(c1), m_cmu(cmu), m_sigma0(sigma0), m_ftol(ftol), m_xtol(xtol),
+      m_memory(memory), m_force_bounds(force_bounds), m_e(seed), m_seed(seed), m_verbosity(0u)
+{
+    if (((cc < 0.) || (cc > 1.)) && !(cc == -1)) {
+        pagmo_throw(std::invalid_argument,
+                    "cc must be in [0,1] or -1 if its value has to be initialized automatically, a value of "
+                        + std::to_string(cc) + " was detected");
+    }
+    if (((cs < 0.) || (cs > 1.)) && !(cs == -1)) {
+        pagmo_throw(std::invalid_argument,
+                    "cs needs to be in [0,1] or -1 if its value has to be initialized automatically, a value of "
+                        + std::to_string(cs) + " was detected");
+    }
+    if (((c1 < 0.) || (c1 > 1.)) && !(c1 == -1)) {
+        pagmo_throw(std::invalid_argument,
+                    "c1 needs to be in [0,1] or -1 if its value has to be initialized automatically, a value of "
+                        + std::to_string(c1) + " was detected");
+    }
+    if (((cmu < 0.) || (cmu > 1.)) && !(cmu == -1)) {
+        pagmo_throw(std::invalid_argument,
+                    "cmu needs to be in [0,1] or -1 if its value has to be initialized automatically, a value of "
+                        + std::to_string(cmu) + " was detected");
+    }
+
+    // Initialize explicitly the algorithm memory
+    sigma = m_sigma0;
+    mean = vector_double{};
+    C = vector_double{};
+    D = vector_double{};
+    pc = vector_double{};
+    ps = vector_double{};
+    counteval = 0u;
+}
+
+/// Algorithm evolve method
+/**
+ *
+ * Evolves the population for a maximum number of generations, until one of
+ * tolerances set on the population flatness (x_tol, f_tol) are met.
+ *
+ * @param pop population to be evolved
+ * @return evolved population
+ * @throws std::invalid_argument if the problem is multi-objective or constrained
+ * @throws std::invalid_argument if the problem is unbounded
+ * @throws std::invalid_argument if the population size is not at least 5
+ * @throws unspecified any exception thrown by the batch fitness evaluator, if set.
+ */
+population sep_cmaes::evolve(population pop) const
+{
+    // We store some useful variables
+    const auto &prob = pop.get_problem(); // This is a const reference, so using set_seed for example will not be
+                                          // allowed.
+    auto dim = prob.get_nx();
+    const auto bounds = prob.get_bounds();
+    const auto &lb = bounds.first;
+    const auto &ub = bounds.second;
+    auto lam = pop.size();
+    auto mu = lam / 2u;
+    const auto prob_f_dimension = prob.get_nf();
+    const auto fevals0 = prob.get_fevals(); // discount for the already made fevals
+    auto count = 1u;                        // regulates the screen output
+
+    // PREAMBLE--------------------------------------------------
+    // Checks on the problem type
+    if (prob.get_nc() != 0u) {
+        pagmo_throw(std::invalid_argument, "Non linear constraints detected in " + prob.get_name() + " instance. "
+                                               + get_name() + " cannot deal with them");
+    }
+    if (prob_f_dimension != 1u) {
+        pagmo_throw(std::invalid_argument, "Multiple objectives detected in " + prob.get_name() + " instance. "
+                                               + get_name() + " cannot deal with them");
+    }
+    if (lam < 5u) {
+        pagmo_throw(std::invalid_argument, get_name() + " needs at least 5 individuals in the population, "
+                                               + std::to_string(lam) + " detected");
+    }
+    for (auto num : lb) {
+        if (!std::isfinite(num)) {
+            pagmo_throw(std::invalid_argument, "A " + std::to_string(num) + " is detected in the lower bounds, "
+                                                   + this->get_name() + " cannot deal with it.");
+        }
+    }
+    for (auto num : ub) {
+        if (!std::isfinite(num)) {
+            pagmo_throw(std::invalid_argument, "A " + std::to_string(num) + " is detected in the upper bounds, "
+                                                   + this->get_name() + " cannot deal with it.");
+        }
+    }
+    // Get out if there is nothing to do.
+    if (m_gen == 0u) {
+        return pop;
+    }
+    // -----------------------------------------------------------
+
+    // No throws, all valid: we clear the logs
+    m_log.clear();
+
+    // Initializing the random number generator
+    std::normal_distribution<double> normally_distributed_number(0., 1.);
+    // Setting coefficients for Selection
+    vector_double weights(mu);
+    for (decltype(mu) i = 0u; i < mu; ++i) {
+        weights[i] = std::log(static_cast<double>(mu) + 0.5) - std::log(static_cast<double>(i) + 1.);
+    }
+    const auto wsum = std::accumulate(weights.begin(), weights.end(), 0.);
+    for (auto &w : weights) {
+        w /= wsum; // weights for the weighted recombination
+    }
+    // variance-effectiveness of sum w_i x_i
+    const double mueff = 1. / std::inner_product(weights.begin(), weights.end(), weights.begin(), 0.);
+
+    // Setting coefficients for Adaptation automatically or to user defined data. The learning
+    // rates of the covariance are those of the full CMA-ES multiplied by (N + 2) / 3, as
+    // suggested by Ros and Hansen for the separable variant.
+    double cc(m_cc), cs(m_cs), c1(m_c1), cmu(m_cmu);
+    double N = static_cast<double>(dim);
+    if (cc == -1) {
+        cc = (4. + mueff / N) / (N + 4. + 2. * mueff / N); // t-const for cumulation for C
+    }
+    if (cs == -1) {
+        cs = (mueff + 2.) / (N + mueff + 5.); // t-const for cumulation for sigma control
+    }
+    if (c1 == -1) {
+        c1 = std::min(1., (N + 2.) / 3. * 2. / ((N + 1.3) * (N + 1.3) + mueff)); // learning rate for rank-one update
+    }
+    if (cmu == -1) {
+        cmu = std::min(1. - c1, (N + 2.) / 3. * 2. * (mueff - 2. + 1. / mueff)
+                                    / ((N + 2.) * (N + 2.) + mueff)); // and for rank-mu update
+    }
+
+    double damps
+        = 1. + 2. * std::max(0., std::sqrt((mueff - 1.) / (N + 1.)) - 1.) + cs; // damping coefficient for sigma
+    double chiN
+        = std::sqrt(N) * (1. - 1. / (4. * N) + 1. / (21. * N * N)); // expectation of ||N(0,I)|| == norm(randn(N,1))
+
+    // Some buffers
+    vector_double meanold(dim, 0.);
+    // The rank-mu update of the covariance.
+    vector_double Cmu(dim, 0.);
+    // The offspring of each generation, stored contiguously (one individual after the other)
+    // so that they can be fed directly to a batch fitness evaluator.
+    vector_double X(lam * dim, 0.);
+    vector_double dumb(dim, 0.);
+
+    // If the algorithm is called for the first time on this problem dimension or if m_memory is false we
+    // erease the memory of past calls
+    if ((mean.size() != dim) || (m_memory == false)) {
+        sigma = m_sigma0;
+        mean = pop.get_x()[pop.best_idx()];
+        // The diagonal D defines the scaling. By default this is the witdh of the box bounds.
+        // If this is too small... then 1e-6 is used
+        D.resize(dim);
+        C.resize(dim);
+        for (decltype(dim) j = 0u; j < dim; ++j) {
+            D[j] = std::max((ub[j] - lb[j]), 1e-6);
+            C[j] = D[j] * D[j];
+        }
+        pc = vector_double(dim, 0.);
+        ps = vector_double(dim, 0.);
+        counteval = 0u;
+    }
+
+    if (m_verbosity > 0u) {
+        std::cout << "sep-CMAES 4 PaGMO: " << std::endl;
+        std::cout << "mu: " << mu << " - lambda: " << lam << " - mueff: " << mueff << " - N: " << N << std::endl;
+        std::cout << "cc: " << cc << " - cs: " << cs << " - c1: " << c1 << " - cmu: " << cmu << " - sigma: " << sigma
+                  << " - damps: " << damps << " - chiN: " << chiN << std::endl;
+    }
+
+    // ----------------------------------------------//
+    // HERE WE START THE JUICE OF THE ALGORITHM      //
+    // ----------------------------------------------//
+    std::vector<population::size_type> best_idx(lam);
+    for (decltype(m_gen) gen = 1u; gen <= m_gen; ++gen) {
+        // 1 - We generate lam new individuals sampling from N(mean, sigma^2 * diag(C))
+        for (decltype(lam) i = 0u; i < lam; ++i) {
+            auto x = X.data() + i * dim;
+            for (decltype(dim) j = 0u; j < dim; ++j) {
+                x[j] = mean[j] + sigma * D[j] * normally_distributed_number(m_e);
+            }
+        }
+        // The flatness in chromosome, measured on the last sample.
+        double dx = 0.;
+        for (decltype(dim) j = 0u; j < dim; ++j) {
+            const auto d = X[(lam - 1u) * dim + j] - mean[j];
+            dx += d * d;
+        }
+        dx = std::sqrt(dx);
+
+        // 1bis - Check the exit conditions and logs
+        // Exit condition on xtol
+        {
+            if (dx < m_xtol) {
+                if (m_verbosity > 0u) {
+                    std::cout << "Exit condition -- xtol < " << m_xtol << std::endl;
+                }
+                return pop;
+            }
+            // Exit condition on ftol
+            auto idx_b = pop.best_idx();
+            auto idx_w = pop.worst_idx();
+            double delta_f = std::abs(pop.get_f()[idx_b][0] - pop.get_f()[idx_w][0]);
+            if (delta_f < m_ftol) {
+                if (m_verbosity) {
+                    std::cout << "Exit condition -- ftol < " << m_ftol << std::endl;
+                }
+                return pop;
+            }
+        }
+
+        // 1bis - Logs and prints (verbosity modes > 1: a line is added every m_verbosity generations)
+        if (m_verbosity > 0u) {
+            // Every m_verbosity generations print a log line
+            if (gen % m_verbosity == 1u || m_verbosity == 1u) {
+                // The population flattness in fitness
+                auto idx_b = pop.best_idx();
+                auto idx_w = pop.worst_idx();
+                auto df = std::abs(pop.get_f()[idx_b][0] - pop.get_f()[idx_w][0]);
+                // Every 50 lines print the column names
+                if (count % 50u == 1u) {
+                    print("\n", std::setw(7), "Gen:", std::setw(15), "Fevals:", std::setw(15), "Best:", std::setw(15),
+                          "dx:", std::setw(15), "df:", std::setw(15), "sigma:", '\n');
+                }
+                print(std::setw(7), gen, std::setw(15), prob.get_fevals() - fevals0, std::setw(15),
+                      pop.get_f()[idx_b][0], std::setw(15), dx, std::setw(15), df, std::setw(15), sigma, '\n');
+                ++count;
+                // Logs
+                m_log.emplace_back(gen, prob.get_fevals() - fevals0, pop.get_f()[idx_b][0], dx, df, sigma);
+            }
+        }
+        // 2 - We fix the bounds.
+        // Note that this screws up the whole covariance matrix machinery and worsen
+        // performances considerably.
+        if (m_force_bounds) {
+            for (decltype(lam) i = 0u; i < lam; ++i) {
+                for (decltype(dim) j = 0u; j < dim; ++j) {
+                    auto &xij = X[i * dim + j];
+                    if (xij < lb[j]) {
+                        xij = lb[j];
+                    } else if (xij > ub[j]) {
+                        xij = ub[j];
+                    }
+                }
+            }
+        }
+        // 3 - We Evaluate the new population (if the problem is stochastic change seed first)
+        if (prob.is_stochastic()) {
+            // change the problem seed. This is done via the population_set_seed method as prob.set_seed
+            // is forbidden being prob a const ref.
+            pop.get_problem().set_seed(std::uniform_int_distribution<unsigned>()(m_e));
+        }
+        // Reinsertion
+        if (m_bfe) {
+            // bfe is available:
+            const auto fitnesses = (*m_bfe)(prob, X);
+            for (decltype(lam) i = 0u; i < lam; ++i) {
+                dumb.assign(X.data() + i * dim, X.data() + (i + 1u) * dim);
+                pop.set_xf(i, dumb, {fitnesses[i]});
+            }
+        } else {
+            // bfe not available:
+            for (decltype(lam) i = 0u; i < lam; ++i) {
+                dumb.assign(X.data() + i * dim, X.data() + (i + 1u) * dim);
+                pop.set_x(i, dumb);
+            }
+        }
+        counteval += lam;
+        // 4 - We extract the elite from this generation.
+        // NOTE: only the mu best individuals need to be sorted.
+        std::iota(best_idx.begin(), best_idx.end(), population::size_type(0));
+        detail::select_top_k(best_idx.begin(), best_idx.begin() + static_cast<decltype(best_idx)::difference_type>(mu),
+                             best_idx.end(), [&pop](population::size_type idx1, population::size_type idx2) {
+                                 return detail::less_than_f(pop.get_f()[idx1][0], pop.get_f()[idx2][0]);
+                             });
+        // 5 - Compute the new mean of the elite storing the old one, and the rank-mu update
+        // of the covariance
+        meanold.swap(mean);
+        std::fill(mean.begin(), mean.end(), 0.);
+        std::fill(Cmu.begin(), Cmu.end(), 0.);
+        for (decltype(mu) i = 0u; i < mu; ++i) {
+            const auto &x = pop.get_x()[best_idx[i]];
+            for (decltype(dim) j = 0u; j < dim; ++j) {
+                const auto y = (x[j] - meanold[j]) / sigma;
+                mean[j] += weights[i] * x[j];
+                Cmu[j] += weights[i] * y * y;
+            }
+        }
+        // 6 - Update evolution paths
+        const auto cps = std::sqrt(cs * (2. - cs) * mueff);
+        double ps_norm2 = 0.;
+        for (decltype(dim) j = 0u; j < dim; ++j) {
+            ps[j] = (1. - cs) * ps[j] + cps * (mean[j] - meanold[j]) / sigma / D[j];
+            ps_norm2 += ps[j] * ps[j];
+        }
+        double hsig = 0.;
+        hsig = (ps_norm2 / N
+                / (1. - std::pow((1. - cs), (2. * static_cast<double>(counteval) / static_cast<double>(lam)))))
+               < (2. + 4. / (N + 1.));
+        const auto cpc = hsig * std::sqrt(cc * (2. - cc) * mueff);
+        for (decltype(dim) j = 0u; j < dim; ++j) {
+            pc[j] = (1. - cc) * pc[j] + cpc * (mean[j] - meanold[j]) / sigma;
+        }
+        // 7 - Adapt the (diagonal) Covariance Matrix and its square root
+        for (decltype(dim) j = 0u; j < dim; ++j) {
+            C[j] = (1. - c1 - cmu) * C[j] + cmu * Cmu[j] + c1 * (pc[j] * pc[j] + (1. - hsig) * cc * (2. - cc) * C[j]);
+            D[j] = std::sqrt(std::max(1e-20, C[j])); // D contains standard deviations now
+        }
+        // 8 - Adapt sigma
+        sigma *= std::exp(std::min(0.6, (cs / damps) * (std::sqrt(ps_norm2) / chiN - 1.)));
+    } // end of generation loop
+    if (m_verbosity) {
+        std::cout << "Exit condition -- generations = " << m_gen << std::endl;
+    }
+    return pop;
+}
+
+/// Sets the seed
+/**
+ * @param seed the seed controlling the algorithm stochastic behaviour
+ */
+void sep_cmaes::set_seed(unsigned seed)
+{
+    m_e.seed(seed);
+    m_seed = seed;
+}
+
+/// Sets the batch function evaluation scheme
+/**
+ * After a call to this method, evolve() will evaluate the offspring of each
+ * generation with a single call to \p b.
+ *
+ * @param b batch function evaluation object
+ */
+void sep_cmaes::set_bfe(const bfe &b)
+{
+    m_bfe = b;
+}
+
+/// Extra info
+/**
+ * One of the optional methods of any user-defined algorithm (UDA).
+ *
+ * @return a string containing extra info on the algorithm
+ */
+std::string sep_cmaes::get_extra_info() const
+{
+    std::ostringstream ss;
+    stream(ss, "\tGenerations: ", m_gen);
+    stream(ss, "\n\tcc: ");
+    if (m_cc == -1)
+        stream(ss, "auto");
+    else
+        stream(ss, m_cc);
+    stream(ss, "\n\tcs: ");
+    if (m_cs == -1)
+        stream(ss, "auto");
+    else
+        stream(ss, m_cs);
+    stream(ss, "\n\tc1: ");
+    if (m_c1 == -1)
+        stream(ss, "auto");
+    else
+        stream(ss, m_c1);
+    stream(ss, "\n\tcmu: ");
+    if (m_cmu == -1)
+        stream(ss, "auto");
+    else
+        stream(ss, m_cmu);
+    stream(ss, "\n\tsigma0: ", m_sigma0);
+    stream(ss, "\n\tStopping xtol: ", m_xtol);
+    stream(ss, "\n\tStopping ftol: ", m_ftol);
+    stream(ss, "\n\tMemory: ", m_memory);
+    stream(ss, "\n\tVerbosity: ", m_verbosity);
+    stream(ss, "\n\tForce bounds: ", m_force_bounds);
+    stream(ss, "\n\tSeed: ", m_seed);
+    return ss.str();
+}
+
+/// Object serialization
+/**
+ * This method will save/load \p this into the archive \p ar.
+ *
+ * @param ar target archive.
+ *
+ * @throws unspecified any exception thrown by the serialization of primitive types.
+ */
+template <typename Archive>
+void sep_cmaes::serialize(Archive &ar, unsigned)
+{
+    detail::archive(ar, m_gen, m_cc, m_cs, m_c1, m_cmu, m_sigma0, m_ftol, m_xtol, m_memory, m_force_bounds, sigma, mean,
+                    C, D, pc, ps, counteval, m_e, m_seed, m_verbosity, m_log, m_bfe);
+}
+
+} // namespace pagmo
+
+PAGMO_S11N_ALGORITHM_IMPLEMENT(pagmo::sep_cmaes)
@@ -59,6 +59,7 @@ see https://www.gnu.org/licenses/. */
 #include <pagmo/utils/generic.hpp>
 #include <pagmo/utils/genetic_operators.hpp>
 
+
 namespace pagmo
 {
 
@@ -245,9 +246,12 @@ population sga::evolve(population pop) const
         perform_crossover(XNEW, prob.get_bounds(), dim_i);
         // 4 - Mutation
         perform_mutation(XNEW, prob.get_bounds(), dim_i);
-        // 5 - Evaluate the new population
+        // 5 - Evaluate the new population (the fitness is taken
+        // from the deduplication index of the population, if possible)
         for (decltype(NP) j = 0u; j < NP; ++j) {
-            FNEW[j] = prob.fitness(XNEW[j]);
+            if (!pop.lookup_f(XNEW[j], FNEW[j])) {
+                FNEW[j][0] = prob.scalar_fitness(XNEW[j]);
+            }
         }
         // 6 - Logs and prints
         if (m_verbosity > 0u) {
@@ -278,12 +282,8 @@ population sga::evolve(population pop) const
             XNEW.push_back(pop.get_x()[j]);
             FNEW.push_back(pop.get_f()[j]);
         }
-        // sort the entire pool
-        std::vector<vector_double::size_type> best_idxs(FNEW.size());
-        std::iota(best_idxs.begin(), best_idxs.end(), vector_double::size_type(0u));
-        std::sort(best_idxs.begin(), best_idxs.end(), [&FNEW](vector_double::size_type a, vector_double::size_type b) {
-            return detail::less_than_f(FNEW[a][0], FNEW[b][0]);
-        });
+        // select the best NP individuals of the pool (only those are sorted)
+        const auto best_idxs = select_best_N_so(FNEW, NP);
         for (decltype(NP) j = 0u; j < NP; ++j) {
             pop.set_xf(j, XNEW[best_idxs[j]], FNEW[best_idxs[j]]);
         }
@@ -353,9 +353,12 @@ std::vector<vector_double::size_type> sga::perform_selection(const std::vector<v
     std::iota(best_idxs.begin(), best_idxs.end(), vector_double::size_type(0u));
     switch (m_selection) {
         case (detail::sga_selection::TRUNCATED): {
-            std::sort(best_idxs.begin(), best_idxs.end(), [&F](vector_double::size_type a, vector_double::size_type b) {
-                return detail::less_than_f(F[a][0], F[b][0]);
-            });
+            // NOTE: only the best m_param_s individuals need to be sorted.
+            detail::select_top_k(best_idxs.begin(),
+                                 best_idxs.begin() + static_cast<decltype(best_idxs)::difference_type>(m_param_s),
+                                 best_idxs.end(), [&F](vector_double::size_type a, vector_double::size_type b) {
+                                     return detail::less_than_f(F[a][0], F[b][0]);
+                                 });
             for (decltype(retval.size()) i = 0u; i < retval.size(); ++i) {
                 retval[i] = best_idxs[i % m_param_s];
             }
@@ -39,6 +39,8 @@ see https://www.gnu.org/licenses/. */
 
 #include <pagmo/algorithm.hpp>
 #include <pagmo/algorithms/xnes.hpp>
+#include <pagmo/bfe.hpp>
+#include <pagmo/detail/custom_comparisons.hpp>
 #include <pagmo/detail/eigen.hpp>
 #include <pagmo/detail/eigen_s11n.hpp>
 #include <pagmo/exceptions.hpp>
@@ -46,6 +48,11 @@ see https://www.gnu.org/licenses/. */
 #include <pagmo/population.hpp>
 #include <pagmo/s11n.hpp>
 #include <pagmo/types.hpp>
+#include <pagmo/utils/generic.hpp>
+
+// NOTE: apparently this must be included *after*
+// the other serialization headers.
+#include <boost/serialization/optional.hpp>
 
 namespace pagmo
 {
@@ -164,9 +171,16 @@ population xnes::evolve(population pop) const
         eta_b = common_default;
     }
     // Initialize the utility function u
+    // NOTE: n_ranked is the number of samples which get a positive utility before the
+    // uniform baseline is removed. All the other samples get the same utility, so that
+    // only the n_ranked best samples need to be sorted.
     std::vector<double> u(lam);
+    decltype(u.size()) n_ranked = 0u;
     for (decltype(u.size()) i = 0u; i < u.size(); ++i) {
         u[i] = std::max(0., std::log(lam_d / 2. + 1.) - std::log(i + 1));
+        if (u[i] > 0.) {
+            ++n_ranked;
+        }
     }
     double sum = 0.;
     for (decltype(u.size()) i = 0u; i < u.size(); ++i) {
@@ -195,12 +209,16 @@ population xnes::evolve(population pop) const
             mean(_(i)) = pop.get_x()[idx_b][i];
         }
     }
-    // This will hold in the eigen data structure the sampled population
-    Eigen::VectorXd tmp = Eigen::VectorXd::Zero(_(dim));
-    auto z = std::vector<Eigen::VectorXd>(lam, tmp);
-    auto x = std::vector<Eigen::VectorXd>(lam, tmp);
-    // Temporary container
+    // This will hold in the eigen data structure the sampled population, stored column-wise,
+    // and its image through A
+    Eigen::MatrixXd z(_(dim), _(lam)), Az(_(dim), _(lam)), x(_(dim), _(lam));
+    // The utilities associated to each column of z
+    Eigen::VectorXd w(_(lam));
+    // Temporary containers
     vector_double dumb(dim, 0.);
+    // The 2lam x 2lam block matrix used to compute phi(S) = (exp(S) - I) / S (see below)
+    Eigen::MatrixXd S2 = Eigen::MatrixXd::Zero(_(2u * lam), _(2u * lam));
+    S2.topRightCorner(_(lam), _(lam)).setIdentity();
 
     if (m_verbosity > 0u) {
         std::cout << "xNES 4 PaGMO: " << std::endl;
@@ -219,34 +237,51 @@ population xnes::evolve(population pop) const
             pop.get_problem().set_seed(std::uniform_int_distribution<unsigned>()(m_e));
         }
         // 1 - We generate lam new individuals using the current probability distribution
+        // 1a - we create lam randomly normal distributed vectors
         for (decltype(lam) i = 0u; i < lam; ++i) {
-            // 1a - we create a randomly normal distributed vector
             for (decltype(dim) j = 0u; j < dim; ++j) {
-                z[i](_(j)) = normally_distributed_number(m_e);
+                z(_(j), _(i)) = normally_distributed_number(m_e);
             }
-            // 1b - and store its transformed value in the new chromosomes
-            x[i] = mean + A * z[i];
-            if (m_force_bounds) {
-                // We fix the bounds. Note that this screws up the whole covariance matrix machinery and worsen
-                // performances considerably.
+        }
+        // 1b - and transform them all at once with a single matrix product
+        Az.noalias() = A * z;
+        // The population flattness in chromosome
+        const auto dx = Az.col(0).norm();
+        x = Az;
+        x.colwise() += mean;
+        if (m_force_bounds) {
+            // We fix the bounds. Note that this screws up the whole covariance matrix machinery and worsen
+            // performances considerably.
+            for (decltype(lam) i = 0u; i < lam; ++i) {
                 for (decltype(dim) j = 0u; j < dim; ++j) {
-                    if (x[i](_(j)) < lb[j]) {
-                        x[i](_(j)) = lb[j];
-                    } else if (x[i](_(j)) > ub[j]) {
-                        x[i](_(j)) = ub[j];
+                    if (x(_(j), _(i)) < lb[j]) {
+                        x(_(j), _(i)) = lb[j];
+                    } else if (x(_(j), _(i)) > ub[j]) {
+                        x(_(j), _(i)) = ub[j];
                     }
                 }
             }
-            for (decltype(dim) j = 0u; j < dim; ++j) {
-                dumb[j] = x[i](_(j));
+        }
+        // 1c - we evaluate the new individuals
+        if (m_bfe) {
+            // bfe is available:
+            const auto fitnesses = (*m_bfe)(prob, vector_double(x.data(), x.data() + x.size()));
+            for (decltype(lam) i = 0u; i < lam; ++i) {
+                Eigen::Map<Eigen::VectorXd>(dumb.data(), _(dim)) = x.col(_(i));
+                pop.set_xf(i, dumb, {fitnesses[i]});
+            }
+        } else {
+            // bfe not available:
+            for (decltype(lam) i = 0u; i < lam; ++i) {
+                Eigen::Map<Eigen::VectorXd>(dumb.data(), _(dim)) = x.col(_(i));
+                pop.set_x(i, dumb);
             }
-            pop.set_x(i, dumb);
         }
 
         // 2 - Check the exit conditions and logs
         // Exit condition on xtol
         {
-            if ((A * z[0]).norm() < m_xtol) {
+            if (dx < m_xtol) {
                 if (m_verbosity > 0u) {
                     std::cout << "Exit condition -- xtol < " << m_xtol << std::endl;
                 }
@@ -268,8 +303,6 @@ population xnes::evolve(population pop) const
         if (m_verbosity > 0u) {
             // Every m_verbosity generations print a log line
             if (gen % m_verbosity == 1u || m_verbosity == 1u) {
-                // The population flattness in chromosome
-                auto dx = (A * z[0]).norm();
                 // The population flattness in fitness
                 auto idx_b = pop.best_idx();
                 auto idx_w = pop.worst_idx();
@@ -287,27 +320,39 @@ population xnes::evolve(population pop) const
             }
         }
 
-        // 3 - We sort the population
+        // 3 - We rank the population (only the samples with a positive utility need to be sorted)
         std::vector<vector_double::size_type> s_idx(lam);
         std::iota(s_idx.begin(), s_idx.end(), vector_double::size_type(0u));
-        std::sort(s_idx.begin(), s_idx.end(), [&pop](vector_double::size_type a, vector_double::size_type b) {
-            return pop.get_f()[a][0] < pop.get_f()[b][0];
-        });
-        // 4 - We update the distribution parameters mu, sigma and B following the xnes rules
-        Eigen::MatrixXd I = Eigen::MatrixXd::Identity(_(dim), _(dim));
-        Eigen::VectorXd d_center = u[0] * z[s_idx[0]];
-        for (decltype(u.size()) i = 1u; i < u.size(); ++i) {
-            d_center += u[i] * z[s_idx[i]];
+        detail::select_top_k(s_idx.begin(), s_idx.begin() + static_cast<decltype(s_idx)::difference_type>(n_ranked),
+                             s_idx.end(), [&pop](vector_double::size_type a, vector_double::size_type b) {
+                                 return detail::less_than_f(pop.get_f()[a][0], pop.get_f()[b][0]);
+                             });
+        // 4 - We update the distribution parameters mu, sigma and B following the xnes rules.
+        // The utilities are assigned to the samples according to their rank, so that the
+        // natural gradients can be computed as matrix products over all the samples.
+        for (decltype(lam) i = 0u; i < lam; ++i) {
+            w(_(s_idx[i])) = u[i];
         }
-        Eigen::MatrixXd cov_grad = u[0] * (z[s_idx[0]] * z[s_idx[0]].transpose() - I);
-        for (decltype(u.size()) i = 1u; i < u.size(); ++i) {
-            cov_grad += u[i] * (z[s_idx[i]] * z[s_idx[i]].transpose() - I);
+        // The gradient with respect to A is cov_grad = z * W * z^T - (sum(w) + cov_trace / dim_d) * I,
+        // with W = diag(w), and the update is A <- A * exp(d_A), d_A = alpha * I + beta * z * W * z^T.
+        const double cov_trace = (z.colwise().squaredNorm().transpose().array() * w.array()).sum() - w.sum() * dim_d;
+        const double alpha = 0.5 * (eta_sigma * cov_trace / dim_d - eta_b * (w.sum() + cov_trace / dim_d));
+        const double beta = 0.5 * eta_b;
+        mean.noalias() += eta_mu * Az * w;
+        if (lam < dim) {
+            // d_A has rank at most lam in addition to the identity, hence, with C = beta * W * z^T,
+            // exp(d_A) = exp(alpha) * (I + z * phi(C * z) * C), phi(S) = (exp(S) - I) / S. This avoids the
+            // exponential of a dim x dim matrix and makes the cost of the update O(dim^2 * lam). phi(S)
+            // is the top right block of the exponential of [[S, I], [0, 0]].
+            S2.topLeftCorner(_(lam), _(lam)).noalias() = beta * w.asDiagonal() * (z.transpose() * z);
+            const Eigen::MatrixXd phi = S2.exp().topRightCorner(_(lam), _(lam));
+            A.noalias() += (Az * phi) * (beta * w.asDiagonal() * z.transpose());
+            A *= std::exp(alpha);
+        } else {
+            Eigen::MatrixXd d_A = beta * z * w.asDiagonal() * z.transpose();
+            d_A.diagonal().array() += alpha;
+            A = A * d_A.exp();
         }
-        double cov_trace = cov_grad.trace();
-        cov_grad = cov_grad - cov_trace / dim_d * I;
-        Eigen::MatrixXd d_A = 0.5 * (eta_sigma * cov_trace / dim_d * I + eta_b * cov_grad);
-        mean = mean + eta_mu * A * d_center;
-        A = A * d_A.exp();
         sigma = sigma * std::exp(eta_sigma / 2. * cov_trace / dim_d); // used only for cmaes comparisons
     }
     if (m_verbosity) {
@@ -326,6 +371,18 @@ void xnes::set_seed(unsigned seed)
     m_seed = seed;
 }
 
+/// Sets the batch function evaluation scheme
+/**
+ * After a call to this method, evolve() will evaluate the new individuals of each
+ * generation with a single call to \p b.
+ *
+ * @param b batch function evaluation object
+ */
+void xnes::set_bfe(const bfe &b)
+{
+    m_bfe = b;
+}
+
 /// Extra info
 /**
  * One of the optional methods of any user-defined algorithm (UDA).
@@ -381,7 +438,7 @@ template <typename Archive>
 void xnes::serialize(Archive &ar, unsigned)
 {
     detail::archive(ar, m_gen, m_eta_mu, m_eta_sigma, m_eta_b, m_sigma0, m_ftol, m_xtol, m_memory, m_force_bounds,
-                    sigma, mean, A, m_e, m_seed, m_verbosity, m_log);
+                    sigma, mean, A, m_e, m_seed, m_verbosity, m_log, m_bfe);
 }
 
 } // namespace pagmo
@@ -0,0 +1,510 @@
+/* Copyright 2017-2020 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include <pagmo/async_evaluator.hpp>
+#include <pagmo/config.hpp>
+#include <pagmo/exceptions.hpp>
+#include <pagmo/problem.hpp>
+#include <pagmo/threading.hpp>
+#include <pagmo/tracing.hpp>
+#include <pagmo/types.hpp>
+
+#if defined(PAGMO_WITH_FORK_ISLAND)
+
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "detail/pipe.hpp"
+
+#endif
+
+namespace pagmo
+{
+
+#if !defined(PAGMO_DOXYGEN_INVOKED)
+
+std::ostream &operator<<(std::ostream &os, async_backend b)
+{
+    switch (b) {
+        case async_backend::thread:
+            os << "thread";
+            break;
+        case async_backend::fork:
+            os << "fork";
+            break;
+        default:
+            os << "unknown value";
+            break;
+    }
+    return os;
+}
+
+#endif
+
+namespace detail
+{
+
+namespace
+{
+
+#if defined(PAGMO_WITH_FORK_ISLAND)
+
+// Evaluate the fitness of dv in a child process.
+//
+// The child sends back to the parent a status byte followed either by
+// the raw bytes of the fitness vector (status 0) or by an error message (status 1).
+vector_double async_fork_fitness(const problem &p, const vector_double &dv)
+{
+    pipe_t pp;
+    const auto child_pid = fork();
+    // LCOV_EXCL_START
+    if (child_pid == -1) {
+        pagmo_throw(std::runtime_error,
+                    "Cannot fork the process in an async_evaluator with the fork() function. The error code is "
+                        + std::to_string(errno) + " and the error message is: '" + std::strerror(errno) + "'");
+    }
+    // LCOV_EXCL_STOP
+    if (child_pid) {
+        // We are in the parent.
+        std::string msg;
+        try {
+            pp.close_w();
+            char buffer[256];
+            while (true) {
+                const auto read_bytes = pp.read(static_cast<void *>(buffer), sizeof(buffer));
+                if (!read_bytes) {
+                    break;
+                }
+                msg.append(buffer, static_cast<std::string::size_type>(read_bytes));
+            }
+            pp.close_r();
+            // LCOV_EXCL_START
+        } catch (...) {
+            ::kill(child_pid, SIGTERM);
+            ::waitpid(child_pid, nullptr, 0);
+            throw;
+        }
+        // LCOV_EXCL_STOP
+        if (::waitpid(child_pid, nullptr, 0) != child_pid) {
+            // LCOV_EXCL_START
+            pagmo_throw(std::runtime_error, "The waitpid() function returned an error while attempting to wait for the "
+                                            "child process in an async_evaluator");
+            // LCOV_EXCL_STOP
+        }
+        if (msg.empty()) {
+            // LCOV_EXCL_START
+            pagmo_throw(std::runtime_error,
+                        "The child process of an async_evaluator terminated without sending back any data");
+            // LCOV_EXCL_STOP
+        }
+        if (msg[0]) {
+            pagmo_throw(std::runtime_error, "The fitness evaluation in the child process of an async_evaluator raised "
+                                            "an error. The full error message reported by the child is:\n"
+                                                + msg.substr(1));
+        }
+        if ((msg.size() - 1u) % sizeof(double)) {
+            // LCOV_EXCL_START
+            pagmo_throw(std::runtime_error,
+                        "The child process of an async_evaluator sent back a corrupted fitness vector");
+            // LCOV_EXCL_STOP
+        }
+        vector_double fv((msg.size() - 1u) / sizeof(double));
+        std::copy(msg.begin() + 1, msg.end(), reinterpret_cast<char *>(fv.data()));
+        prob_check_fv(p, fv.data(), fv.size());
+        return fv;
+    }
+    // LCOV_EXCL_START
+    // We are in the child.
+    // NOTE: the child is forked from a worker thread of a multithreaded
+    // process, hence we exit via _exit() in order to avoid running the destructors
+    // of the global objects (e.g., the TBB scheduler) in a process in which
+    // only the calling thread exists.
+    auto send = [&pp](const char *buf, std::size_t count) {
+        while (count) {
+            const auto written = static_cast<std::size_t>(pp.write(static_cast<const void *>(buf), count));
+            buf += written;
+            count -= written;
+        }
+    };
+    try {
+        pp.close_r();
+        std::string msg(1, '\0');
+        try {
+            const auto fv = p.fitness(dv);
+            msg.append(reinterpret_cast<const char *>(fv.data()), fv.size() * sizeof(double));
+        } catch (const std::exception &e) {
+            msg.assign(1, '\1');
+            msg += e.what();
+        } catch (...) {
+            msg.assign(1, '\1');
+        }
+        send(msg.data(), msg.size());
+        pp.close_w();
+        ::_exit(0);
+    } catch (...) {
+        std::cerr << "An unrecoverable error was raised while trying to send data back to the parent process "
+                     "from the child process of an async_evaluator. Giving up now."
+                  << std::endl;
+        ::_exit(1);
+    }
+    // LCOV_EXCL_STOP
+}
+
+#endif
+
+} // namespace
+
+struct async_evaluator_impl {
+    // An evaluation waiting to be picked up by a worker.
+    struct queued_t {
+        unsigned long long id;
+        vector_double dv;
+        problem *prob;
+    };
+    // A completed evaluation.
+    struct completed_t {
+        unsigned long long id;
+        vector_double dv;
+        vector_double fv;
+        // The error raised during the evaluation, if any.
+        std::exception_ptr eptr;
+    };
+
+    explicit async_evaluator_impl(const problem &p, async_backend backend, unsigned n_workers)
+        : m_prob(p), m_backend(backend),
+          m_n_workers(n_workers ? n_workers : std::max(1u, std::thread::hardware_concurrency())),
+          m_thread_safety(p.get_thread_safety()), m_stop(false)
+    {
+        // NOTE: the workers spend most of their time either inside the fitness
+        // function or blocked waiting for a child process, hence we use
+        // dedicated threads rather than the TBB scheduler, whose concurrency
+        // is tied to the number of cores of the machine.
+        try {
+            for (unsigned i = 0; i < m_n_workers; ++i) {
+                m_threads.emplace_back([this]() { worker(); });
+            }
+            // LCOV_EXCL_START
+        } catch (...) {
+            stop();
+            throw;
+        }
+        // LCOV_EXCL_STOP
+    }
+    ~async_evaluator_impl()
+    {
+        stop();
+    }
+
+    // Stop the workers. The queued evaluations which have not been
+    // started yet are discarded, the evaluations in progress are waited upon.
+    void stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_queue_cv.notify_all();
+        for (auto &t : m_threads) {
+            t.join();
+        }
+        m_threads.clear();
+    }
+
+    // Create a new copy of m_prob for the evaluations.
+    // NOTE: the evaluations are charged to the evaluation budget
+    // of m_prob (if any) upon retrieval, detach the budget from
+    // the copy in order not to charge them twice.
+    problem *new_copy()
+    {
+        m_copies.push_back(std::make_unique<problem>(m_prob));
+        m_copies.back()->set_budget(nullptr);
+        return m_copies.back().get();
+    }
+
+    // Fetch a problem on which an evaluation can be run. Called
+    // from the thread submitting the evaluations, with m_mutex locked.
+    problem *acquire_problem()
+    {
+        if (m_backend == async_backend::fork || m_thread_safety >= thread_safety::constant) {
+            // The evaluations can all be run concurrently on the same object
+            // (in the case of the fork backend, each evaluation will
+            // actually be run on a copy in a child process).
+            if (m_copies.empty()) {
+                new_copy();
+            }
+            return m_copies.front().get();
+        }
+        if (m_free.empty()) {
+            return new_copy();
+        }
+        auto retval = m_free.back();
+        m_free.pop_back();
+        return retval;
+    }
+
+    // The main loop of the worker threads.
+    void worker()
+    {
+        while (true) {
+            queued_t q;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_queue_cv.wait(lock, [this]() { return m_stop || !m_queue.empty(); });
+                if (m_stop) {
+                    break;
+                }
+                q = std::move(m_queue.front());
+                m_queue.pop_front();
+            }
+            completed_t c{q.id, std::move(q.dv), {}, nullptr};
+            {
+                trace_span span("async_evaluation", "async_evaluator", {{"id", static_cast<long long>(q.id)}});
+                try {
+#if defined(PAGMO_WITH_FORK_ISLAND)
+                    if (m_backend == async_backend::fork) {
+                        c.fv = async_fork_fitness(*q.prob, c.dv);
+                    } else {
+                        c.fv = q.prob->fitness(c.dv);
+                    }
+#else
+                    c.fv = q.prob->fitness(c.dv);
+#endif
+                } catch (...) {
+                    c.eptr = std::current_exception();
+                }
+            }
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (m_backend == async_backend::thread && m_thread_safety < thread_safety::constant) {
+                    m_free.push_back(q.prob);
+                }
+                m_completed.push_back(std::move(c));
+            }
+            m_completed_cv.notify_one();
+        }
+    }
+
+    const problem &m_prob;
+    const async_backend m_backend;
+    const unsigned m_n_workers;
+    const thread_safety m_thread_safety;
+    // The problem copies used for the evaluations, and the
+    // copies not currently in use.
+    std::vector<std::unique_ptr<problem>> m_copies;
+    std::vector<problem *> m_free;
+    // The queues of the submitted and completed evaluations.
+    std::deque<queued_t> m_queue;
+    std::deque<completed_t> m_completed;
+    std::size_t m_n_pending = 0;
+    unsigned long long m_next_id = 0;
+    bool m_stop;
+    std::mutex m_mutex;
+    std::condition_variable m_queue_cv;
+    std::condition_variable m_completed_cv;
+    std::vector<std::thread> m_threads;
+};
+
+} // namespace detail
+
+/// Constructor.
+/**
+ * @param p the problem whose fitness function will be evaluated.
+ * @param backend the execution backend.
+ * @param n_workers the maximum number of concurrent evaluations. If zero, the number
+ * of hardware threads will be used.
+ *
+ * @throws std::invalid_argument if \p backend is async_backend::thread and \p p does not provide
+ * at least the thread_safety::basic guarantee, or if \p backend is async_backend::fork and pagmo
+ * was built without support for pagmo::fork_island.
+ * @throws unspecified any exception thrown by memory errors in standard containers.
+ */
+async_evaluator::async_evaluator(const problem &p, async_backend backend, unsigned n_workers)
+{
+    if (backend == async_backend::thread && p.get_thread_safety() < thread_safety::basic) {
+        pagmo_throw(std::invalid_argument, "Cannot use a thread-based async_evaluator on the problem '" + p.get_name()
+                                               + "', which does not provide the required level of thread safety");
+    }
+#if !defined(PAGMO_WITH_FORK_ISLAND)
+    if (backend == async_backend::fork) {
+        pagmo_throw(std::invalid_argument,
+                    "The fork backend of async_evaluator is not available on this platform");
+    }
+#endif
+    m_impl = std::make_unique<detail::async_evaluator_impl>(p, backend, n_workers);
+}
+
+/// Destructor.
+/**
+ * The destructor will wait for the completion of the evaluations in progress. The submitted
+ * evaluations which have not been started yet are discarded.
+ */
+async_evaluator::~async_evaluator() = default;
+
+/// Submit a decision vector for evaluation.
+/**
+ * This method will schedule the evaluation of \p dv and return immediately.
+ *
+ * @param dv the decision vector to be evaluated.
+ *
+ * @return the id of the evaluation, which will be reported alongside its result.
+ *
+ * @throws std::invalid_argument if the size of \p dv is not equal to the dimension of the problem.
+ * @throws unspecified any exception thrown by the copy of the problem or by memory errors in standard containers.
+ */
+unsigned long long async_evaluator::submit(const vector_double &dv)
+{
+    detail::prob_check_dv(m_impl->m_prob, dv.data(), dv.size());
+
+    unsigned long long id;
+    {
+        std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+        auto p = m_impl->acquire_problem();
+        id = m_impl->m_next_id;
+        m_impl->m_queue.push_back({id, dv, p});
+        ++m_impl->m_next_id;
+        ++m_impl->m_n_pending;
+    }
+    m_impl->m_queue_cv.notify_one();
+
+    return id;
+}
+
+/// Fetch a completed evaluation.
+/**
+ * This method returns immediately. The fitness evaluation counter of the problem
+ * used during construction is increased by one if a result is returned, and the evaluation is
+ * charged to the evaluation budget of the problem, if any (see problem::set_budget()).
+ *
+ * @return the oldest completed evaluation whose result has not been retrieved yet, or
+ * an empty optional if no such evaluation exists.
+ *
+ * @throws unspecified any exception raised during the fitness evaluation.
+ */
+boost::optional<async_evaluator::result_type> async_evaluator::poll()
+{
+    detail::async_evaluator_impl::completed_t c;
+    {
+        std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+        if (m_impl->m_completed.empty()) {
+            return {};
+        }
+        c = std::move(m_impl->m_completed.front());
+        m_impl->m_completed.pop_front();
+        --m_impl->m_n_pending;
+    }
+    if (c.eptr) {
+        std::rethrow_exception(c.eptr);
+    }
+    m_impl->m_prob.increment_fevals(1u);
+    detail::prob_check_budget_target(m_impl->m_prob, c.fv.data(), 1u);
+    return result_type(c.id, std::move(c.dv), std::move(c.fv));
+}
+
+/// Wait for a completed evaluation.
+/**
+ * This method blocks until an evaluation is completed. The fitness evaluation counter of the problem
+ * used during construction is increased by one, and the evaluation is charged to the evaluation
+ * budget of the problem, if any (see problem::set_budget()).
+ *
+ * @return the oldest completed evaluation whose result has not been retrieved yet.
+ *
+ * @throws std::invalid_argument if there are no pending evaluations.
+ * @throws unspecified any exception raised during the fitness evaluation.
+ */
+async_evaluator::result_type async_evaluator::wait()
+{
+    detail::async_evaluator_impl::completed_t c;
+    {
+        std::unique_lock<std::mutex> lock(m_impl->m_mutex);
+        if (!m_impl->m_n_pending) {
+            pagmo_throw(std::invalid_argument, "Cannot wait for an evaluation in an async_evaluator which has no "
+                                               "pending evaluations");
+        }
+        m_impl->m_completed_cv.wait(lock, [this]() { return !m_impl->m_completed.empty(); });
+        c = std::move(m_impl->m_completed.front());
+        m_impl->m_completed.pop_front();
+        --m_impl->m_n_pending;
+    }
+    if (c.eptr) {
+        std::rethrow_exception(c.eptr);
+    }
+    m_impl->m_prob.increment_fevals(1u);
+    detail::prob_check_budget_target(m_impl->m_prob, c.fv.data(), 1u);
+    return result_type(c.id, std::move(c.dv), std::move(c.fv));
+}
+
+/// Number of pending evaluations.
+/**
+ * @return the number of submitted evaluations whose result has not been retrieved yet.
+ */
+std::size_t async_evaluator::get_n_pending() const
+{
+    std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+    return m_impl->m_n_pending;
+}
+
+/// Number of workers.
+/**
+ * @return the maximum number of concurrent evaluations.
+ */
+unsigned async_evaluator::get_n_workers() const
+{
+    return m_impl->m_n_workers;
+}
+
+/// Backend.
+/**
+ * @return the execution backend.
+ */
+async_backend async_evaluator::get_backend() const
+{
+    return m_impl->m_backend;
+}
+
+} // namespace pagmo
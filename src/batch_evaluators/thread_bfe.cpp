@@ -78,6 +78,12 @@ vector_double thread_bfe::operator()(problem p, const vector_double &dvs) const
     // we do the sanity checks in the type-erased container.
     assert(dvs.size() % n_dim == 0u);
 
+    // NOTE: the fitness evaluations are charged to the evaluation budget
+    // of the problem (if any) by the bfe wrapping this object. Detach the
+    // budget from the local copy of the problem in order not to charge
+    // the fitness evaluations twice.
+    p.set_budget(nullptr);
+
     // Prepare the return value.
     // Guard against overflow.
     // LCOV_EXCL_START
@@ -38,6 +38,7 @@ see https://www.gnu.org/licenses/. */
 #include <pagmo/detail/bfe_impl.hpp>
 #include <pagmo/detail/type_name.hpp>
 #include <pagmo/problem.hpp>
+#include <pagmo/tracing.hpp>
 #include <pagmo/types.hpp>
 
 // MINGW-specific warnings.
@@ -93,6 +94,8 @@ vector_double bfe::operator()(const problem &p, const vector_double &dvs) const
     // Check the input dvs.
     detail::bfe_check_input_dvs(p, dvs);
 
+    detail::trace_span span("bfe", "bfe", {{"n_dvs", static_cast<long long>(dvs.size() / p.get_nx())}});
+
     // Invoke the call operator from the UDBFE.
     auto retval((*ptr())(p, dvs));
 
@@ -106,6 +109,9 @@ vector_double bfe::operator()(const problem &p, const vector_double &dvs) const
     const auto n_dvs = dvs.size() / p.get_nx();
     p.increment_fevals(boost::numeric_cast<unsigned long long>(n_dvs));
 
+    // Check the fitnesses against the target of the evaluation budget of p, if any.
+    detail::prob_check_budget_target(p, retval.data(), retval.size());
+
     return retval;
 }
 
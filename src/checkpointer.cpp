@@ -0,0 +1,331 @@
+/* Copyright 2017-2020 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#include <cstdio>
+#include <fstream>
+#include <future>
+#include <ios>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <pagmo/archipelago.hpp>
+#include <pagmo/checkpointer.hpp>
+#include <pagmo/detail/task_queue.hpp>
+#include <pagmo/exceptions.hpp>
+#include <pagmo/island.hpp>
+#include <pagmo/s11n.hpp>
+#include <pagmo/topology.hpp>
+
+namespace pagmo
+{
+
+namespace detail
+{
+
+struct checkpointer_impl {
+    explicit checkpointer_impl(std::string dir) : m_dir(std::move(dir)) {}
+
+    // The checkpoint directory.
+    const std::string m_dir;
+    // The versions of the islands as of the last checkpoint.
+    // NOTE: this is protected by a mutex because, in case of errors,
+    // it is reset from the writer thread in order to force a full
+    // checkpoint the next time.
+    std::mutex m_mutex;
+    std::vector<unsigned long long> m_versions;
+    // The futures of the write tasks.
+    std::vector<std::future<void>> m_futures;
+    // The writer thread.
+    // NOTE: this must be the last data member, so that it is destroyed
+    // first: the destructor of task_queue waits for the pending tasks,
+    // which access the other data members.
+    task_queue m_queue;
+};
+
+namespace
+{
+
+// The files of a checkpoint.
+std::string ckpt_archi_file(const std::string &dir)
+{
+    return dir + "/archipelago.ckpt";
+}
+
+std::string ckpt_island_file(const std::string &dir, archipelago::size_type i)
+{
+    return dir + "/island_" + std::to_string(i) + ".ckpt";
+}
+
+// Write a file via the output archive functor f. The data is first written
+// into a temporary file, which is then renamed to filename.
+template <typename F>
+void ckpt_write(const std::string &filename, const F &f)
+{
+    const auto tmp_filename = filename + ".tmp";
+
+    {
+        std::ofstream ofs(tmp_filename, std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!ofs) {
+            pagmo_throw(std::runtime_error,
+                        "Unable to open the file '" + tmp_filename + "' for writing a checkpoint");
+        }
+        {
+            boost::archive::binary_oarchive oarchive(ofs);
+            f(oarchive);
+        }
+        if (!ofs) {
+            pagmo_throw(std::runtime_error, "Error writing the checkpoint file '" + tmp_filename + "'");
+        }
+    }
+
+    if (std::rename(tmp_filename.c_str(), filename.c_str())) {
+        // NOTE: on some platforms, std::rename() fails if the target file
+        // exists already. Remove it and try again.
+        std::remove(filename.c_str());
+        if (std::rename(tmp_filename.c_str(), filename.c_str())) {
+            pagmo_throw(std::runtime_error,
+                        "Unable to rename the file '" + tmp_filename + "' to '" + filename + "'");
+        }
+    }
+}
+
+// Read a file via the input archive functor f.
+template <typename F>
+void ckpt_read(const std::string &filename, const F &f)
+{
+    std::ifstream ifs(filename, std::ios::in | std::ios::binary);
+    if (!ifs) {
+        pagmo_throw(std::runtime_error, "Unable to open the checkpoint file '" + filename + "'");
+    }
+    boost::archive::binary_iarchive iarchive(ifs);
+    f(iarchive);
+}
+
+} // namespace
+
+} // namespace detail
+
+/// Constructor.
+/**
+ * No file is accessed upon construction.
+ *
+ * @param dir the checkpoint directory. The directory must exist.
+ *
+ * @throws unspecified any exception thrown by threading primitives or by memory errors in standard containers.
+ */
+checkpointer::checkpointer(std::string dir) : m_impl(std::make_unique<detail::checkpointer_impl>(std::move(dir))) {}
+
+/// Destructor.
+/**
+ * The destructor will wait for the completion of the pending writes. Any error raised
+ * by the pending writes will be ignored.
+ */
+checkpointer::~checkpointer() = default;
+
+/// Get the checkpoint directory.
+/**
+ * @return a reference to the directory passed upon construction.
+ */
+const std::string &checkpointer::get_directory() const
+{
+    return m_impl->m_dir;
+}
+
+/// Checkpoint an archipelago.
+/**
+ * This method will take a snapshot of the islands of \p archi whose state has changed since the last
+ * checkpoint, and of the archipelago's topology, migrant database, migration type and migrant handling
+ * policy. It will then schedule the writing of the snapshots to disk and return immediately. It is safe to call
+ * this method while \p archi is evolving.
+ *
+ * Errors raised while writing to disk can be retrieved via checkpointer::wait_check(). After a failed write,
+ * the next checkpoint will include all the islands.
+ *
+ * @param archi the archipelago to be checkpointed.
+ *
+ * @return the number of islands that will be written to disk.
+ *
+ * @throws unspecified any exception thrown by the copy constructor of pagmo::island, by the getters of
+ * pagmo::archipelago, by threading primitives or by memory errors in standard containers.
+ */
+archipelago::size_type checkpointer::save(const archipelago &archi)
+{
+    // NOTE: hold the lock for the whole snapshot, so that a concurrent
+    // failure in the writer thread cannot be missed.
+    std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+
+    const auto n = archi.size();
+
+    // Take the snapshots of the islands which changed since
+    // the last checkpoint.
+    // NOTE: the version is read before copying the island. If the island
+    // changes while being copied, the snapshot will be labelled with the old
+    // version and the island will be written again at the next checkpoint.
+    // NOTE: zero is never used as a version number.
+    auto new_versions(m_impl->m_versions);
+    new_versions.resize(n, 0);
+    std::vector<std::pair<archipelago::size_type, island>> snaps;
+    for (archipelago::size_type i = 0; i < n; ++i) {
+        const auto v = archi[i].m_ptr->version.load();
+        if (v != new_versions[i]) {
+            snaps.emplace_back(i, archi[i]);
+            new_versions[i] = v;
+        }
+    }
+    const auto n_snaps = snaps.size();
+
+    // Snapshot the archipelago's data.
+    auto topo = archi.get_topology();
+    auto migrants = archi.get_migrants_db();
+    const auto mt = archi.get_migration_type();
+    const auto mh = archi.get_migrant_handling();
+
+    // Schedule the writes.
+    // NOTE: like in island::evolve(), add an empty future first, so
+    // that we can clean up if enqueue() throws.
+    m_impl->m_futures.emplace_back();
+    try {
+        m_impl->m_futures.back()
+            = m_impl->m_queue.enqueue([impl = m_impl.get(), snaps = std::move(snaps), n, topo = std::move(topo),
+                                       migrants = std::move(migrants), mt, mh]() {
+                  try {
+                      for (const auto &p : snaps) {
+                          detail::ckpt_write(detail::ckpt_island_file(impl->m_dir, p.first),
+                                             [&p](boost::archive::binary_oarchive &oa) { oa << p.second; });
+                      }
+                      // NOTE: write the archipelago file last, so that the
+                      // island files it refers to are already in place.
+                      detail::ckpt_write(detail::ckpt_archi_file(impl->m_dir),
+                                         [&](boost::archive::binary_oarchive &oa) {
+                                             detail::to_archive(oa, n, topo, migrants, mt, mh);
+                                         });
+                  } catch (...) {
+                      // Force a full checkpoint the next time.
+                      std::lock_guard<std::mutex> lk(impl->m_mutex);
+                      impl->m_versions.clear();
+                      throw;
+                  }
+              });
+        // LCOV_EXCL_START
+    } catch (...) {
+        m_impl->m_futures.pop_back();
+        throw;
+        // LCOV_EXCL_STOP
+    }
+
+    // The writes have been scheduled, record the new versions.
+    m_impl->m_versions = std::move(new_versions);
+
+    return n_snaps;
+}
+
+/// Block until all the pending writes have been completed.
+/**
+ * If one or more writes scheduled after the last call to wait_check() failed, the exception
+ * raised by the first failed write will be re-thrown by this method.
+ *
+ * @throws unspecified any exception raised by the pending writes (e.g., std::runtime_error if a
+ * checkpoint file cannot be opened for writing).
+ */
+void checkpointer::wait_check()
+{
+    auto &futures = m_impl->m_futures;
+    for (auto it = futures.begin(); it != futures.end(); ++it) {
+        try {
+            it->get();
+        } catch (...) {
+            // Wait for the remaining writes and clear
+            // the futures before re-throwing.
+            for (it = it + 1; it != futures.end(); ++it) {
+                it->wait();
+            }
+            futures.clear();
+            throw;
+        }
+    }
+    futures.clear();
+}
+
+/// Restore an archipelago from the checkpoint.
+/**
+ * This method will first call checkpointer::wait_check(), and it will then construct a new archipelago from the
+ * files in the checkpoint directory. The islands of the returned archipelago are considered as up to date
+ * with respect to the checkpoint, so that checkpointing them again with save() will write only the islands
+ * that changed after the restore.
+ *
+ * @return the archipelago stored in the checkpoint.
+ *
+ * @throws std::runtime_error if the checkpoint files cannot be opened.
+ * @throws unspecified any exception thrown by checkpointer::wait_check(), by the deserialisation of
+ * the checkpoint files, or by the public interface of pagmo::archipelago.
+ */
+archipelago checkpointer::load()
+{
+    wait_check();
+
+    // Load the archipelago's data.
+    archipelago::size_type n;
+    topology topo;
+    archipelago::migrants_db_t migrants;
+    migration_type mt;
+    migrant_handling mh;
+    detail::ckpt_read(detail::ckpt_archi_file(m_impl->m_dir), [&](boost::archive::binary_iarchive &ia) {
+        detail::from_archive(ia, n, topo, migrants, mt, mh);
+    });
+
+    // Load the islands.
+    archipelago retval;
+    std::vector<unsigned long long> versions;
+    for (archipelago::size_type i = 0; i < n; ++i) {
+        island isl;
+        detail::ckpt_read(detail::ckpt_island_file(m_impl->m_dir, i),
+                          [&isl](boost::archive::binary_iarchive &ia) { ia >> isl; });
+        versions.push_back(isl.m_ptr->version.load());
+        retval.push_back(std::move(isl));
+    }
+
+    // NOTE: set the topology after the push_back() calls, which
+    // would otherwise add vertices to it.
+    retval.set_topology(std::move(topo));
+    retval.set_migrants_db(std::move(migrants));
+    retval.set_migration_type(mt);
+    retval.set_migrant_handling(mh);
+
+    {
+        std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+        m_impl->m_versions = std::move(versions);
+    }
+
+    return retval;
+}
+
+} // namespace pagmo
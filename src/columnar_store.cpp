@@ -0,0 +1,435 @@
+/* Copyright 2017-2020 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <ios>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/interprocess/exceptions.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <pagmo/archipelago.hpp>
+#include <pagmo/columnar_store.hpp>
+#include <pagmo/exceptions.hpp>
+#include <pagmo/population.hpp>
+#include <pagmo/types.hpp>
+
+namespace pagmo
+{
+
+namespace detail
+{
+
+struct columnar_reader_impl {
+    explicit columnar_reader_impl(const std::string &path)
+        : m_path(path), m_file(path.c_str(), boost::interprocess::read_only),
+          m_region(m_file, boost::interprocess::read_only)
+    {
+    }
+
+    const std::string m_path;
+    boost::interprocess::file_mapping m_file;
+    boost::interprocess::mapped_region m_region;
+    std::vector<columnar_snapshot> m_snapshots;
+};
+
+} // namespace detail
+
+namespace
+{
+
+// The layout of a columnar store is:
+//
+// - the file header, consisting of an 8-byte magic string, of a 4-byte
+//   endianness tag and of a 4-byte format version,
+// - a sequence of snapshots, each consisting of a header of 8 unsigned 64-bit
+//   integers (see below) followed by the data of the columns.
+//
+// All the quantities in the file have a size of 4 or 8 bytes and the headers
+// have sizes which are multiples of 8 bytes, so that, when the file is memory-mapped,
+// the columns are suitably aligned.
+constexpr std::array<char, 8> colst_magic = {{'P', 'A', 'G', 'M', 'O', 'C', 'O', 'L'}};
+constexpr std::uint32_t colst_endian_tag = 0x01020304ul;
+constexpr std::uint32_t colst_version = 1;
+constexpr std::size_t colst_file_header_size = 16;
+
+// The header of a snapshot.
+enum colst_snapshot_header_field : std::size_t {
+    // Magic number (for consistency checking).
+    sh_magic,
+    // User-defined tag.
+    sh_tag,
+    // Island index.
+    sh_island,
+    // Number of individuals.
+    sh_size,
+    // Dimension of the decision vectors.
+    sh_nx,
+    // Dimension of the fitness vectors.
+    sh_nf,
+    // 1 if the champion is present, 0 otherwise.
+    sh_champion,
+    // Size in bytes of the data following the header.
+    sh_nbytes,
+    sh_n_fields
+};
+
+using colst_snapshot_header = std::array<std::uint64_t, sh_n_fields>;
+
+// The columns are arrays of unsigned long long and double. Make sure that the headers
+// preserve their alignment (the memory-mapped region itself is page-aligned).
+static_assert(sizeof(unsigned long long) == 8u && sizeof(double) == 8u, "Invalid column element size.");
+static_assert(colst_file_header_size % alignof(unsigned long long) == 0u
+                  && colst_file_header_size % alignof(double) == 0u,
+              "Invalid file header size.");
+static_assert(sizeof(colst_snapshot_header) % alignof(unsigned long long) == 0u
+                  && sizeof(colst_snapshot_header) % alignof(double) == 0u,
+              "Invalid snapshot header size.");
+
+// Access the column of type T beginning at ptr in the memory-mapped region.
+template <typename T>
+const T *colst_column(const char *ptr)
+{
+    assert(reinterpret_cast<std::uintptr_t>(ptr) % alignof(T) == 0u);
+    return static_cast<const T *>(static_cast<const void *>(ptr));
+}
+
+constexpr std::uint64_t colst_snapshot_magic = 0x70616e73706d6773ull;
+
+// Check the file header in the buffer h (of size colst_file_header_size).
+void colst_check_file_header(const char *h, const std::string &path)
+{
+    if (std::memcmp(h, colst_magic.data(), colst_magic.size())) {
+        pagmo_throw(std::invalid_argument, "The file '" + path + "' is not a columnar store");
+    }
+    std::uint32_t endian_tag, version;
+    std::memcpy(&endian_tag, h + 8, sizeof(std::uint32_t));
+    std::memcpy(&version, h + 12, sizeof(std::uint32_t));
+    if (endian_tag != colst_endian_tag) {
+        pagmo_throw(std::invalid_argument, "The columnar store '" + path
+                                               + "' was produced on a machine with a different byte order");
+    }
+    if (version != colst_version) {
+        pagmo_throw(std::invalid_argument, "The columnar store '" + path + "' has a format version of "
+                                               + std::to_string(version) + ", but only version "
+                                               + std::to_string(colst_version) + " is supported");
+    }
+}
+
+// Size in bytes of the data of a snapshot.
+std::uint64_t colst_data_nbytes(std::uint64_t size, std::uint64_t nx, std::uint64_t nf, bool champion)
+{
+    return sizeof(double) * ((1u + nx + nf) * size + (champion ? nx + nf : 0u));
+}
+
+// Write a snapshot of pop into ofs.
+void colst_write_snapshot(std::ofstream &ofs, const population &pop, unsigned long long tag,
+                          unsigned long long island)
+{
+    static_assert(sizeof(unsigned long long) == sizeof(double), "Invalid size for unsigned long long.");
+
+    const auto &prob = pop.get_problem();
+    const auto nx = prob.get_nx();
+    const auto nf = prob.get_nf();
+    // NOTE: the champion is available only for single-objective deterministic problems
+    // and non-empty populations.
+    const auto champion = prob.get_nobj() == 1u && !prob.is_stochastic() && pop.size() > 0u;
+
+    colst_snapshot_header h;
+    h[sh_magic] = colst_snapshot_magic;
+    h[sh_tag] = tag;
+    h[sh_island] = island;
+    h[sh_size] = pop.size();
+    h[sh_nx] = nx;
+    h[sh_nf] = nf;
+    h[sh_champion] = champion;
+    h[sh_nbytes] = colst_data_nbytes(h[sh_size], nx, nf, champion);
+
+    auto write = [&ofs](const void *ptr, std::size_t nbytes) {
+        ofs.write(static_cast<const char *>(ptr), static_cast<std::streamsize>(nbytes));
+    };
+
+    write(h.data(), sizeof(h));
+    write(pop.get_ID().data(), sizeof(unsigned long long) * pop.size());
+    for (const auto &x : pop.get_x()) {
+        write(x.data(), sizeof(double) * nx);
+    }
+    for (const auto &f : pop.get_f()) {
+        write(f.data(), sizeof(double) * nf);
+    }
+    if (champion) {
+        write(pop.champion_x().data(), sizeof(double) * nx);
+        write(pop.champion_f().data(), sizeof(double) * nf);
+    }
+}
+
+// Append the snapshots produced by the functor f to the store at path.
+template <typename F>
+void colst_append(const std::string &path, const F &f)
+{
+    std::ofstream ofs(path, std::ios::out | std::ios::binary | std::ios::app);
+    if (!ofs) {
+        pagmo_throw(std::runtime_error, "Unable to open the columnar store '" + path + "' for writing");
+    }
+    f(ofs);
+    ofs.flush();
+    if (!ofs) {
+        pagmo_throw(std::runtime_error, "Error writing to the columnar store '" + path + "'");
+    }
+}
+
+} // namespace
+
+/// Constructor.
+/**
+ * The constructor will create a new columnar store at \p path, if no file exists at \p path.
+ * Otherwise, the existing columnar store at \p path will be opened for appending.
+ *
+ * @param path the path of the columnar store.
+ *
+ * @throws std::invalid_argument if a file exists at \p path, but it is not a columnar store
+ * compatible with this machine and with this version of pagmo.
+ * @throws std::runtime_error if the file cannot be created or read.
+ * @throws unspecified any exception thrown by memory errors in standard containers.
+ */
+columnar_writer::columnar_writer(std::string path) : m_path(std::move(path))
+{
+    std::ifstream ifs(m_path, std::ios::in | std::ios::binary);
+    if (ifs) {
+        // The file exists, check the header.
+        std::array<char, colst_file_header_size> h{};
+        ifs.read(h.data(), static_cast<std::streamsize>(h.size()));
+        if (ifs.gcount() == 0) {
+            // Empty file, write the header below.
+            ifs.close();
+        } else if (static_cast<std::size_t>(ifs.gcount()) != h.size()) {
+            pagmo_throw(std::invalid_argument, "The file '" + m_path + "' is not a columnar store");
+        } else {
+            colst_check_file_header(h.data(), m_path);
+            return;
+        }
+    }
+
+    std::ofstream ofs(m_path, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!ofs) {
+        pagmo_throw(std::runtime_error, "Unable to create the columnar store '" + m_path + "'");
+    }
+    ofs.write(colst_magic.data(), static_cast<std::streamsize>(colst_magic.size()));
+    ofs.write(reinterpret_cast<const char *>(&colst_endian_tag), sizeof(std::uint32_t));
+    ofs.write(reinterpret_cast<const char *>(&colst_version), sizeof(std::uint32_t));
+    if (!ofs) {
+        pagmo_throw(std::runtime_error, "Error writing to the columnar store '" + m_path + "'");
+    }
+}
+
+/// Get the path of the store.
+/**
+ * @return the path of the columnar store.
+ */
+const std::string &columnar_writer::get_path() const
+{
+    return m_path;
+}
+
+/// Append a population.
+/**
+ * This method will append a snapshot of \p pop at the end of the store. The island index
+ * of the snapshot will be zero.
+ *
+ * @param pop the population to be appended.
+ * @param tag a user-defined tag (e.g., the generation number).
+ *
+ * @throws std::runtime_error if an error occurs while writing to the store.
+ * @throws unspecified any exception thrown by the public interface of pagmo::population.
+ */
+void columnar_writer::append(const population &pop, unsigned long long tag)
+{
+    colst_append(m_path, [&pop, tag](std::ofstream &ofs) { colst_write_snapshot(ofs, pop, tag, 0); });
+}
+
+/// Append the populations of an archipelago.
+/**
+ * This method will append a snapshot of the population of each island of \p archi at the end of the
+ * store. The populations are fetched via pagmo::island::get_population(), and thus this method
+ * can be called while \p archi is evolving.
+ *
+ * @param archi the archipelago whose populations will be appended.
+ * @param tag a user-defined tag (e.g., the generation number).
+ *
+ * @throws std::runtime_error if an error occurs while writing to the store.
+ * @throws unspecified any exception thrown by pagmo::island::get_population().
+ */
+void columnar_writer::append(const archipelago &archi, unsigned long long tag)
+{
+    // NOTE: copy the populations first, so that an error
+    // while fetching them does not leave the store half written.
+    std::vector<population> pops;
+    pops.reserve(archi.size());
+    for (const auto &isl : archi) {
+        pops.push_back(isl.get_population());
+    }
+
+    colst_append(m_path, [&pops, tag](std::ofstream &ofs) {
+        for (decltype(pops.size()) i = 0; i < pops.size(); ++i) {
+            colst_write_snapshot(ofs, pops[i], tag, i);
+        }
+    });
+}
+
+/// Constructor.
+/**
+ * The constructor will memory-map the columnar store at \p path and index its snapshots.
+ *
+ * @param path the path of the columnar store.
+ *
+ * @throws std::invalid_argument if the file at \p path is not a columnar store compatible
+ * with this machine and with this version of pagmo, or if it is corrupted.
+ * @throws std::runtime_error if the file cannot be read or memory-mapped.
+ * @throws unspecified any exception thrown by memory errors in standard containers.
+ */
+columnar_reader::columnar_reader(const std::string &path)
+{
+    {
+        // Check the file header before mapping.
+        std::ifstream ifs(path, std::ios::in | std::ios::binary);
+        if (!ifs) {
+            pagmo_throw(std::runtime_error, "Unable to open the columnar store '" + path + "'");
+        }
+        std::array<char, colst_file_header_size> h{};
+        ifs.read(h.data(), static_cast<std::streamsize>(h.size()));
+        if (static_cast<std::size_t>(ifs.gcount()) != h.size()) {
+            pagmo_throw(std::invalid_argument, "The file '" + path + "' is not a columnar store");
+        }
+        colst_check_file_header(h.data(), path);
+    }
+
+    try {
+        m_impl = std::make_unique<detail::columnar_reader_impl>(path);
+    } catch (const boost::interprocess::interprocess_exception &ie) {
+        pagmo_throw(std::runtime_error,
+                    "Unable to memory-map the columnar store '" + path + "': " + std::string(ie.what()));
+    }
+
+    const auto base = static_cast<const char *>(m_impl->m_region.get_address());
+    const auto fsize = static_cast<std::uint64_t>(m_impl->m_region.get_size());
+
+    std::uint64_t offset = colst_file_header_size;
+    while (fsize - offset >= sizeof(colst_snapshot_header)) {
+        colst_snapshot_header h;
+        std::memcpy(h.data(), base + offset, sizeof(h));
+        if (h[sh_magic] != colst_snapshot_magic
+            || h[sh_nbytes] != colst_data_nbytes(h[sh_size], h[sh_nx], h[sh_nf], h[sh_champion] != 0u)) {
+            pagmo_throw(std::invalid_argument, "The columnar store '" + path
+                                                   + "' is corrupted: invalid snapshot header at offset "
+                                                   + std::to_string(offset));
+        }
+        offset += sizeof(h);
+        if (fsize - offset < h[sh_nbytes]) {
+            // NOTE: the last snapshot has not been written
+            // completely, ignore it.
+            break;
+        }
+
+        columnar_snapshot s;
+        s.m_tag = h[sh_tag];
+        s.m_island = h[sh_island];
+        s.m_size = static_cast<pop_size_t>(h[sh_size]);
+        s.m_nx = static_cast<vector_double::size_type>(h[sh_nx]);
+        s.m_nf = static_cast<vector_double::size_type>(h[sh_nf]);
+
+        auto ptr = base + offset;
+        s.m_ID = colst_column<unsigned long long>(ptr);
+        ptr += sizeof(unsigned long long) * h[sh_size];
+        s.m_x = colst_column<double>(ptr);
+        ptr += sizeof(double) * h[sh_size] * h[sh_nx];
+        s.m_f = colst_column<double>(ptr);
+        ptr += sizeof(double) * h[sh_size] * h[sh_nf];
+        if (h[sh_champion]) {
+            s.m_champion_x = colst_column<double>(ptr);
+            ptr += sizeof(double) * h[sh_nx];
+            s.m_champion_f = colst_column<double>(ptr);
+        }
+        m_impl->m_snapshots.push_back(s);
+
+        offset += h[sh_nbytes];
+    }
+}
+
+columnar_reader::columnar_reader(columnar_reader &&) noexcept = default;
+
+columnar_reader &columnar_reader::operator=(columnar_reader &&) noexcept = default;
+
+columnar_reader::~columnar_reader() = default;
+
+/// Get the path of the store.
+/**
+ * @return the path of the columnar store.
+ */
+const std::string &columnar_reader::get_path() const
+{
+    return m_impl->m_path;
+}
+
+/// Number of snapshots.
+/**
+ * @return the number of snapshots in the store.
+ */
+std::size_t columnar_reader::size() const
+{
+    return m_impl->m_snapshots.size();
+}
+
+/// Access a snapshot.
+/**
+ * @param i the index of the snapshot (in the order in which the snapshots were appended).
+ *
+ * @return the <tt>i</tt>-th snapshot.
+ *
+ * @throws std::out_of_range if \p i is not less than size().
+ */
+columnar_snapshot columnar_reader::operator[](std::size_t i) const
+{
+    if (i >= size()) {
+        pagmo_throw(std::out_of_range, "cannot access the snapshot at index " + std::to_string(i)
+                                           + ": the columnar store contains only " + std::to_string(size())
+                                           + " snapshots");
+    }
+    return m_impl->m_snapshots[i];
+}
+
+} // namespace pagmo
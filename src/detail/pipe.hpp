@@ -0,0 +1,150 @@
+/* Copyright 2017-2020 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#ifndef PAGMO_DETAIL_PIPE_HPP
+#define PAGMO_DETAIL_PIPE_HPP
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#include <sys/types.h>
+#include <unistd.h>
+
+#include <pagmo/exceptions.hpp>
+
+namespace pagmo
+{
+
+namespace detail
+{
+
+// Small RAII wrapper around a pipe.
+struct pipe_t {
+    // Def ctor: will create the pipe.
+    pipe_t() : r_status(true), w_status(true)
+    {
+        int fd[2];
+        // LCOV_EXCL_START
+        if (pipe(fd) == -1) {
+            pagmo_throw(std::runtime_error, "Unable to create a pipe with the pipe() function. The error code is "
+                                                + std::to_string(errno) + " and the error message is: '"
+                                                + std::strerror(errno) + "'");
+        }
+        // LCOV_EXCL_STOP
+        // The pipe was successfully opened, copy over
+        // the r/w descriptors.
+        rd = fd[0];
+        wd = fd[1];
+    }
+    // Try to close the reading end if it has not been closed already.
+    void close_r()
+    {
+        if (r_status) {
+            // LCOV_EXCL_START
+            if (close(rd) == -1) {
+                pagmo_throw(std::runtime_error,
+                            "Unable to close the reading end of a pipe with the close() function. The error code is "
+                                + std::to_string(errno) + " and the error message is: '" + std::strerror(errno) + "'");
+            }
+            // LCOV_EXCL_STOP
+            r_status = false;
+        }
+    }
+    // Try to close the writing end if it has not been closed already.
+    void close_w()
+    {
+        if (w_status) {
+            // LCOV_EXCL_START
+            if (close(wd) == -1) {
+                pagmo_throw(std::runtime_error,
+                            "Unable to close the writing end of a pipe with the close() function. The error code is "
+                                + std::to_string(errno) + " and the error message is: '" + std::strerror(errno) + "'");
+            }
+            // LCOV_EXCL_STOP
+            w_status = false;
+        }
+    }
+    ~pipe_t()
+    {
+        // Attempt to close the pipe on destruction.
+        try {
+            close_r();
+            close_w();
+            // LCOV_EXCL_START
+        } catch (const std::runtime_error &re) {
+            // We are in a dtor, the error is not recoverable.
+            std::cerr << "An unrecoverable error was raised while trying to close a pipe in the pipe's destructor. "
+                         "The full error message is:\n"
+                      << re.what() << "\n\nExiting now." << std::endl;
+            std::exit(1);
+        }
+        // LCOV_EXCL_STOP
+    }
+    // Wrapper around the read() function.
+    ssize_t read(void *buf, std::size_t count) const
+    {
+        auto retval = ::read(rd, buf, count);
+        // LCOV_EXCL_START
+        if (retval == -1) {
+            pagmo_throw(std::runtime_error, "Unable to read from a pipe with the read() function. The error code is "
+                                                + std::to_string(errno) + " and the error message is: '"
+                                                + std::strerror(errno) + "'");
+        }
+        // LCOV_EXCL_STOP
+        return retval;
+    }
+    // Wrapper around the write() function.
+    ssize_t write(const void *buf, std::size_t count) const
+    {
+        auto retval = ::write(wd, buf, count);
+        // LCOV_EXCL_START
+        if (retval == -1) {
+            pagmo_throw(std::runtime_error, "Unable to write to a pipe with the write() function. The error code is "
+                                                + std::to_string(errno) + " and the error message is: '"
+                                                + std::strerror(errno) + "'");
+        }
+        // LCOV_EXCL_STOP
+        return retval;
+    }
+    // The file descriptors of the two ends of the pipe.
+    int rd, wd;
+    // Flag to signal the status of the two ends
+    // of the pipe: true for open, false for closed.
+    bool r_status, w_status;
+};
+
+} // namespace detail
+
+} // namespace pagmo
+
+#endif
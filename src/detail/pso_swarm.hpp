@@ -0,0 +1,185 @@
+/* Copyright 2017-2020 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+
+#ifndef PAGMO_DETAIL_PSO_SWARM_HPP
+#define PAGMO_DETAIL_PSO_SWARM_HPP
+
+#include <cassert>
+#include <random>
+#include <vector>
+
+#include <pagmo/types.hpp>
+
+// Kernels shared by pso and pso_gen. The state of the swarm is stored in
+// row-major matrices (one row per particle), so that the updates of a particle
+// run over contiguous memory. The random coefficients of a particle are drawn
+// before its update, in the same order in which a component-by-component
+// implementation would consume them, so that the update loops themselves
+// do not contain any call to the random engine and can be vectorised.
+
+namespace pagmo
+{
+
+namespace detail
+{
+
+// Draws the random coefficients of the velocity update of a particle for the
+// PSO variants from 1 to 5. r1 and r2 must have the size of the problem dimension.
+template <typename Rng>
+inline void pso_draw_coefficients(unsigned variant, vector_double &r1, vector_double &r2, Rng &r_engine)
+{
+    assert(r1.size() == r2.size());
+    std::uniform_real_distribution<double> drng(0., 1.); // to generate a number in [0, 1)
+    const auto dim = r1.size();
+    switch (variant) {
+        case 1u:
+        case 5u:
+            // Different random numbers for each component.
+            for (decltype(r1.size()) d = 0u; d < dim; ++d) {
+                r1[d] = drng(r_engine);
+                r2[d] = drng(r_engine);
+            }
+            break;
+        case 2u:
+            // Equal random weights of social and cognitive components.
+            for (decltype(r1.size()) d = 0u; d < dim; ++d) {
+                r1[d] = drng(r_engine);
+                r2[d] = r1[d];
+            }
+            break;
+        case 3u: {
+            // Same random numbers for all components.
+            const auto c1 = drng(r_engine);
+            const auto c2 = drng(r_engine);
+            for (decltype(r1.size()) d = 0u; d < dim; ++d) {
+                r1[d] = c1;
+                r2[d] = c2;
+            }
+            break;
+        }
+        default: {
+            assert(variant == 4u);
+            // Same random number for all components and for the social and
+            // cognitive components.
+            const auto c1 = drng(r_engine);
+            for (decltype(r1.size()) d = 0u; d < dim; ++d) {
+                r1[d] = c1;
+                r2[d] = c1;
+            }
+        }
+    }
+}
+
+// Draws the random coefficients of the velocity update of a particle for the FIPS
+// variant (6). On output, r[n * dim + d] is the coefficient of the d-th component
+// of the force exerted by the n-th neighbour.
+template <typename Rng>
+inline void pso_draw_fips_coefficients(vector_double::size_type dim, vector_double::size_type n_neighb,
+                                       vector_double &r, Rng &r_engine)
+{
+    std::uniform_real_distribution<double> drng(0., 1.); // to generate a number in [0, 1)
+    r.resize(dim * n_neighb);
+    for (decltype(dim) d = 0u; d < dim; ++d) {
+        for (decltype(n_neighb) n = 0u; n < n_neighb; ++n) {
+            r[n * dim + d] = drng(r_engine);
+        }
+    }
+}
+
+// Velocity update of a particle for the PSO variants from 1 to 5. v, x, lbx and g are the
+// velocity, the position, the best position of the particle and the best position of its
+// neighbourhood, r1 and r2 the random coefficients drawn by pso_draw_coefficients().
+inline void pso_update_velocity(unsigned variant, double omega, double eta1, double eta2, double *v, const double *x,
+                                const double *lbx, const double *g, const double *r1, const double *r2,
+                                vector_double::size_type dim)
+{
+    if (variant == 5u) {
+        // Constriction coefficients.
+        for (decltype(dim) d = 0u; d < dim; ++d) {
+            v[d] = omega * (v[d] + eta1 * r1[d] * (lbx[d] - x[d]) + eta2 * r2[d] * (g[d] - x[d]));
+        }
+    } else {
+        // Inertia weight.
+        for (decltype(dim) d = 0u; d < dim; ++d) {
+            v[d] = omega * v[d] + eta1 * r1[d] * (lbx[d] - x[d]) + eta2 * r2[d] * (g[d] - x[d]);
+        }
+    }
+}
+
+// Velocity update of a particle for the FIPS variant (6). lbX is the matrix of the best
+// positions of all the particles, neighb the indices of the neighbours of the particle, r the
+// random coefficients drawn by pso_draw_fips_coefficients(). sum_forces is a work buffer
+// of size dim.
+inline void pso_update_velocity_fips(double omega, double acceleration_coefficient, double *v, const double *x,
+                                     const vector_double &lbX, const std::vector<vector_double::size_type> &neighb,
+                                     const double *r, double *sum_forces, vector_double::size_type dim)
+{
+    for (decltype(dim) d = 0u; d < dim; ++d) {
+        sum_forces[d] = 0.;
+    }
+    for (decltype(neighb.size()) n = 0u; n < neighb.size(); ++n) {
+        const auto lbx_n = lbX.data() + neighb[n] * dim;
+        const auto r_n = r + n * dim;
+        for (decltype(dim) d = 0u; d < dim; ++d) {
+            sum_forces[d] += r_n[d] * acceleration_coefficient * (lbx_n[d] - x[d]);
+        }
+    }
+    const auto n_neighb = static_cast<double>(neighb.size());
+    for (decltype(dim) d = 0u; d < dim; ++d) {
+        v[d] = omega * (v[d] + sum_forces[d] / n_neighb);
+    }
+}
+
+// Clamps the velocity v of a particle within [minv, maxv], then moves its position x
+// and performs the feasibility correction (the velocity is zeroed for the components which
+// ended up on the bounds).
+inline void pso_update_position(double *v, double *x, const vector_double &minv, const vector_double &maxv,
+                                const vector_double &lb, const vector_double &ub)
+{
+    const auto dim = lb.size();
+    for (decltype(lb.size()) d = 0u; d < dim; ++d) {
+        auto vd = v[d] > maxv[d] ? maxv[d] : (v[d] < minv[d] ? minv[d] : v[d]);
+        auto new_x = x[d] + vd;
+        if (new_x < lb[d]) {
+            new_x = lb[d];
+            vd = 0.;
+        } else if (new_x > ub[d]) {
+            new_x = ub[d];
+            vd = 0.;
+        }
+        v[d] = vd;
+        x[d] = new_x;
+    }
+}
+
+} // namespace detail
+
+} // namespace pagmo
+
+#endif
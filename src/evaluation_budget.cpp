@@ -0,0 +1,94 @@
+/* Copyright 2017-2020 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#include <atomic>
+#include <cmath>
+#include <stdexcept>
+
+#include <pagmo/evaluation_budget.hpp>
+#include <pagmo/exceptions.hpp>
+
+namespace pagmo
+{
+
+/// Constructor.
+/**
+ * @param max_fevals the maximum number of fitness evaluations (by default, no limit).
+ * @param target the target fitness (by default, no target).
+ *
+ * @throws std::invalid_argument if \p target is NaN.
+ */
+evaluation_budget::evaluation_budget(unsigned long long max_fevals, double target)
+    : m_fevals(0u), m_stop(max_fevals == 0u), m_max_fevals(max_fevals), m_target(target)
+{
+    if (std::isnan(target)) {
+        pagmo_throw(std::invalid_argument, "The target fitness of an evaluation budget cannot be NaN");
+    }
+}
+
+/// Reset the budget.
+/**
+ * This method will set the counter of fitness evaluations to zero and lower the stop flag
+ * (unless the maximum number of fitness evaluations is zero).
+ *
+ * This method must not be called while the budget is being used concurrently by other threads.
+ */
+void evaluation_budget::reset() noexcept
+{
+    m_fevals.store(0u, std::memory_order_relaxed);
+    m_stop.store(m_max_fevals == 0u, std::memory_order_release);
+}
+
+/// Get the number of consumed fitness evaluations.
+/**
+ * @return the number of fitness evaluations consumed so far.
+ */
+unsigned long long evaluation_budget::get_fevals() const noexcept
+{
+    return m_fevals.load(std::memory_order_relaxed);
+}
+
+/// Get the maximum number of fitness evaluations.
+/**
+ * @return the maximum number of fitness evaluations.
+ */
+unsigned long long evaluation_budget::get_max_fevals() const noexcept
+{
+    return m_max_fevals;
+}
+
+/// Get the target fitness.
+/**
+ * @return the target fitness.
+ */
+double evaluation_budget::get_target() const noexcept
+{
+    return m_target;
+}
+
+} // namespace pagmo
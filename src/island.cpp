@@ -28,6 +28,7 @@ see https://www.gnu.org/licenses/. */
 
 #include <pagmo/config.hpp>
 
+#include <atomic>
 #include <cassert>
 #include <chrono>
 #include <exception>
@@ -61,6 +62,7 @@ see https://www.gnu.org/licenses/. */
 #include <pagmo/rng.hpp>
 #include <pagmo/s_policy.hpp>
 #include <pagmo/threading.hpp>
+#include <pagmo/tracing.hpp>
 #include <pagmo/types.hpp>
 
 #if defined(PAGMO_WITH_FORK_ISLAND)
@@ -177,6 +179,13 @@ void default_island_factory(const algorithm &algo, const population &pop, std::u
 std::function<void(const algorithm &, const population &, std::unique_ptr<detail::isl_inner_base> &)> island_factory
     = &default_island_factory;
 
+unsigned long long new_island_version()
+{
+    static std::atomic<unsigned long long> counter(0);
+
+    return ++counter;
+}
+
 // NOTE: thread_island is ok as default choice, as the null_prob/null_algo
 // are both thread safe.
 island_data::island_data()
@@ -343,7 +352,7 @@ void island::evolve(unsigned n)
             // Random engine for use in the migration logic.
             // Wrap it in an optional so that, if we don't need
             // it, we don't waste CPU/memory.
-            boost::optional<std::mt19937> migr_eng;
+            boost::optional<detail::random_engine_type> migr_eng;
 
             // Cache the archi pointer.
             const auto aptr = this->m_ptr->archi_ptr;
@@ -353,6 +362,25 @@ void island::evolve(unsigned n)
             const auto isl_idx = aptr ? aptr->get_island_idx(*this) : 0u;
 
             for (auto i = 0u; i < n; ++i) {
+                // Stop early if the evaluation budget of the problem (if any)
+                // has been exhausted (see problem::set_budget()).
+                {
+                    std::shared_ptr<population> pop_ptr;
+                    {
+                        std::lock_guard<std::mutex> lock(this->m_ptr->pop_mutex);
+                        pop_ptr = this->m_ptr->pop;
+                    }
+                    const auto &budget = pop_ptr->get_problem().get_budget();
+                    if (budget && budget->stop_requested()) {
+                        break;
+                    }
+                }
+
+                // Trace the whole iteration (migration included).
+                detail::trace_span iter_span("island_evolve", "island",
+                                             {{"island", aptr ? static_cast<long long>(isl_idx) : -1ll},
+                                              {"iteration", static_cast<long long>(i)}});
+
                 if (aptr) {
                     // If the island is in an archi, before
                     // launching the evolution migrate the
@@ -367,9 +395,12 @@ void island::evolve(unsigned n)
 
                     // Do something only if we actually have connections.
                     if (connections.first.size()) {
+                        detail::trace_span mig_span("migration", "migration",
+                                                    {{"dst", static_cast<long long>(isl_idx)}});
+
                         // Init the rng engine, if necessary.
                         if (!migr_eng) {
-                            migr_eng.emplace(static_cast<std::mt19937::result_type>(random_device::next()));
+                            migr_eng.emplace(static_cast<detail::random_engine_type::result_type>(random_device::next()));
                         }
 
                         // Fetch the migration type and the migrant handling policy
@@ -410,6 +441,11 @@ void island::evolve(unsigned n)
                                                           ? aptr->get_migrants(src_idx)
                                                           : aptr->extract_migrants(src_idx);
 
+                                detail::trace_instant("migrant_exchange", "migration",
+                                                      {{"src", static_cast<long long>(src_idx)},
+                                                       {"dst", static_cast<long long>(isl_idx)},
+                                                       {"n_migrants", static_cast<long long>(std::get<0>(migrants).size())}});
+
                                 // Extract the migration data from this island.
                                 const auto mig_data = this->get_migration_data();
 
@@ -468,6 +504,12 @@ void island::evolve(unsigned n)
                                                             ? aptr->get_migrants(src_idx)
                                                             : aptr->extract_migrants(src_idx);
 
+                                    detail::trace_instant(
+                                        "migrant_exchange", "migration",
+                                        {{"src", static_cast<long long>(src_idx)},
+                                         {"dst", static_cast<long long>(isl_idx)},
+                                         {"n_migrants", static_cast<long long>(std::get<0>(cur_migrants).size())}});
+
                                     // Add them to the global migrants vector.
                                     std::get<0>(migrants).insert(std::get<0>(migrants).end(),
                                                                  std::get<0>(cur_migrants).begin(),
@@ -747,6 +789,7 @@ void island::set_algorithm(const algorithm &algo)
         // by m_ptr->algo, as we made sure
         // to create a new reference above.
         m_ptr->algo = new_algo_ptr;
+        m_ptr->version.store(detail::new_island_version());
     }
 
     // NOTE: upon exit, the refcount of old_ptr and
@@ -795,6 +838,7 @@ void island::set_population(const population &pop)
         std::lock_guard<std::mutex> lock(m_ptr->pop_mutex);
         old_ptr = m_ptr->pop;
         m_ptr->pop = new_pop_ptr;
+        m_ptr->version.store(detail::new_island_version());
     }
 }
 
@@ -980,6 +1024,8 @@ void island::set_individuals(const individuals_group_t &inds)
         tmp_pop.m_ID = std::move(std::get<0>(tmp_inds));
         tmp_pop.m_x = std::move(std::get<1>(tmp_inds));
         tmp_pop.m_f = std::move(std::get<2>(tmp_inds));
+        // The decision vectors changed, update the deduplication index.
+        tmp_pop.dedup_rebuild();
 
         // Set the new population.
         set_population(tmp_pop);
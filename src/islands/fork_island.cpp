@@ -41,6 +41,7 @@ see https://www.gnu.org/licenses/. */
 #include <string>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include <sys/types.h>
 #include <sys/wait.h>
@@ -52,115 +53,23 @@ see https://www.gnu.org/licenses/. */
 #include <pagmo/islands/fork_island.hpp>
 #include <pagmo/population.hpp>
 #include <pagmo/s11n.hpp>
+#include <pagmo/tracing.hpp>
 
-namespace pagmo
-{
+#include "../detail/pipe.hpp"
 
-namespace detail
+namespace pagmo
 {
 
 namespace
 {
 
-// Small RAII wrapper around a pipe.
-struct pipe_t {
-    // Def ctor: will create the pipe.
-    pipe_t() : r_status(true), w_status(true)
-    {
-        int fd[2];
-        // LCOV_EXCL_START
-        if (pipe(fd) == -1) {
-            pagmo_throw(std::runtime_error, "Unable to create a pipe with the pipe() function. The error code is "
-                                                + std::to_string(errno) + " and the error message is: '"
-                                                + std::strerror(errno) + "'");
-        }
-        // LCOV_EXCL_STOP
-        // The pipe was successfully opened, copy over
-        // the r/w descriptors.
-        rd = fd[0];
-        wd = fd[1];
-    }
-    // Try to close the reading end if it has not been closed already.
-    void close_r()
-    {
-        if (r_status) {
-            // LCOV_EXCL_START
-            if (close(rd) == -1) {
-                pagmo_throw(std::runtime_error,
-                            "Unable to close the reading end of a pipe with the close() function. The error code is "
-                                + std::to_string(errno) + " and the error message is: '" + std::strerror(errno) + "'");
-            }
-            // LCOV_EXCL_STOP
-            r_status = false;
-        }
-    }
-    // Try to close the writing end if it has not been closed already.
-    void close_w()
-    {
-        if (w_status) {
-            // LCOV_EXCL_START
-            if (close(wd) == -1) {
-                pagmo_throw(std::runtime_error,
-                            "Unable to close the writing end of a pipe with the close() function. The error code is "
-                                + std::to_string(errno) + " and the error message is: '" + std::strerror(errno) + "'");
-            }
-            // LCOV_EXCL_STOP
-            w_status = false;
-        }
-    }
-    ~pipe_t()
-    {
-        // Attempt to close the pipe on destruction.
-        try {
-            close_r();
-            close_w();
-            // LCOV_EXCL_START
-        } catch (const std::runtime_error &re) {
-            // We are in a dtor, the error is not recoverable.
-            std::cerr << "An unrecoverable error was raised while trying to close a pipe in the pipe's destructor. "
-                         "The full error message is:\n"
-                      << re.what() << "\n\nExiting now." << std::endl;
-            std::exit(1);
-        }
-        // LCOV_EXCL_STOP
-    }
-    // Wrapper around the read() function.
-    ssize_t read(void *buf, std::size_t count) const
-    {
-        auto retval = ::read(rd, buf, count);
-        // LCOV_EXCL_START
-        if (retval == -1) {
-            pagmo_throw(std::runtime_error, "Unable to read from a pipe with the read() function. The error code is "
-                                                + std::to_string(errno) + " and the error message is: '"
-                                                + std::strerror(errno) + "'");
-        }
-        // LCOV_EXCL_STOP
-        return retval;
-    }
-    // Wrapper around the write() function.
-    ssize_t write(const void *buf, std::size_t count) const
-    {
-        auto retval = ::write(wd, buf, count);
-        // LCOV_EXCL_START
-        if (retval == -1) {
-            pagmo_throw(std::runtime_error, "Unable to write to a pipe with the write() function. The error code is "
-                                                + std::to_string(errno) + " and the error message is: '"
-                                                + std::strerror(errno) + "'");
-        }
-        // LCOV_EXCL_STOP
-        return retval;
-    }
-    // The file descriptors of the two ends of the pipe.
-    int rd, wd;
-    // Flag to signal the status of the two ends
-    // of the pipe: true for open, false for closed.
-    bool r_status, w_status;
-};
+// Size of the chunks of data transferred through the pipe between
+// the child process and the parent. Large populations are transferred
+// with a small number of system calls.
+constexpr std::size_t fork_island_buffer_size = 1u << 16;
 
 } // namespace
 
-} // namespace detail
-
 void fork_island::run_evolve(island &isl) const
 {
     // The structure we use to pass messages from the child to the parent:
@@ -199,20 +108,24 @@ void fork_island::run_evolve(island &isl) const
             std::atomic<pid_t> &m_ap;
         };
         pid_setter ps(m_pid, child_pid);
+        // Trace the lifetime of the child process.
+        // NOTE: the span ends after the child has been waited upon
+        // (or when an error is raised).
+        detail::trace_span span("fork_island_child", "fork_island", {{"pid", static_cast<long long>(child_pid)}});
         try {
             // Close the write descriptor, we don't need to send anything to the child.
             p.close_w();
             {
                 // Prepare a local buffer and a stringstream, then read the data from the child.
-                char buffer[100];
+                std::vector<char> buffer(fork_island_buffer_size);
                 std::stringstream ss;
                 while (true) {
-                    const auto read_bytes = p.read(static_cast<void *>(buffer), sizeof(buffer));
+                    const auto read_bytes = p.read(static_cast<void *>(buffer.data()), buffer.size());
                     if (!read_bytes) {
                         // EOF, break out.
                         break;
                     }
-                    ss.write(buffer, static_cast<std::streamsize>(read_bytes));
+                    ss.write(buffer.data(), static_cast<std::streamsize>(read_bytes));
                 }
                 boost::archive::binary_iarchive iarchive(ss);
                 iarchive >> m;
@@ -275,18 +188,22 @@ void fork_island::run_evolve(island &isl) const
             oarchive << ms;
         };
         auto send_ss = [&p](std::stringstream &ss) {
-            // NOTE: make the buffer small enough that its size can be represented by any
-            // integral type.
-            char buffer[100];
+            std::vector<char> buffer(fork_island_buffer_size);
             std::size_t read_bytes;
             while (!ss.eof()) {
                 // Copy a chunk of data from the stream to the local buffer.
-                ss.read(buffer, static_cast<std::streamsize>(sizeof(buffer)));
+                ss.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
                 // Figure out how much we actually read.
                 read_bytes = static_cast<std::size_t>(ss.gcount());
-                assert(read_bytes <= sizeof(buffer));
+                assert(read_bytes <= buffer.size());
                 // Now let's send the current content of the buffer to the parent.
-                p.write(static_cast<const void *>(buffer), read_bytes);
+                // NOTE: write() may write less data than requested.
+                const char *ptr = buffer.data();
+                while (read_bytes) {
+                    const auto written = static_cast<std::size_t>(p.write(static_cast<const void *>(ptr), read_bytes));
+                    ptr += written;
+                    read_bytes -= written;
+                }
             }
         };
         // Fatal error message.
@@ -112,7 +112,8 @@ population::population(const population &) = default;
 population::population(population &&pop) noexcept
     : m_prob(std::move(pop.m_prob)), m_ID(std::move(pop.m_ID)), m_x(std::move(pop.m_x)), m_f(std::move(pop.m_f)),
       m_champion_x(std::move(pop.m_champion_x)), m_champion_f(std::move(pop.m_champion_f)), m_e(std::move(pop.m_e)),
-      m_seed(std::move(pop.m_seed))
+      m_seed(std::move(pop.m_seed)), m_dedup_index(std::move(pop.m_dedup_index)), m_dedup(pop.m_dedup),
+      m_dedup_hits(pop.m_dedup_hits)
 {
 }
 
@@ -151,6 +152,9 @@ population &population::operator=(population &&pop) noexcept
         m_champion_f = std::move(pop.m_champion_f);
         m_e = std::move(pop.m_e);
         m_seed = std::move(pop.m_seed);
+        m_dedup_index = std::move(pop.m_dedup_index);
+        m_dedup = pop.m_dedup;
+        m_dedup_hits = pop.m_dedup_hits;
     }
     return *this;
 }
@@ -266,7 +270,7 @@ vector_double population::random_decision_vector() const
  * @throws std::overflow_error if the size of the population exceeds an implementation-defined limit.
  * @throws std::invalid_argument if the problem is multiobjective and thus
  * a best individual is not well defined, or if the population is empty.
- * @throws unspecified any exception thrown by pagmo::sort_population_con().
+ * @throws unspecified any exception thrown by pagmo::min_element_population_con().
  */
 population::size_type population::best_idx() const
 {
@@ -282,7 +286,7 @@ population::size_type population::best_idx() const
  * @throws std::overflow_error if the size of the population exceeds an implementation-defined limit.
  * @throws std::invalid_argument if the problem is multiobjective and thus
  * a best individual is not well defined, or if the population is empty.
- * @throws unspecified any exception thrown by pagmo::sort_population_con().
+ * @throws unspecified any exception thrown by pagmo::min_element_population_con().
  */
 population::size_type population::best_idx(const vector_double &tol) const
 {
@@ -292,8 +296,8 @@ population::size_type population::best_idx(const vector_double &tol) const
     if (m_prob.get_nobj() > 1u) {
         pagmo_throw(std::invalid_argument, "The best individual can only be extracted in single objective problems");
     }
-    if (m_prob.get_nc() > 0u) { // TODO: should we also code a min_element_population_con?
-        return sort_population_con(m_f, m_prob.get_nec(), tol)[0];
+    if (m_prob.get_nc() > 0u) {
+        return min_element_population_con(m_f, m_prob.get_nec(), tol);
     }
     // Overflow check on the iterator diff type.
     using it_diff_t = std::iterator_traits<decltype(m_f.begin())>::difference_type;
@@ -342,7 +346,7 @@ population::size_type population::best_idx(double tol) const
  * @throws std::overflow_error if the size of the population exceeds an implementation-defined limit.
  * @throws std::invalid_argument if the problem is multiobjective and thus
  * a worst individual is not well defined, or if the population is empty.
- * @throws unspecified any exception thrown by pagmo::sort_population_con().
+ * @throws unspecified any exception thrown by pagmo::max_element_population_con().
  */
 population::size_type population::worst_idx() const
 {
@@ -366,7 +370,7 @@ population::size_type population::worst_idx() const
  * @throws std::overflow_error if the size of the population exceeds an implementation-defined limit.
  * @throws std::invalid_argument if the problem is multiobjective and thus
  * a worst individual is not well defined, or if the population is empty.
- * @throws unspecified any exception thrown by pagmo::sort_population_con().
+ * @throws unspecified any exception thrown by pagmo::max_element_population_con().
  */
 population::size_type population::worst_idx(const vector_double &tol) const
 {
@@ -377,8 +381,8 @@ population::size_type population::worst_idx(const vector_double &tol) const
         pagmo_throw(std::invalid_argument,
                     "The worst element of a population can only be extracted in single objective problems");
     }
-    if (m_prob.get_nc() > 0u) { // TODO: should we also code a min_element_population_con?
-        return sort_population_con(m_f, m_prob.get_nec(), tol).back();
+    if (m_prob.get_nc() > 0u) {
+        return max_element_population_con(m_f, m_prob.get_nec(), tol);
     }
     // Overflow check on the iterator diff type.
     using it_diff_t = std::iterator_traits<decltype(m_f.begin())>::difference_type;
@@ -509,7 +513,26 @@ void population::set_xf(size_type i, const vector_double &x, const vector_double
     m_x[i].reserve(x.size());
     m_f[i].reserve(f.size());
 
-    update_champion(x, f);
+    if (m_dedup) {
+        // Add the new decision vector to the index, and remove
+        // the old one after the champion has been updated.
+        const auto new_it = m_dedup_index.emplace(detail::hash_vf<double>{}(x), i);
+        try {
+            update_champion(x, f);
+        } catch (...) {
+            m_dedup_index.erase(new_it);
+            throw;
+        }
+        const auto range = m_dedup_index.equal_range(detail::hash_vf<double>{}(m_x[i]));
+        for (auto it = range.first; it != range.second; ++it) {
+            if (it != new_it && it->second == i) {
+                m_dedup_index.erase(it);
+                break;
+            }
+        }
+    } else {
+        update_champion(x, f);
+    }
     // Use resize + std::copy: since we reserved enough space above, none of this
     // can throw.
     m_x[i].resize(x.size());
@@ -541,6 +564,68 @@ void population::set_x(size_type i, const vector_double &x)
     set_xf(i, x, m_prob.fitness(x));
 }
 
+/// Enable or disable the deduplication index.
+/**
+ * If \p dedup is \p true, an index of the decision vectors of the individuals will be built and kept up to date
+ * as the population changes. Via lookup_f(), algorithms can then reuse the fitness of an individual for a
+ * new decision vector identical to the decision vector of the individual, instead of re-evaluating it.
+ * The decision vectors are compared component-wise, considering NaNs equal to each other.
+ *
+ * If \p dedup is \p false, the index is destroyed. The index is disabled by default.
+ *
+ * \verbatim embed:rst:leading-asterisk
+ * .. note::
+ *
+ *    The index is a pure cache: it is not serialised (it is rebuilt upon deserialisation), and it
+ *    does not alter the decision and fitness vectors of the population.
+ *
+ * \endverbatim
+ *
+ * @param dedup the desired status of the deduplication index.
+ *
+ * @throws std::invalid_argument if \p dedup is \p true and the problem is stochastic.
+ * @throws unspecified any exception thrown by memory errors in standard containers.
+ */
+void population::set_dedup(bool dedup)
+{
+    if (dedup && m_prob.is_stochastic()) {
+        pagmo_throw(std::invalid_argument,
+                    "The deduplication index cannot be enabled on a population whose problem is stochastic");
+    }
+    m_dedup = dedup;
+    dedup_rebuild();
+}
+
+/// Fetch the fitness of a decision vector from the deduplication index.
+/**
+ * If the deduplication index is enabled (see set_dedup()) and the population contains an individual
+ * whose decision vector is identical to \p x, then the fitness of such individual will be copied
+ * into \p f, the counter returned by get_dedup_hits() will be increased by one, and \p true will be returned.
+ * Otherwise, \p f is left untouched and \p false is returned.
+ *
+ * @param x the decision vector to be looked up.
+ * @param f the output fitness vector.
+ *
+ * @return \p true if the fitness of \p x was found in the index, \p false otherwise.
+ *
+ * @throws unspecified any exception thrown by memory errors in standard containers.
+ */
+bool population::lookup_f(const vector_double &x, vector_double &f)
+{
+    if (!m_dedup) {
+        return false;
+    }
+    const auto range = m_dedup_index.equal_range(detail::hash_vf<double>{}(x));
+    for (auto it = range.first; it != range.second; ++it) {
+        if (detail::equal_to_vf<double>{}(m_x[it->second], x)) {
+            f = m_f[it->second];
+            ++m_dedup_hits;
+            return true;
+        }
+    }
+    return false;
+}
+
 /// Streaming operator for pagmo::population.
 /**
  * @param os target stream.
@@ -563,6 +648,9 @@ std::ostream &operator<<(std::ostream &os, const population &p)
         stream(os, "\nChampion decision vector: ", p.champion_x(), '\n');
         stream(os, "Champion fitness: ", p.champion_f(), '\n');
     }
+    if (p.get_dedup()) {
+        stream(os, "\nFitness evaluations saved by deduplication: ", p.get_dedup_hits(), '\n');
+    }
     return os;
 }
 
@@ -595,13 +683,20 @@ void population::push_back_impl(T &&x, U &&f)
 
     // Here we make sure that if the push back is unsuccessful, the population state is left unchanged.
     const auto n = m_ID.size();
+    auto dedup_it = m_dedup_index.end();
     try {
         m_ID.push_back(new_id);
         m_x.push_back(std::move(x_copy));
         m_f.push_back(std::move(f_copy));
+        if (m_dedup) {
+            dedup_it = m_dedup_index.emplace(detail::hash_vf<double>{}(m_x.back()), n);
+        }
         // update_champion() either throws before modifying anything, or it completes successfully.
         update_champion(m_x.back(), m_f.back());
     } catch (...) {
+        if (dedup_it != m_dedup_index.end()) {
+            m_dedup_index.erase(dedup_it);
+        }
         m_ID.resize(n);
         m_x.resize(n);
         m_f.resize(n);
@@ -609,8 +704,10 @@ void population::push_back_impl(T &&x, U &&f)
     }
 }
 
-// Short routine to update the champion. Does nothing if the problem is MO
-void population::update_champion(vector_double x, vector_double f)
+// Short routine to update the champion. Does nothing if the problem is MO.
+// x and f are copied only if the champion changes. Either throws before modifying anything,
+// or completes successfully.
+void population::update_champion(const vector_double &x, const vector_double &f)
 {
     assert(f.size() > 0u);
     // If the problem has multiple objectives do nothing
@@ -618,22 +715,23 @@ void population::update_champion(vector_double x, vector_double f)
         return;
     }
     // If the champion does not exist create it, otherwise update it if worse than the new solution
+    bool improved;
     if (m_champion_x.size() == 0u) {
-        m_champion_x = std::move(x);
-        m_champion_f = std::move(f);
+        improved = true;
     } else if (m_prob.get_nc() == 0u) { // unconstrained
         // NOTE: make sure to use the custom comparison less_than_f(),
         // so that we handle NaN correctly (i.e., a fitness of NaN is
         // considered worse than any other value).
-        if (detail::less_than_f(f[0], m_champion_f[0])) {
-            m_champion_x = std::move(x);
-            m_champion_f = std::move(f);
-        }
+        improved = detail::less_than_f(f[0], m_champion_f[0]);
     } else { // constrained
-        if (compare_fc(f, m_champion_f, m_prob.get_nec(), m_prob.get_c_tol())) {
-            m_champion_x = std::move(x);
-            m_champion_f = std::move(f);
-        }
+        improved = compare_fc(f, m_champion_f, m_prob.get_nec(), m_prob.get_c_tol());
+    }
+    if (improved) {
+        // Reserve space first, so that the assignments below cannot throw.
+        m_champion_x.reserve(x.size());
+        m_champion_f.reserve(f.size());
+        m_champion_x.assign(x.begin(), x.end());
+        m_champion_f.assign(f.begin(), f.end());
     }
 }
 
@@ -643,6 +741,21 @@ void population::clear()
     m_ID.clear();
     m_x.clear();
     m_f.clear();
+    m_dedup_index.clear();
+}
+
+// Rebuild the deduplication index from scratch (or destroy
+// it, if disabled). If this throws, the index will contain
+// only a subset of the individuals, which is still consistent.
+void population::dedup_rebuild()
+{
+    m_dedup_index.clear();
+    if (m_dedup) {
+        m_dedup_index.reserve(m_x.size());
+        for (size_type i = 0; i < m_x.size(); ++i) {
+            m_dedup_index.emplace(detail::hash_vf<double>{}(m_x[i]), i);
+        }
+    }
 }
 
 } // namespace pagmo
@@ -186,6 +186,15 @@ void problem::generic_ctor_impl()
     // 4 - Presence of batch_fitness().
     // NOTE: all these m_has_* attributes refer to the presence of the features in the UDP.
     m_has_batch_fitness = ptr()->has_batch_fitness();
+    // Presence of scalar_fitness(), which is allowed only if
+    // the fitness has a single component.
+    m_has_scalar_fitness = ptr()->has_scalar_fitness();
+    if (m_has_scalar_fitness && m_nobj + m_nec + m_nic != 1u) {
+        pagmo_throw(std::invalid_argument,
+                    "A UDP providing the scalar_fitness() method must have a fitness of dimension 1, but the dimension "
+                    "of the fitness of the UDP '"
+                        + ptr()->get_name() + "' is " + std::to_string(m_nobj + m_nec + m_nic));
+    }
     // 5 - Presence of gradient and its sparsity.
     m_has_gradient = ptr()->has_gradient();
     m_has_gradient_sparsity = ptr()->has_gradient_sparsity();
@@ -241,7 +250,13 @@ void problem::generic_ctor_impl()
 
 /// Copy constructor.
 /**
- * The copy constructor will deep copy the input problem \p other.
+ * The copy constructor will deep copy the input problem \p other. If the UDP provides the
+ * thread_safety::constant guarantee, however, the UDP will not be copied: \p this and \p other will
+ * share the same UDP instance, which will be copied only if a mutable reference to it is requested later
+ * (e.g., via the non-const overload of extract() or via set_seed()). In this case, copying a problem
+ * does not copy the state of the UDP (e.g., large lookup tables), but the evaluation counters
+ * and the other properties of the problem are still copied. Note that, in this case, modifying the UDP
+ * via a mutable pointer obtained *before* the copy will affect both problems.
  *
  * @param other the problem to be copied.
  *
@@ -250,14 +265,17 @@ void problem::generic_ctor_impl()
  * - the copying of the internal UDP.
  */
 problem::problem(const problem &other)
-    : m_ptr(other.ptr()->clone()), m_fevals(other.m_fevals.load(std::memory_order_relaxed)),
+    : m_ptr(other.m_thread_safety >= thread_safety::constant ? other.m_ptr : other.ptr()->clone()),
+      m_fevals(other.m_fevals.load(std::memory_order_relaxed)),
       m_gevals(other.m_gevals.load(std::memory_order_relaxed)),
-      m_hevals(other.m_hevals.load(std::memory_order_relaxed)), m_lb(other.m_lb), m_ub(other.m_ub),
+      m_hevals(other.m_hevals.load(std::memory_order_relaxed)), m_budget(other.m_budget), m_lb(other.m_lb),
+      m_ub(other.m_ub),
       m_nobj(other.m_nobj), m_nec(other.m_nec), m_nic(other.m_nic), m_nix(other.m_nix), m_c_tol(other.m_c_tol),
-      m_has_batch_fitness(other.m_has_batch_fitness), m_has_gradient(other.m_has_gradient),
-      m_has_gradient_sparsity(other.m_has_gradient_sparsity), m_has_hessians(other.m_has_hessians),
-      m_has_hessians_sparsity(other.m_has_hessians_sparsity), m_has_set_seed(other.m_has_set_seed),
-      m_name(other.m_name), m_gs_dim(other.m_gs_dim), m_hs_dim(other.m_hs_dim), m_thread_safety(other.m_thread_safety)
+      m_has_batch_fitness(other.m_has_batch_fitness), m_has_scalar_fitness(other.m_has_scalar_fitness),
+      m_has_gradient(other.m_has_gradient), m_has_gradient_sparsity(other.m_has_gradient_sparsity),
+      m_has_hessians(other.m_has_hessians), m_has_hessians_sparsity(other.m_has_hessians_sparsity),
+      m_has_set_seed(other.m_has_set_seed), m_name(other.m_name), m_gs_dim(other.m_gs_dim), m_hs_dim(other.m_hs_dim),
+      m_thread_safety(other.m_thread_safety)
 {
 }
 
@@ -268,13 +286,15 @@ problem::problem(const problem &other)
 problem::problem(problem &&other) noexcept
     : m_ptr(std::move(other.m_ptr)), m_fevals(other.m_fevals.load(std::memory_order_relaxed)),
       m_gevals(other.m_gevals.load(std::memory_order_relaxed)),
-      m_hevals(other.m_hevals.load(std::memory_order_relaxed)), m_lb(std::move(other.m_lb)),
+      m_hevals(other.m_hevals.load(std::memory_order_relaxed)), m_budget(std::move(other.m_budget)),
+      m_lb(std::move(other.m_lb)),
       m_ub(std::move(other.m_ub)), m_nobj(other.m_nobj), m_nec(other.m_nec), m_nic(other.m_nic), m_nix(other.m_nix),
       m_c_tol(std::move(other.m_c_tol)), m_has_batch_fitness(other.m_has_batch_fitness),
-      m_has_gradient(other.m_has_gradient), m_has_gradient_sparsity(other.m_has_gradient_sparsity),
-      m_has_hessians(other.m_has_hessians), m_has_hessians_sparsity(other.m_has_hessians_sparsity),
-      m_has_set_seed(other.m_has_set_seed), m_name(std::move(other.m_name)), m_gs_dim(other.m_gs_dim),
-      m_hs_dim(other.m_hs_dim), m_thread_safety(std::move(other.m_thread_safety))
+      m_has_scalar_fitness(other.m_has_scalar_fitness), m_has_gradient(other.m_has_gradient),
+      m_has_gradient_sparsity(other.m_has_gradient_sparsity), m_has_hessians(other.m_has_hessians),
+      m_has_hessians_sparsity(other.m_has_hessians_sparsity), m_has_set_seed(other.m_has_set_seed),
+      m_name(std::move(other.m_name)), m_gs_dim(other.m_gs_dim), m_hs_dim(other.m_hs_dim),
+      m_thread_safety(std::move(other.m_thread_safety))
 {
 }
 
@@ -291,6 +311,7 @@ problem &problem::operator=(problem &&other) noexcept
         m_fevals.store(other.m_fevals.load(std::memory_order_relaxed), std::memory_order_relaxed);
         m_gevals.store(other.m_gevals.load(std::memory_order_relaxed), std::memory_order_relaxed);
         m_hevals.store(other.m_hevals.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        m_budget = std::move(other.m_budget);
         m_lb = std::move(other.m_lb);
         m_ub = std::move(other.m_ub);
         m_nobj = other.m_nobj;
@@ -299,6 +320,7 @@ problem &problem::operator=(problem &&other) noexcept
         m_nix = other.m_nix;
         m_c_tol = std::move(other.m_c_tol);
         m_has_batch_fitness = other.m_has_batch_fitness;
+        m_has_scalar_fitness = other.m_has_scalar_fitness;
         m_has_gradient = other.m_has_gradient;
         m_has_gradient_sparsity = other.m_has_gradient_sparsity;
         m_has_hessians = other.m_has_hessians;
@@ -375,6 +397,12 @@ vector_double problem::fitness(const vector_double &dv) const
     // NOTE: this is an atomic variable, thread-safe.
     increment_fevals(1);
 
+    // 5 - checks the fitness against the target of the evaluation budget
+    // NOTE: the budget is thread-safe.
+    if (m_budget) {
+        detail::prob_check_budget_target(*this, retval.data(), 1);
+    }
+
     return retval;
 }
 
@@ -425,6 +453,83 @@ vector_double problem::batch_fitness(const vector_double &dvs) const
     return retval;
 }
 
+/// Scalar fitness.
+/**
+ * This method will return the fitness of the input decision vector \p dv for a problem whose
+ * fitness has a single component (i.e., an unconstrained single-objective problem),
+ * avoiding the creation of a fitness vector if possible.
+ *
+ * If the UDP satisfies pagmo::has_scalar_fitness, this method will forward a pointer to the data of \p dv
+ * to the <tt>%scalar_fitness()</tt> method of the UDP after sanity checks, and return its output.
+ * Otherwise, the <tt>%fitness()</tt> method of the UDP will be invoked, and its only component returned.
+ * In both cases, the fitness evaluation counter is increased by one.
+ *
+ * @param dv the decision vector to be evaluated.
+ *
+ * @return the fitness of \p dv.
+ *
+ * @throws std::invalid_argument if either
+ * - the dimension of the fitness of the problem is not 1,
+ * - the length of \p dv differs from the value returned by get_nx(),
+ * - the length of the fitness vector returned by the <tt>%fitness()</tt> method of the UDP
+ *   differs from 1.
+ * @throws unspecified any exception thrown by the <tt>%fitness()</tt> or <tt>%scalar_fitness()</tt> methods of the
+ * UDP.
+ */
+double problem::scalar_fitness(const vector_double &dv) const
+{
+    if (get_nf() != 1u) {
+        pagmo_throw(std::invalid_argument, "The scalar_fitness() method can be invoked only on problems whose "
+                                           "fitness has a single component, but the dimension of the fitness of the "
+                                           "problem '"
+                                               + get_name() + "' is " + std::to_string(get_nf()));
+    }
+    detail::prob_check_dv(*this, dv.data(), dv.size());
+
+    double retval;
+    if (m_has_scalar_fitness) {
+        retval = ptr()->scalar_fitness(dv.data());
+    } else {
+        const auto fv = ptr()->fitness(dv);
+        detail::prob_check_fv(*this, fv.data(), fv.size());
+        retval = fv[0];
+    }
+
+    increment_fevals(1);
+    if (m_budget) {
+        m_budget->check_target(retval);
+    }
+
+    return retval;
+}
+
+/// Set the evaluation budget.
+/**
+ * This method will set the evaluation budget of \p this to \p budget. The budget is shared by \p this
+ * and all its subsequent copies (including the copies stored in populations, islands and archipelagos
+ * constructed from \p this), and it is charged with all the fitness evaluations counted by
+ * problem::increment_fevals(). If the fitness of the problem has a single component, the fitnesses computed
+ * via problem::fitness(), problem::batch_fitness(), problem::scalar_fitness() and pagmo::bfe are also checked
+ * against the target of the budget (see pagmo::evaluation_budget).
+ *
+ * A null \p budget detaches \p this from its current budget, if any.
+ *
+ * \verbatim embed:rst:leading-asterisk
+ * .. note::
+ *
+ *    The evaluation budget is not serialised. In particular, the problems of islands whose evolution
+ *    takes place in a separate process (e.g., via :cpp:class:`pagmo::fork_island`) will not be
+ *    connected to the budget.
+ *
+ * \endverbatim
+ *
+ * @param budget the new evaluation budget.
+ */
+void problem::set_budget(std::shared_ptr<evaluation_budget> budget)
+{
+    m_budget = std::move(budget);
+}
+
 /// Gradient.
 /**
  * This method will compute the gradient of the input decision vector \p dv by invoking
@@ -803,6 +908,7 @@ std::ostream &operator<<(std::ostream &os, const problem &p)
     os << "\tUpper bounds: ";
     stream(os, p.get_bounds().second, '\n');
     stream(os, "\tHas batch fitness evaluation: ", p.has_batch_fitness(), '\n');
+    stream(os, "\tHas scalar fitness evaluation: ", p.has_scalar_fitness(), '\n');
     stream(os, "\n\tHas gradient: ", p.has_gradient(), '\n');
     stream(os, "\tUser implemented gradient sparsity: ", p.has_gradient_sparsity(), '\n');
     if (p.has_gradient()) {
@@ -978,11 +1084,33 @@ vector_double prob_invoke_mem_batch_fitness(const problem &p, const vector_doubl
     // requested.
     if (incr_fevals) {
         p.increment_fevals(boost::numeric_cast<unsigned long long>(dvs.size() / p.get_nx()));
+        prob_check_budget_target(p, retval.data(), retval.size());
     }
 
     return retval;
 }
 
+// Increase the fevals counter of p by n, without charging the evaluation budget.
+// This is used to merge into p the fitness evaluations performed on copies of p
+// which share its budget (and which have thus already charged it).
+void prob_merge_fevals(const problem &p, unsigned long long n)
+{
+    p.m_fevals.fetch_add(n, std::memory_order_relaxed);
+}
+
+// Check the fitnesses of a batch of fitness vectors against the target of the
+// evaluation budget of p, if any. The target is checked only if the fitness of p
+// has a single component (in which case n is the number of fitness vectors).
+void prob_check_budget_target(const problem &p, const double *fvs, vector_double::size_type n)
+{
+    const auto &budget = p.get_budget();
+    if (budget && p.get_nf() == 1u) {
+        for (decltype(n) i = 0; i < n; ++i) {
+            budget->check_target(fvs[i]);
+        }
+    }
+}
+
 } // namespace detail
 
 } // namespace pagmo
@@ -42,6 +42,26 @@ see https://www.gnu.org/licenses/. */
 namespace pagmo
 {
 
+namespace
+{
+
+// Fitness of the decision vector x of size n.
+double ackley_fitness_impl(const double *x, vector_double::size_type n)
+{
+    double omega = 2. * detail::pi();
+    double s1 = 0., s2 = 0.;
+    double nepero = std::exp(1.0);
+
+    for (decltype(n) i = 0u; i < n; i++) {
+        s1 += x[i] * x[i];
+        s2 += std::cos(omega * x[i]);
+    }
+    return -20 * std::exp(-0.2 * std::sqrt(1.0 / static_cast<double>(n) * s1))
+           - std::exp(1.0 / static_cast<double>(n) * s2) + 20 + nepero;
+}
+
+} // namespace
+
 ackley::ackley(unsigned dim) : m_dim(dim)
 {
     if (dim < 1u) {
@@ -60,19 +80,21 @@ ackley::ackley(unsigned dim) : m_dim(dim)
  */
 vector_double ackley::fitness(const vector_double &x) const
 {
-    vector_double f(1, 0.);
-    auto n = x.size();
-    double omega = 2. * detail::pi();
-    double s1 = 0., s2 = 0.;
-    double nepero = std::exp(1.0);
+    return {ackley_fitness_impl(x.data(), x.size())};
+}
 
-    for (decltype(n) i = 0u; i < n; i++) {
-        s1 += x[i] * x[i];
-        s2 += std::cos(omega * x[i]);
-    }
-    f[0] = -20 * std::exp(-0.2 * std::sqrt(1.0 / static_cast<double>(n) * s1))
-           - std::exp(1.0 / static_cast<double>(n) * s2) + 20 + nepero;
-    return f;
+/// Scalar fitness computation
+/**
+ * Computes the fitness for this UDP without creating a fitness vector
+ * (see pagmo::problem::scalar_fitness()).
+ *
+ * @param x a pointer to the components of the decision vector.
+ *
+ * @return the fitness of \p x.
+ */
+double ackley::scalar_fitness(const double *x) const
+{
+    return ackley_fitness_impl(x, m_dim);
 }
 
 /// Box-bounds
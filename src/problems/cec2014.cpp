@@ -28,9 +28,11 @@ see https://www.gnu.org/licenses/. */
 
 #include <cmath>
 #include <cstdlib>
+#include <memory>
 #include <stdexcept>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <pagmo/exceptions.hpp>
 #include <pagmo/problem.hpp>
@@ -74,30 +76,33 @@ cec2014::cec2014(unsigned prob_id, unsigned dim) : m_z(dim), m_y(dim), func_num(
     auto rotation_func_it = detail::cec2014_data::rotation_data.find(func_num);
     auto rotation_data_dim = rotation_func_it->second;
     auto rotation_dim_it = rotation_data_dim.find(dim);
-    m_rotation_matrix = rotation_dim_it->second;
+    m_rotation_matrix = std::make_shared<const vector_double>(rotation_dim_it->second);
 
     /* Load shift_data */
     auto loader_it = detail::cec2014_data::shift_data.find(func_num);
-    m_origin_shift = loader_it->second;
+    auto origin_shift = loader_it->second;
 
     // Uses first dim elements of each line for multidimensional functions (id > 23)
-    auto it = m_origin_shift.begin();
+    auto it = origin_shift.begin();
     int i = -1;
-    while (it != m_origin_shift.end()) {
+    while (it != origin_shift.end()) {
         i++;
         if ((i % 100) >= static_cast<int>(dim)) {
-            it = m_origin_shift.erase(it);
+            it = origin_shift.erase(it);
         } else {
             ++it;
         }
     }
+    m_origin_shift = std::make_shared<const vector_double>(std::move(origin_shift));
 
     /* Load shuffle data */
     if (((func_num >= 17) && (func_num <= 22)) || (func_num == 29) || (func_num == 30)) {
         auto shuffle_func_it = detail::cec2014_data::shuffle_data.find(func_num);
         auto shuffle_data_dim = shuffle_func_it->second;
         auto shuffle_dim_it = shuffle_data_dim.find(dim);
-        m_shuffle = shuffle_dim_it->second;
+        m_shuffle = std::make_shared<const std::vector<int>>(shuffle_dim_it->second);
+    } else {
+        m_shuffle = std::make_shared<const std::vector<int>>();
     }
 }
 
@@ -129,123 +134,123 @@ vector_double cec2014::fitness(const vector_double &x) const
     auto nx = static_cast<unsigned>(m_z.size());
     switch (func_num) {
         case 1:
-            ellips_func(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), 1, 1);
+            ellips_func(x.data(), f.data(), nx, m_origin_shift->data(), m_rotation_matrix->data(), 1, 1);
             f[0] += 100.0;
             break;
         case 2:
-            bent_cigar_func(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), 1, 1);
+            bent_cigar_func(x.data(), f.data(), nx, m_origin_shift->data(), m_rotation_matrix->data(), 1, 1);
             f[0] += 200.0;
             break;
         case 3:
-            discus_func(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), 1, 1);
+            discus_func(x.data(), f.data(), nx, m_origin_shift->data(), m_rotation_matrix->data(), 1, 1);
             f[0] += 300.0;
             break;
         case 4:
-            rosenbrock_func(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), 1, 1);
+            rosenbrock_func(x.data(), f.data(), nx, m_origin_shift->data(), m_rotation_matrix->data(), 1, 1);
             f[0] += 400.0;
             break;
         case 5:
-            ackley_func(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), 1, 1);
+            ackley_func(x.data(), f.data(), nx, m_origin_shift->data(), m_rotation_matrix->data(), 1, 1);
             f[0] += 500.0;
             break;
         case 6:
-            weierstrass_func(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), 1, 1);
+            weierstrass_func(x.data(), f.data(), nx, m_origin_shift->data(), m_rotation_matrix->data(), 1, 1);
             f[0] += 600.0;
             break;
         case 7:
-            griewank_func(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), 1, 1);
+            griewank_func(x.data(), f.data(), nx, m_origin_shift->data(), m_rotation_matrix->data(), 1, 1);
             f[0] += 700.0;
             break;
         case 8:
-            rastrigin_func(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), 1, 0);
+            rastrigin_func(x.data(), f.data(), nx, m_origin_shift->data(), m_rotation_matrix->data(), 1, 0);
             f[0] += 800.0;
             break;
         case 9:
-            rastrigin_func(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), 1, 1);
+            rastrigin_func(x.data(), f.data(), nx, m_origin_shift->data(), m_rotation_matrix->data(), 1, 1);
             f[0] += 900.0;
             break;
         case 10:
-            schwefel_func(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), 1, 0);
+            schwefel_func(x.data(), f.data(), nx, m_origin_shift->data(), m_rotation_matrix->data(), 1, 0);
             f[0] += 1000.0;
             break;
         case 11:
-            schwefel_func(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), 1, 1);
+            schwefel_func(x.data(), f.data(), nx, m_origin_shift->data(), m_rotation_matrix->data(), 1, 1);
             f[0] += 1100.0;
             break;
         case 12:
-            katsuura_func(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), 1, 1);
+            katsuura_func(x.data(), f.data(), nx, m_origin_shift->data(), m_rotation_matrix->data(), 1, 1);
             f[0] += 1200.0;
             break;
         case 13:
-            happycat_func(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), 1, 1);
+            happycat_func(x.data(), f.data(), nx, m_origin_shift->data(), m_rotation_matrix->data(), 1, 1);
             f[0] += 1300.0;
             break;
         case 14:
-            hgbat_func(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), 1, 1);
+            hgbat_func(x.data(), f.data(), nx, m_origin_shift->data(), m_rotation_matrix->data(), 1, 1);
             f[0] += 1400.0;
             break;
         case 15:
-            grie_rosen_func(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), 1, 1);
+            grie_rosen_func(x.data(), f.data(), nx, m_origin_shift->data(), m_rotation_matrix->data(), 1, 1);
             f[0] += 1500.0;
             break;
         case 16:
-            escaffer6_func(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), 1, 1);
+            escaffer6_func(x.data(), f.data(), nx, m_origin_shift->data(), m_rotation_matrix->data(), 1, 1);
             f[0] += 1600.0;
             break;
         case 17:
-            hf01(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), m_shuffle.data(), 1, 1);
+            hf01(x.data(), f.data(), nx, m_origin_shift->data(), m_rotation_matrix->data(), m_shuffle->data(), 1, 1);
             f[0] += 1700.0;
             break;
         case 18:
-            hf02(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), m_shuffle.data(), 1, 1);
+            hf02(x.data(), f.data(), nx, m_origin_shift->data(), m_rotation_matrix->data(), m_shuffle->data(), 1, 1);
             f[0] += 1800.0;
             break;
         case 19:
-            hf03(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), m_shuffle.data(), 1, 1);
+            hf03(x.data(), f.data(), nx, m_origin_shift->data(), m_rotation_matrix->data(), m_shuffle->data(), 1, 1);
             f[0] += 1900.0;
             break;
         case 20:
-            hf04(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), m_shuffle.data(), 1, 1);
+            hf04(x.data(), f.data(), nx, m_origin_shift->data(), m_rotation_matrix->data(), m_shuffle->data(), 1, 1);
             f[0] += 2000.0;
             break;
         case 21:
-            hf05(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), m_shuffle.data(), 1, 1);
+            hf05(x.data(), f.data(), nx, m_origin_shift->data(), m_rotation_matrix->data(), m_shuffle->data(), 1, 1);
             f[0] += 2100.0;
             break;
         case 22:
-            hf06(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), m_shuffle.data(), 1, 1);
+            hf06(x.data(), f.data(), nx, m_origin_shift->data(), m_rotation_matrix->data(), m_shuffle->data(), 1, 1);
             f[0] += 2200.0;
             break;
         case 23:
-            cf01(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), 1);
+            cf01(x.data(), f.data(), nx, m_origin_shift->data(), m_rotation_matrix->data(), 1);
             f[0] += 2300.0;
             break;
         case 24:
-            cf02(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), 1);
+            cf02(x.data(), f.data(), nx, m_origin_shift->data(), m_rotation_matrix->data(), 1);
             f[0] += 2400.0;
             break;
         case 25:
-            cf03(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), 1);
+            cf03(x.data(), f.data(), nx, m_origin_shift->data(), m_rotation_matrix->data(), 1);
             f[0] += 2500.0;
             break;
         case 26:
-            cf04(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), 1);
+            cf04(x.data(), f.data(), nx, m_origin_shift->data(), m_rotation_matrix->data(), 1);
             f[0] += 2600.0;
             break;
         case 27:
-            cf05(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), 1);
+            cf05(x.data(), f.data(), nx, m_origin_shift->data(), m_rotation_matrix->data(), 1);
             f[0] += 2700.0;
             break;
         case 28:
-            cf06(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), 1);
+            cf06(x.data(), f.data(), nx, m_origin_shift->data(), m_rotation_matrix->data(), 1);
             f[0] += 2800.0;
             break;
         case 29:
-            cf07(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), m_shuffle.data(), 1);
+            cf07(x.data(), f.data(), nx, m_origin_shift->data(), m_rotation_matrix->data(), m_shuffle->data(), 1);
             f[0] += 2900.0;
             break;
         case 30:
-            cf08(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), m_shuffle.data(), 1);
+            cf08(x.data(), f.data(), nx, m_origin_shift->data(), m_rotation_matrix->data(), m_shuffle->data(), 1);
             f[0] += 3000.0;
             break;
     }
@@ -358,16 +363,35 @@ std::string cec2014::get_name() const
 
 /// Object serialization
 /**
- * This method will save/load \p this into the archive \p ar.
+ * This method will save \p this into the archive \p ar.
  *
  * @param ar target archive.
  *
  * @throws unspecified any exception thrown by the serialization of primitive types.
  */
 template <typename Archive>
-void cec2014::serialize(Archive &ar, unsigned)
+void cec2014::save(Archive &ar, unsigned) const
+{
+    detail::to_archive(ar, func_num, *m_rotation_matrix, *m_origin_shift, *m_shuffle, m_y, m_z);
+}
+
+/// Object deserialization
+/**
+ * This method will load \p this from the archive \p ar.
+ *
+ * @param ar source archive.
+ *
+ * @throws unspecified any exception thrown by the deserialization of primitive types.
+ */
+template <typename Archive>
+void cec2014::load(Archive &ar, unsigned)
 {
-    detail::archive(ar, func_num, m_rotation_matrix, m_origin_shift, m_shuffle, m_y, m_z);
+    vector_double rotation_matrix, origin_shift;
+    std::vector<int> shuffle;
+    detail::from_archive(ar, func_num, rotation_matrix, origin_shift, shuffle, m_y, m_z);
+    m_rotation_matrix = std::make_shared<const vector_double>(std::move(rotation_matrix));
+    m_origin_shift = std::make_shared<const vector_double>(std::move(origin_shift));
+    m_shuffle = std::make_shared<const std::vector<int>>(std::move(shuffle));
 }
 
 // For the coverage analysis we do not cover the code below as its derived from a third party source
@@ -41,6 +41,27 @@ see https://www.gnu.org/licenses/. */
 namespace pagmo
 {
 
+namespace
+{
+
+// Fitness of the decision vector x of size n.
+double griewank_fitness_impl(const double *x, vector_double::size_type n)
+{
+    double fr = 4000.;
+    double retval = 0.;
+    double p = 1.;
+
+    for (decltype(n) i = 0u; i < n; i++) {
+        retval += x[i] * x[i];
+    }
+    for (decltype(n) i = 0u; i < n; i++) {
+        p *= std::cos(x[i] / std::sqrt(static_cast<double>(i) + 1.0));
+    }
+    return retval / fr - p + 1.;
+}
+
+} // namespace
+
 griewank::griewank(unsigned dim) : m_dim(dim)
 {
     if (dim < 1u) {
@@ -59,20 +80,21 @@ griewank::griewank(unsigned dim) : m_dim(dim)
  */
 vector_double griewank::fitness(const vector_double &x) const
 {
-    vector_double f(1, 0.);
-    auto n = x.size();
-    double fr = 4000.;
-    double retval = 0.;
-    double p = 1.;
+    return {griewank_fitness_impl(x.data(), x.size())};
+}
 
-    for (decltype(n) i = 0u; i < n; i++) {
-        retval += x[i] * x[i];
-    }
-    for (decltype(n) i = 0u; i < n; i++) {
-        p *= std::cos(x[i] / std::sqrt(static_cast<double>(i) + 1.0));
-    }
-    f[0] = (retval / fr - p + 1.);
-    return f;
+/// Scalar fitness computation
+/**
+ * Computes the fitness for this UDP without creating a fitness vector
+ * (see pagmo::problem::scalar_fitness()).
+ *
+ * @param x a pointer to the components of the decision vector.
+ *
+ * @return the fitness of \p x.
+ */
+double griewank::scalar_fitness(const double *x) const
+{
+    return griewank_fitness_impl(x, m_dim);
 }
 
 /// Box-bounds
@@ -43,6 +43,23 @@ see https://www.gnu.org/licenses/. */
 namespace pagmo
 {
 
+namespace
+{
+
+// Fitness of the decision vector x of size n.
+double rastrigin_fitness_impl(const double *x, vector_double::size_type n)
+{
+    double f = 0.;
+    const auto omega = 2. * pagmo::detail::pi();
+    for (decltype(n) i = 0u; i < n; ++i) {
+        f += x[i] * x[i] - 10. * std::cos(omega * x[i]);
+    }
+    f += 10. * static_cast<double>(n);
+    return f;
+}
+
+} // namespace
+
 rastrigin::rastrigin(unsigned dim) : m_dim(dim)
 {
     if (dim < 1u) {
@@ -61,14 +78,21 @@ rastrigin::rastrigin(unsigned dim) : m_dim(dim)
  */
 vector_double rastrigin::fitness(const vector_double &x) const
 {
-    vector_double f(1, 0.);
-    const auto omega = 2. * pagmo::detail::pi();
-    auto n = x.size();
-    for (decltype(n) i = 0u; i < n; ++i) {
-        f[0] += x[i] * x[i] - 10. * std::cos(omega * x[i]);
-    }
-    f[0] += 10. * static_cast<double>(n);
-    return f;
+    return {rastrigin_fitness_impl(x.data(), x.size())};
+}
+
+/// Scalar fitness computation
+/**
+ * Computes the fitness for this UDP without creating a fitness vector
+ * (see pagmo::problem::scalar_fitness()).
+ *
+ * @param x a pointer to the components of the decision vector.
+ *
+ * @return the fitness of \p x.
+ */
+double rastrigin::scalar_fitness(const double *x) const
+{
+    return rastrigin_fitness_impl(x, m_dim);
 }
 
 /// Box-bounds
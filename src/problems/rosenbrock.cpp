@@ -57,12 +57,26 @@ rosenbrock::rosenbrock(vector_double::size_type dim) : m_dim(dim)
  * @return the fitness of \p x.
  */
 vector_double rosenbrock::fitness(const vector_double &x) const
+{
+    return {scalar_fitness(x.data())};
+}
+
+/// Scalar fitness computation
+/**
+ * Computes the fitness for this UDP without creating a fitness vector
+ * (see pagmo::problem::scalar_fitness()).
+ *
+ * @param x a pointer to the components of the decision vector.
+ *
+ * @return the fitness of \p x.
+ */
+double rosenbrock::scalar_fitness(const double *x) const
 {
     double retval = 0.;
     for (decltype(m_dim) i = 0u; i < m_dim - 1u; ++i) {
         retval += 100. * (x[i] * x[i] - x[i + 1]) * (x[i] * x[i] - x[i + 1]) + (x[i] - 1) * (x[i] - 1);
     }
-    return {retval};
+    return retval;
 }
 
 /// Box-bounds
@@ -41,6 +41,21 @@ see https://www.gnu.org/licenses/. */
 namespace pagmo
 {
 
+namespace
+{
+
+// Fitness of the decision vector x of size n.
+double schwefel_fitness_impl(const double *x, vector_double::size_type n)
+{
+    double f = 0.;
+    for (decltype(n) i = 0u; i < n; i++) {
+        f += x[i] * std::sin(std::sqrt(std::abs(x[i])));
+    }
+    return 418.9828872724338 * static_cast<double>(n) - f;
+}
+
+} // namespace
+
 schwefel::schwefel(unsigned dim) : m_dim(dim)
 {
     if (dim < 1u) {
@@ -59,13 +74,21 @@ schwefel::schwefel(unsigned dim) : m_dim(dim)
  */
 vector_double schwefel::fitness(const vector_double &x) const
 {
-    vector_double f(1, 0.);
-    auto n = x.size();
-    for (decltype(n) i = 0u; i < n; i++) {
-        f[0] += x[i] * std::sin(std::sqrt(std::abs(x[i])));
-    }
-    f[0] = 418.9828872724338 * static_cast<double>(n) - f[0];
-    return f;
+    return {schwefel_fitness_impl(x.data(), x.size())};
+}
+
+/// Scalar fitness computation
+/**
+ * Computes the fitness for this UDP without creating a fitness vector
+ * (see pagmo::problem::scalar_fitness()).
+ *
+ * @param x a pointer to the components of the decision vector.
+ *
+ * @return the fitness of \p x.
+ */
+double schwefel::scalar_fitness(const double *x) const
+{
+    return schwefel_fitness_impl(x, m_dim);
 }
 
 /// Box-bounds
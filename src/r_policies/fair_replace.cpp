@@ -28,7 +28,6 @@ see https://www.gnu.org/licenses/. */
 
 #include <algorithm>
 #include <cassert>
-#include <numeric>
 #include <stdexcept>
 #include <string>
 #include <tuple>
@@ -38,13 +37,13 @@ see https://www.gnu.org/licenses/. */
 #include <boost/variant/get.hpp>
 
 #include <pagmo/detail/base_sr_policy.hpp>
-#include <pagmo/detail/custom_comparisons.hpp>
 #include <pagmo/exceptions.hpp>
 #include <pagmo/r_policies/fair_replace.hpp>
 #include <pagmo/r_policy.hpp>
 #include <pagmo/s11n.hpp>
 #include <pagmo/types.hpp>
 #include <pagmo/utils/constrained.hpp>
+#include <pagmo/utils/generic.hpp>
 #include <pagmo/utils/multi_objective.hpp>
 
 // MINGW-specific warnings.
@@ -116,13 +115,8 @@ individuals_group_t fair_replace::replace(const individuals_group_t &inds, const
     if (nobj == 1u && !nic && !nec) {
         // Single-objective, unconstrained.
 
-        // Sort (indirectly) the migrants according to their fitness.
-        std::vector<pop_size_t> mig_ind_sort;
-        mig_ind_sort.resize(boost::numeric_cast<decltype(mig_ind_sort.size())>(mig_size));
-        std::iota(mig_ind_sort.begin(), mig_ind_sort.end(), pop_size_t(0));
-        std::sort(mig_ind_sort.begin(), mig_ind_sort.end(), [&mig](pop_size_t idx1, pop_size_t idx2) {
-            return detail::less_than_f(std::get<2>(mig)[idx1][0], std::get<2>(mig)[idx2][0]);
-        });
+        // Get (indirectly) the best n_migr migrants according to their fitness.
+        const auto mig_ind_sort = select_best_N_so(std::get<2>(mig), n_migr);
 
         // Build the merged population from the original individuals plus the
         // top n_migr migrants.
@@ -133,15 +127,8 @@ individuals_group_t fair_replace::replace(const individuals_group_t &inds, const
             std::get<2>(merged_pop).push_back(std::get<2>(mig)[mig_ind_sort[i]]);
         }
 
-        // Sort (indirectly) the merged population.
-        std::vector<pop_size_t> merged_pop_ind_sort;
-        merged_pop_ind_sort.resize(
-            boost::numeric_cast<decltype(merged_pop_ind_sort.size())>(std::get<0>(merged_pop).size()));
-        std::iota(merged_pop_ind_sort.begin(), merged_pop_ind_sort.end(), pop_size_t(0));
-        std::sort(merged_pop_ind_sort.begin(), merged_pop_ind_sort.end(),
-                  [&merged_pop](pop_size_t idx1, pop_size_t idx2) {
-                      return detail::less_than_f(std::get<2>(merged_pop)[idx1][0], std::get<2>(merged_pop)[idx2][0]);
-                  });
+        // Get (indirectly) the best inds_size individuals from the merged population.
+        const auto merged_pop_ind_sort = select_best_N_so(std::get<2>(merged_pop), inds_size);
 
         // Create and return the output pop.
         individuals_group_t retval;
@@ -158,9 +145,9 @@ individuals_group_t fair_replace::replace(const individuals_group_t &inds, const
     } else if (nobj == 1u && (nic || nec)) {
         // Single-objective, constrained.
 
-        // Sort indirectly the input migrants, taking into accounts
+        // Get indirectly the best n_migr migrants, taking into accounts
         // constraints satisfaction and tolerances.
-        const auto mig_ind_sort = sort_population_con(std::get<2>(mig), nec, tol);
+        const auto mig_ind_sort = select_best_N_con(std::get<2>(mig), n_migr, nec, tol);
 
         // Build the merged population from the original individuals plus the
         // top n_migr migrants.
@@ -171,8 +158,8 @@ individuals_group_t fair_replace::replace(const individuals_group_t &inds, const
             std::get<2>(merged_pop).push_back(std::get<2>(mig)[mig_ind_sort[i]]);
         }
 
-        // Sort indirectly the merged population.
-        const auto merged_pop_ind_sort = sort_population_con(std::get<2>(merged_pop), nec, tol);
+        // Get indirectly the best inds_size individuals from the merged population.
+        const auto merged_pop_ind_sort = select_best_N_con(std::get<2>(merged_pop), inds_size, nec, tol);
 
         // Create and return the output pop.
         individuals_group_t retval;
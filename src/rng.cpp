@@ -26,6 +26,8 @@ You should have received copies of the GNU General Public License and the
 GNU Lesser General Public License along with the PaGMO library.  If not,
 see https://www.gnu.org/licenses/. */
 
+#include <atomic>
+#include <cstdint>
 #include <mutex>
 #include <random>
 
@@ -40,9 +42,17 @@ namespace detail
 namespace
 {
 
-// The global rng is inited on startup with a random number.
-random_engine_type global_rng(static_cast<random_engine_type::result_type>(std::random_device()()));
-
+// The global PRS is identified by a seed (inited on startup with a random number)
+// and by the position of the next element in the sequence. Since the elements of the
+// sequence are computed statelessly from the seed and the position via the counter-based
+// engine, random_device::next() does not need to take any lock. The seed and the counter
+// are protected by a seqlock: random_device::set_seed() makes the sequence number odd
+// while it updates the pair, and random_device::next() retries whenever the sequence
+// number changed (or was odd) while it was reading the pair.
+std::atomic<std::uint64_t> global_rng_seed(static_cast<std::uint64_t>(std::random_device()()));
+std::atomic<std::uint64_t> global_rng_counter(0);
+std::atomic<std::uint64_t> global_rng_seq(0);
+// Serialises the writers.
 std::mutex global_rng_mutex;
 
 } // namespace
@@ -57,8 +67,20 @@ std::mutex global_rng_mutex;
  */
 unsigned random_device::next()
 {
-    std::lock_guard<std::mutex> lock(detail::global_rng_mutex);
-    return static_cast<unsigned>(detail::global_rng());
+    while (true) {
+        const auto s1 = detail::global_rng_seq.load(std::memory_order_acquire);
+        if (s1 % 2u) {
+            // A set_seed() is in progress.
+            continue;
+        }
+        const auto n = detail::global_rng_counter.fetch_add(1u, std::memory_order_relaxed);
+        const auto seed = detail::global_rng_seed.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (detail::global_rng_seq.load(std::memory_order_relaxed) == s1) {
+            // The seed and the position belong to the same sequence.
+            return static_cast<unsigned>(detail::random_engine_type::block(seed, 0, n / 4u)[n % 4u]);
+        }
+    }
 }
 
 #if !defined(PAGMO_DOXYGEN_INVOKED)
@@ -69,12 +91,21 @@ unsigned random_device::next()
  * following calls to random_device::next() will always repeat the same
  * numbers.
  *
+ * The seed and the position in the sequence are updated atomically as a pair, thus
+ * concurrent calls to random_device::next() will return elements either of the old
+ * or of the new sequence, never a mix of the two.
+ *
  * @param seed The new seed to be used
  */
 void random_device::set_seed(unsigned seed)
 {
     std::lock_guard<std::mutex> lock(detail::global_rng_mutex);
-    detail::global_rng.seed(static_cast<detail::random_engine_type::result_type>(seed));
+    const auto s = detail::global_rng_seq.load(std::memory_order_relaxed);
+    detail::global_rng_seq.store(s + 1u, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    detail::global_rng_seed.store(static_cast<std::uint64_t>(seed), std::memory_order_relaxed);
+    detail::global_rng_counter.store(0, std::memory_order_relaxed);
+    detail::global_rng_seq.store(s + 2u, std::memory_order_release);
 }
 
 #endif
@@ -28,7 +28,6 @@ see https://www.gnu.org/licenses/. */
 
 #include <algorithm>
 #include <cassert>
-#include <numeric>
 #include <stdexcept>
 #include <string>
 #include <tuple>
@@ -38,13 +37,13 @@ see https://www.gnu.org/licenses/. */
 #include <boost/variant/get.hpp>
 
 #include <pagmo/detail/base_sr_policy.hpp>
-#include <pagmo/detail/custom_comparisons.hpp>
 #include <pagmo/exceptions.hpp>
 #include <pagmo/s11n.hpp>
 #include <pagmo/s_policies/select_best.hpp>
 #include <pagmo/s_policy.hpp>
 #include <pagmo/types.hpp>
 #include <pagmo/utils/constrained.hpp>
+#include <pagmo/utils/generic.hpp>
 #include <pagmo/utils/multi_objective.hpp>
 
 // MINGW-specific warnings.
@@ -110,13 +109,8 @@ individuals_group_t select_best::select(const individuals_group_t &inds, const v
     if (nobj == 1u && !nic && !nec) {
         // Single-objective, unconstrained.
 
-        // Sort (indirectly) the input individuals according to their fitness.
-        std::vector<pop_size_t> inds_ind_sort;
-        inds_ind_sort.resize(boost::numeric_cast<decltype(inds_ind_sort.size())>(inds_size));
-        std::iota(inds_ind_sort.begin(), inds_ind_sort.end(), pop_size_t(0));
-        std::sort(inds_ind_sort.begin(), inds_ind_sort.end(), [&inds](pop_size_t idx1, pop_size_t idx2) {
-            return detail::less_than_f(std::get<2>(inds)[idx1][0], std::get<2>(inds)[idx2][0]);
-        });
+        // Get (indirectly) the best n_migr individuals according to their fitness.
+        const auto inds_ind_sort = select_best_N_so(std::get<2>(inds), n_migr);
 
         // Create and return the output pop.
         individuals_group_t retval;
@@ -133,9 +127,9 @@ individuals_group_t select_best::select(const individuals_group_t &inds, const v
     } else if (nobj == 1u && (nic || nec)) {
         // Single-objective, constrained.
 
-        // Sort indirectly the input individuals, taking into accounts
+        // Get indirectly the best n_migr individuals, taking into accounts
         // constraints satisfaction and tolerances.
-        const auto inds_ind_sort = sort_population_con(std::get<2>(inds), nec, tol);
+        const auto inds_ind_sort = select_best_N_con(std::get<2>(inds), n_migr, nec, tol);
 
         // Create and return the output pop.
         individuals_group_t retval;
@@ -0,0 +1,322 @@
+/* Copyright 2017-2020 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <initializer_list>
+#include <iomanip>
+#include <ios>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include <pagmo/exceptions.hpp>
+#include <pagmo/tracing.hpp>
+
+namespace pagmo
+{
+
+namespace detail
+{
+
+std::atomic<bool> trace_flag(false);
+
+namespace
+{
+
+// The reference time point for the timestamps
+// of the trace events.
+const auto trace_initial_timestamp = std::chrono::steady_clock::now();
+
+// A single trace event.
+struct trace_event {
+    const char *name;
+    const char *cat;
+    // Chrome's phase character ('B', 'E' or 'i').
+    char ph;
+    unsigned char n_args;
+    std::array<trace_arg, 3> args;
+    // Nanoseconds since trace_initial_timestamp.
+    std::int64_t ts;
+};
+
+// A fixed-size block of events. The blocks of a thread's buffer
+// form a singly-linked list. Only the owning thread ever writes
+// into a block: it first fills the event slot, and then publishes it
+// by bumping the size counter with release semantics. Readers
+// acquire the size counter and read only the published events.
+struct trace_block {
+    static constexpr std::size_t capacity = 1024;
+    std::array<trace_event, capacity> events;
+    std::atomic<std::size_t> size{0};
+    std::atomic<trace_block *> next{nullptr};
+};
+
+// The per-thread buffer. Buffers are linked in a global,
+// append-only list.
+struct trace_buffer {
+    explicit trace_buffer(unsigned t) : tid(t), tail(&head) {}
+    const unsigned tid;
+    trace_block head;
+    std::atomic<trace_block *> tail;
+    trace_buffer *next_buffer = nullptr;
+};
+
+// Head of the global list of buffers and counter
+// for the generation of thread IDs.
+std::atomic<trace_buffer *> trace_buffers{nullptr};
+std::atomic<unsigned> trace_tid_counter{0};
+
+// Fetch the buffer of the calling thread, creating and
+// registering it on first use.
+// NOTE: the buffers are deliberately never destroyed, so that
+// the events recorded by threads which have already exited (e.g.,
+// the threads of islands which have been destroyed) can still be exported.
+// The registration is lock-free.
+trace_buffer &get_trace_buffer()
+{
+    thread_local trace_buffer *const buf = []() {
+        auto ret = new trace_buffer(trace_tid_counter.fetch_add(1, std::memory_order_relaxed));
+        ret->next_buffer = trace_buffers.load(std::memory_order_relaxed);
+        while (!trace_buffers.compare_exchange_weak(ret->next_buffer, ret, std::memory_order_release,
+                                                    std::memory_order_relaxed)) {
+        }
+        return ret;
+    }();
+    return *buf;
+}
+
+void trace_record(const char *name, const char *cat, char ph, std::initializer_list<trace_arg> args)
+{
+    const auto ts = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now()
+                                                                         - trace_initial_timestamp)
+                        .count();
+
+    auto &buf = get_trace_buffer();
+    auto blk = buf.tail.load(std::memory_order_relaxed);
+    auto size = blk->size.load(std::memory_order_relaxed);
+    if (size == trace_block::capacity) {
+        // The current block is full, append a new one.
+        auto new_blk = std::make_unique<trace_block>();
+        blk->next.store(new_blk.get(), std::memory_order_release);
+        buf.tail.store(new_blk.get(), std::memory_order_relaxed);
+        blk = new_blk.release();
+        size = 0;
+    }
+
+    auto &ev = blk->events[size];
+    ev.name = name;
+    ev.cat = cat;
+    ev.ph = ph;
+    ev.n_args = static_cast<unsigned char>(std::min(args.size(), ev.args.size()));
+    std::copy(args.begin(), args.begin() + ev.n_args, ev.args.begin());
+    ev.ts = static_cast<std::int64_t>(ts);
+
+    // Publish the event.
+    blk->size.store(size + 1u, std::memory_order_release);
+}
+
+// Apply f to all the published events, buffer by buffer.
+template <typename F>
+void trace_for_each(const F &f)
+{
+    for (auto buf = trace_buffers.load(std::memory_order_acquire); buf != nullptr; buf = buf->next_buffer) {
+        for (const trace_block *blk = &buf->head; blk != nullptr; blk = blk->next.load(std::memory_order_acquire)) {
+            const auto size = blk->size.load(std::memory_order_acquire);
+            for (std::size_t i = 0; i < size; ++i) {
+                f(buf->tid, blk->events[i]);
+            }
+        }
+    }
+}
+
+} // namespace
+
+void trace_instant(const char *name, const char *cat, std::initializer_list<trace_arg> args)
+{
+    if (trace_enabled()) {
+        trace_record(name, cat, 'i', args);
+    }
+}
+
+trace_span::trace_span(const char *name, const char *cat, std::initializer_list<trace_arg> args)
+    : m_name(name), m_cat(cat), m_active(trace_enabled())
+{
+    if (m_active) {
+        trace_record(m_name, m_cat, 'B', args);
+    }
+}
+
+trace_span::~trace_span()
+{
+    // NOTE: the end event is recorded even if tracing
+    // was disabled in the meantime, so that begin/end
+    // events are always paired.
+    if (m_active) {
+        trace_record(m_name, m_cat, 'E', {});
+    }
+}
+
+} // namespace detail
+
+/// Enable tracing.
+/**
+ * After a call to this function, pagmo will start recording trace events.
+ */
+void tracer::enable()
+{
+    detail::trace_flag.store(true);
+}
+
+/// Disable tracing.
+/**
+ * After a call to this function, pagmo will stop recording new trace events. The events
+ * recorded so far are retained, and they can still be exported via tracer::dump() or tracer::save().
+ */
+void tracer::disable()
+{
+    detail::trace_flag.store(false);
+}
+
+/// Check if tracing is enabled.
+/**
+ * @return \p true if tracing is currently enabled, \p false otherwise.
+ */
+bool tracer::is_enabled()
+{
+    return detail::trace_enabled();
+}
+
+/// Discard all the recorded events.
+/**
+ * \rststar
+ * .. warning::
+ *
+ *    This function must not be called while other threads may be recording trace events
+ *    (e.g., while islands are evolving with tracing enabled).
+ * \endrststar
+ */
+void tracer::clear()
+{
+    for (auto buf = detail::trace_buffers.load(std::memory_order_acquire); buf != nullptr; buf = buf->next_buffer) {
+        auto blk = buf->head.next.exchange(nullptr);
+        while (blk != nullptr) {
+            std::unique_ptr<detail::trace_block> blk_ptr(blk);
+            blk = blk->next.load();
+        }
+        buf->head.size.store(0);
+        buf->tail.store(&buf->head);
+    }
+}
+
+/// Number of recorded events.
+/**
+ * @return the total number of events currently recorded in the trace buffers.
+ */
+unsigned long long tracer::get_n_events()
+{
+    unsigned long long retval = 0;
+    detail::trace_for_each([&retval](unsigned, const detail::trace_event &) { ++retval; });
+    return retval;
+}
+
+/// Export the recorded events in the Chrome trace-event format.
+/**
+ * This function will write to \p os a JSON document in the Chrome trace-event format
+ * containing all the events recorded so far. Timestamps are expressed in microseconds,
+ * and each thread which recorded events is assigned a distinct, sequential thread ID.
+ *
+ * It is safe to call this function while other threads are recording events: only
+ * the events which have been fully recorded at the time of the call will be exported.
+ *
+ * @param os the target stream.
+ */
+void tracer::dump(std::ostream &os)
+{
+    // NOTE: make sure we don't alter the flags of the
+    // user-supplied stream.
+    const auto old_flags = os.flags();
+    const auto old_prec = os.precision();
+
+    os << std::fixed << std::setprecision(3);
+    os << "{\"traceEvents\":[";
+    bool first = true;
+    detail::trace_for_each([&os, &first](unsigned tid, const detail::trace_event &ev) {
+        if (!first) {
+            os << ',';
+        }
+        first = false;
+        os << "\n{\"name\":\"" << ev.name << "\",\"cat\":\"" << ev.cat << "\",\"ph\":\"" << ev.ph
+           << "\",\"ts\":" << static_cast<double>(ev.ts) / 1000. << ",\"pid\":0,\"tid\":" << tid;
+        if (ev.ph == 'i') {
+            // Thread-scoped instant event.
+            os << ",\"s\":\"t\"";
+        }
+        if (ev.n_args) {
+            os << ",\"args\":{";
+            for (unsigned i = 0; i < ev.n_args; ++i) {
+                os << (i ? "," : "") << '"' << ev.args[i].key << "\":" << ev.args[i].value;
+            }
+            os << '}';
+        }
+        os << '}';
+    });
+    os << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+    os.flags(old_flags);
+    os.precision(old_prec);
+}
+
+/// Save the recorded events to a file.
+/**
+ * This function will write into the file \p filename the output of tracer::dump().
+ *
+ * @param filename the name of the output file.
+ *
+ * @throws std::runtime_error if the file cannot be opened or written to.
+ */
+void tracer::save(const std::string &filename)
+{
+    std::ofstream ofs(filename, std::ios::out | std::ios::trunc);
+    if (!ofs) {
+        pagmo_throw(std::runtime_error, "Unable to open the file '" + filename + "' for writing the trace events");
+    }
+    dump(ofs);
+    if (!ofs) {
+        pagmo_throw(std::runtime_error, "Error writing the trace events into the file '" + filename + "'");
+    }
+}
+
+} // namespace pagmo
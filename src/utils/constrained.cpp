@@ -37,6 +37,7 @@ see https://www.gnu.org/licenses/. */
 #include <pagmo/exceptions.hpp>
 #include <pagmo/types.hpp>
 #include <pagmo/utils/constrained.hpp>
+#include <pagmo/utils/generic.hpp>
 
 namespace pagmo
 {
@@ -101,24 +102,8 @@ bool compare_fc(const vector_double &f1, const vector_double &f2, vector_double:
                         + "(it must be striclty smaller as the objfun is assumed to be at position 0)");
     }
 
-    auto c1eq = detail::test_eq_constraints(f1.data() + 1, f1.data() + 1 + neq, tol.data());
-    auto c1ineq = detail::test_ineq_constraints(f1.data() + 1 + neq, f1.data() + f1.size(), tol.data() + neq);
-    auto n1 = c1eq.first + c1ineq.first;
-    auto l1 = c1eq.second + c1ineq.second;
-
-    auto c2eq = detail::test_eq_constraints(f2.data() + 1, f2.data() + 1 + neq, tol.data());
-    auto c2ineq = detail::test_ineq_constraints(f2.data() + 1 + neq, f2.data() + f2.size(), tol.data() + neq);
-    auto n2 = c2eq.first + c2ineq.first;
-    auto l2 = std::sqrt(c2eq.second * c2eq.second + c2ineq.second * c2ineq.second);
-    if (n1 == n2) {                 // same number of constraints satistfied
-        if (n1 == f1.size() - 1u) { // fitness decides
-            return detail::less_than_f(f1[0], f2[0]);
-        } else { // l2 norm decides
-            return detail::less_than_f(l1, l2);
-        }
-    } else { // number of constraints satisfied decides
-        return n1 > n2;
-    }
+    return detail::compare_fc_summary(f1[0], detail::make_fc_summary(f1, neq, tol), f2[0],
+                                      detail::make_fc_summary(f2, neq, tol), f1.size() - 1u);
 }
 
 /** Compares two fitness vectors in a single-objective, constrained, case (from a scalar tolerance)
@@ -237,4 +222,216 @@ std::vector<pop_size_t> sort_population_con(const std::vector<vector_double> &in
     return sort_population_con(input_f, neq, tol_vector);
 }
 
+namespace detail
+{
+
+namespace
+{
+
+// Checks the input of min/max_element_population_con() and computes the
+// constraint summaries of all the fitness vectors in input_f.
+std::vector<fc_summary> population_con_summaries(const std::vector<vector_double> &input_f,
+                                                 vector_double::size_type neq, const vector_double &tol,
+                                                 const char *name)
+{
+    if (input_f.empty()) {
+        pagmo_throw(std::invalid_argument, std::string("Cannot determine the ") + name
+                                               + " fitness vector of an empty set of fitness vectors");
+    }
+    const auto M = input_f[0].size();
+    if (M < 1u) {
+        pagmo_throw(std::invalid_argument, "Fitness dimension should be at least 1 to compare: a dimension of "
+                                               + std::to_string(M) + " was detected. ");
+    }
+    for (const auto &f : input_f) {
+        if (f.size() != M) {
+            pagmo_throw(std::invalid_argument, "Fitness dimensions should be equal: " + std::to_string(f.size())
+                                                   + " != " + std::to_string(M));
+        }
+    }
+    if (M - 1u != tol.size()) {
+        pagmo_throw(std::invalid_argument,
+                    "Tolerance vector dimension is detected to be: " + std::to_string(tol.size())
+                        + ", while the fitness dimension is: " + std::to_string(M)
+                        + ", I was expecting the tolerance vector dimension to be: " + std::to_string(M - 1u));
+    }
+    if (neq > M - 1u) {
+        pagmo_throw(std::invalid_argument,
+                    "Number of equality constraints declared: " + std::to_string(neq)
+                        + " while fitness vector has dimension: " + std::to_string(M)
+                        + "(it must be striclty smaller as the objfun is assumed to be at position 0)");
+    }
+    std::vector<fc_summary> retval;
+    retval.reserve(input_f.size());
+    for (const auto &f : input_f) {
+        retval.push_back(make_fc_summary(f, neq, tol));
+    }
+    return retval;
+}
+
+} // namespace
+
+} // namespace detail
+
+/// Index of the best fitness vector in a single-objective, constrained, case (from a vector of tolerances)
+/**
+ * Returns the index of the first fitness vector in \p input_f which is not worse than any other fitness
+ * vector according to the strict ordering defined in pagmo::compare_fc(). This is the same as the first
+ * element of the output of pagmo::sort_population_con(), but it is computed in linear time, and the
+ * constraints of each fitness vector are tested only once.
+ *
+ * @param input_f an <tt>std::vector</tt> of fitness vectors (containing objectives and constraints)
+ * @param neq number of equality constraints
+ * @param tol a vector_double containing tolerances to be accouted for in the constraints
+ *
+ * @return the index of the best fitness vector
+ *
+ * @throws std::invalid_argument If \p input_f is empty
+ * @throws std::invalid_argument If the input fitness vectors do not have all the same size \f$n >=1\f$
+ * @throws std::invalid_argument If \p neq is larger than \f$n - 1\f$ (too many constraints)
+ * @throws std::invalid_argument If the size of the \p tol is not \f$n - 1\f$
+ */
+pop_size_t min_element_population_con(const std::vector<vector_double> &input_f, vector_double::size_type neq,
+                                      const vector_double &tol)
+{
+    const auto s = detail::population_con_summaries(input_f, neq, tol, "best");
+    const auto nc = input_f[0].size() - 1u;
+    pop_size_t retval = 0;
+    for (decltype(s.size()) i = 1u; i < s.size(); ++i) {
+        if (detail::compare_fc_summary(input_f[i][0], s[i], input_f[retval][0], s[retval], nc)) {
+            retval = i;
+        }
+    }
+    return retval;
+}
+
+/// Index of the best fitness vector in a single-objective, constrained, case (from a scalar tolerance)
+/**
+ * @param input_f an <tt>std::vector</tt> of fitness vectors (containing objectives and constraints)
+ * @param neq number of equality constraints
+ * @param tol scalar tolerance to be accouted for in the constraints
+ *
+ * @return the index of the best fitness vector
+ *
+ * @throws unspecified any exception thrown by the previous overload of pagmo::min_element_population_con().
+ */
+pop_size_t min_element_population_con(const std::vector<vector_double> &input_f, vector_double::size_type neq,
+                                      double tol)
+{
+    // NOTE: if input_f or its first element are empty, the other overload will throw.
+    const auto n_tol = (input_f.empty() || input_f[0].empty()) ? vector_double::size_type(0) : input_f[0].size() - 1u;
+    return min_element_population_con(input_f, neq, vector_double(n_tol, tol));
+}
+
+/// Index of the worst fitness vector in a single-objective, constrained, case (from a vector of tolerances)
+/**
+ * Returns the index of the last fitness vector in \p input_f which is not better than any other fitness
+ * vector according to the strict ordering defined in pagmo::compare_fc(). This is the same as the last
+ * element of the output of pagmo::sort_population_con(), but it is computed in linear time, and the
+ * constraints of each fitness vector are tested only once.
+ *
+ * @param input_f an <tt>std::vector</tt> of fitness vectors (containing objectives and constraints)
+ * @param neq number of equality constraints
+ * @param tol a vector_double containing tolerances to be accouted for in the constraints
+ *
+ * @return the index of the worst fitness vector
+ *
+ * @throws std::invalid_argument If \p input_f is empty
+ * @throws std::invalid_argument If the input fitness vectors do not have all the same size \f$n >=1\f$
+ * @throws std::invalid_argument If \p neq is larger than \f$n - 1\f$ (too many constraints)
+ * @throws std::invalid_argument If the size of the \p tol is not \f$n - 1\f$
+ */
+pop_size_t max_element_population_con(const std::vector<vector_double> &input_f, vector_double::size_type neq,
+                                      const vector_double &tol)
+{
+    const auto s = detail::population_con_summaries(input_f, neq, tol, "worst");
+    const auto nc = input_f[0].size() - 1u;
+    pop_size_t retval = 0;
+    for (decltype(s.size()) i = 1u; i < s.size(); ++i) {
+        if (!detail::compare_fc_summary(input_f[i][0], s[i], input_f[retval][0], s[retval], nc)) {
+            retval = i;
+        }
+    }
+    return retval;
+}
+
+/// Index of the worst fitness vector in a single-objective, constrained, case (from a scalar tolerance)
+/**
+ * @param input_f an <tt>std::vector</tt> of fitness vectors (containing objectives and constraints)
+ * @param neq number of equality constraints
+ * @param tol scalar tolerance to be accouted for in the constraints
+ *
+ * @return the index of the worst fitness vector
+ *
+ * @throws unspecified any exception thrown by the previous overload of pagmo::max_element_population_con().
+ */
+pop_size_t max_element_population_con(const std::vector<vector_double> &input_f, vector_double::size_type neq,
+                                      double tol)
+{
+    // NOTE: if input_f or its first element are empty, the other overload will throw.
+    const auto n_tol = (input_f.empty() || input_f[0].empty()) ? vector_double::size_type(0) : input_f[0].size() - 1u;
+    return max_element_population_con(input_f, neq, vector_double(n_tol, tol));
+}
+
+/// Selects the best N individuals in a single-objective, constrained, case (from a vector of tolerances)
+/**
+ * Returns the indices of the best \f$N\f$ fitness vectors in \p input_f according to the strict
+ * ordering defined in pagmo::compare_fc(), ordered from the best to the worst one. This is the same as
+ * the first \f$N\f$ elements of the output of pagmo::sort_population_con(), but only the selected
+ * individuals are sorted, so that the complexity is \f$ O(M + N\log N)\f$ where \f$M\f$ is the size
+ * of \p input_f. The constraints of each fitness vector are tested only once.
+ *
+ * If \p N is larger than the number of input fitness vectors, the indices of the whole
+ * population, sorted, are returned.
+ *
+ * @param input_f an <tt>std::vector</tt> of fitness vectors (containing objectives and constraints)
+ * @param N number of best individuals to return
+ * @param neq number of equality constraints
+ * @param tol a vector_double containing tolerances to be accouted for in the constraints
+ *
+ * @return an <tt>std::vector</tt> containing the indices of the best \p N individuals
+ *
+ * @throws std::invalid_argument If the input fitness vectors do not have all the same size \f$n >=1\f$
+ * @throws std::invalid_argument If \p neq is larger than \f$n - 1\f$ (too many constraints)
+ * @throws std::invalid_argument If the size of the \p tol is not \f$n - 1\f$
+ */
+std::vector<pop_size_t> select_best_N_con(const std::vector<vector_double> &input_f, pop_size_t N,
+                                          vector_double::size_type neq, const vector_double &tol)
+{
+    if (input_f.empty()) {
+        return {};
+    }
+    const auto s = detail::population_con_summaries(input_f, neq, tol, "best");
+    const auto nc = input_f[0].size() - 1u;
+    N = std::min(N, input_f.size());
+    std::vector<pop_size_t> retval(input_f.size());
+    std::iota(retval.begin(), retval.end(), pop_size_t(0));
+    detail::select_top_k(retval.begin(), retval.begin() + static_cast<std::vector<pop_size_t>::difference_type>(N),
+                         retval.end(), [&input_f, &s, nc](pop_size_t idx1, pop_size_t idx2) {
+                             return detail::compare_fc_summary(input_f[idx1][0], s[idx1], input_f[idx2][0], s[idx2],
+                                                               nc);
+                         });
+    retval.resize(N);
+    return retval;
+}
+
+/// Selects the best N individuals in a single-objective, constrained, case (from a scalar tolerance)
+/**
+ * @param input_f an <tt>std::vector</tt> of fitness vectors (containing objectives and constraints)
+ * @param N number of best individuals to return
+ * @param neq number of equality constraints
+ * @param tol scalar tolerance to be accouted for in the constraints
+ *
+ * @return an <tt>std::vector</tt> containing the indices of the best \p N individuals
+ *
+ * @throws unspecified any exception thrown by the previous overload of pagmo::select_best_N_con().
+ */
+std::vector<pop_size_t> select_best_N_con(const std::vector<vector_double> &input_f, pop_size_t N,
+                                          vector_double::size_type neq, double tol)
+{
+    // NOTE: if the first element of input_f is empty, the other overload will throw.
+    const auto n_tol = (input_f.empty() || input_f[0].empty()) ? vector_double::size_type(0) : input_f[0].size() - 1u;
+    return select_best_N_con(input_f, N, neq, vector_double(n_tol, tol));
+}
+
 } // namespace pagmo
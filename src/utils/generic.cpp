@@ -87,6 +87,46 @@ double binomial_coefficient(vector_double::size_type n, vector_double::size_type
     }
 }
 
+/// Selects the best N individuals in a single-objective, unconstrained, case
+/**
+ * Returns the indices of the \f$N\f$ fitness vectors with the lowest objective value
+ * (i.e., the first component of each fitness vector), ordered from the best to the worst one.
+ * Fitness vectors containing a NaN objective are considered worse than any other fitness vector.
+ * If \p N is larger than the number of input fitness vectors, the indices of the whole
+ * population, sorted, are returned.
+ *
+ * Complexity is \f$ O(M + N\log N)\f$ where \f$M\f$ is the size of the input population,
+ * as only the selected individuals are sorted.
+ *
+ * Example:
+ * @code{.unparsed}
+ * select_best_N_so({{3},{1},{nan},{2}}, 2u) => {1, 3}
+ * @endcode
+ *
+ * @param input_f an <tt>std::vector</tt> of fitness vectors
+ * @param N number of best individuals to return
+ *
+ * @returns an <tt>std::vector</tt> containing the indices of the best \p N individuals
+ *
+ * @throws std::invalid_argument if any of the fitness vectors is empty
+ */
+std::vector<pop_size_t> select_best_N_so(const std::vector<vector_double> &input_f, pop_size_t N)
+{
+    if (std::any_of(input_f.begin(), input_f.end(), [](const vector_double &f) { return f.empty(); })) {
+        pagmo_throw(std::invalid_argument, "Cannot select the best individuals of a population if some of the "
+                                           "fitness vectors are empty");
+    }
+    N = std::min(N, input_f.size());
+    std::vector<pop_size_t> retval(input_f.size());
+    std::iota(retval.begin(), retval.end(), pop_size_t(0u));
+    detail::select_top_k(retval.begin(), retval.begin() + static_cast<std::vector<pop_size_t>::difference_type>(N),
+                         retval.end(), [&input_f](pop_size_t idx1, pop_size_t idx2) {
+                             return detail::less_than_f(input_f[idx1][0], input_f[idx2][0]);
+                         });
+    retval.resize(N);
+    return retval;
+}
+
 /// K-Nearest Neighbours
 /**
  * Computes the indexes of the k nearest neighbours (euclidean distance) to each of the input points.
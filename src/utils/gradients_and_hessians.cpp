@@ -0,0 +1,446 @@
+/* Copyright 2017-2020 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <pagmo/bfe.hpp>
+#include <pagmo/exceptions.hpp>
+#include <pagmo/problem.hpp>
+#include <pagmo/types.hpp>
+#include <pagmo/utils/gradients_and_hessians.hpp>
+
+namespace pagmo
+{
+
+namespace
+{
+
+// Maximum number of values in the batch of decision vectors
+// passed to a bfe in a single call (128MB worth of doubles).
+// Larger sets of perturbed points are evaluated in several batches.
+constexpr vector_double::size_type fd_max_batch_values = 1ul << 24;
+
+// Check that x is compatible with the problem p.
+void fd_check_x(const problem &p, const vector_double &x, const char *fname)
+{
+    if (x.size() != p.get_nx()) {
+        pagmo_throw(std::invalid_argument, "The decision vector passed to " + std::string(fname) + "() has a size of "
+                                               + std::to_string(x.size()) + ", but the problem has a dimension of "
+                                               + std::to_string(p.get_nx()));
+    }
+}
+
+// Size of the perturbation of the component xj.
+double fd_step(double xj, double dx)
+{
+    return std::max(std::abs(xj), 1.) * dx;
+}
+
+// Evaluate via b the npoints perturbations of x produced by the functor gen.
+//
+// gen(k, dv) perturbs the k-th decision vector, dv, which is initially equal to x.
+// The points are organised in groups of gsize points, and use(k, f) is
+// invoked with the index k of the first point of each group and a pointer f
+// to the gsize fitness vectors of the group, stored contiguously.
+template <typename Gen, typename Use>
+void fd_batch_eval(const problem &p, const bfe &b, const vector_double &x, vector_double::size_type npoints,
+                   vector_double::size_type gsize, const Gen &gen, const Use &use)
+{
+    assert(gsize > 0u);
+    assert(npoints % gsize == 0u);
+
+    const auto nx = x.size();
+    const auto nf = p.get_nf();
+
+    // Number of points in each batch (a multiple of gsize).
+    const auto bsize = std::max(fd_max_batch_values / std::max(nx, vector_double::size_type(1)) / gsize * gsize, gsize);
+
+    vector_double dvs;
+    for (vector_double::size_type start = 0; start < npoints; start += bsize) {
+        const auto n = std::min(bsize, npoints - start);
+        dvs.resize(n * nx);
+        for (vector_double::size_type k = 0; k < n; ++k) {
+            const auto dv = dvs.data() + k * nx;
+            std::copy(x.begin(), x.end(), dv);
+            gen(start + k, dv);
+        }
+        const auto fvs = b(p, dvs);
+        for (vector_double::size_type k = 0; k < n; k += gsize) {
+            use(start + k, fvs.data() + k * nf);
+        }
+    }
+}
+
+} // namespace
+
+/// Heuristic to estimate the sparsity pattern (batch version)
+/**
+ * This function is equivalent to pagmo::estimate_sparsity(Func, const vector_double &, double) applied to the fitness
+ * function of \p p, but the perturbed decision vectors are evaluated via the batch fitness evaluator \p b.
+ * The fitness of the \f$n\f$ perturbed decision vectors is computed in a single call to \p b (or in a few calls,
+ * for very large problems), while the fitness at \p x is computed via pagmo::problem::fitness().
+ *
+ * @param p the problem.
+ * @param b the batch fitness evaluator.
+ * @param x decision vector to test the sparsity around.
+ * @param dx To detect the sparsity each component of the input decision vector \p x will be changed by
+ * \f$\max(|x_i|,1) * \f$ \p dx.
+ *
+ * @return the sparsity pattern of the fitness function of \p p as detected around \p x.
+ *
+ * @throws std::invalid_argument if the size of \p x differs from the dimension of \p p.
+ * @throws unspecified any exception thrown by pagmo::problem::fitness() or by the invocation of \p b.
+ */
+sparsity_pattern estimate_sparsity(const problem &p, const bfe &b, const vector_double &x, double dx)
+{
+    fd_check_x(p, x, "estimate_sparsity");
+
+    const auto nx = x.size();
+    const auto nf = p.get_nf();
+    const auto f0 = p.fitness(x);
+
+    // NOTE: store the fitness vectors of all the
+    // perturbed points, so that the pattern can be built
+    // directly in lexicographic order.
+    vector_double fvs(nx * nf);
+    fd_batch_eval(
+        p, b, x, nx, 1u, [&x, dx](vector_double::size_type j, double *dv) { dv[j] = x[j] + fd_step(x[j], dx); },
+        [&fvs, nf](vector_double::size_type j, const double *f) { std::copy(f, f + nf, fvs.data() + j * nf); });
+
+    sparsity_pattern retval;
+    for (vector_double::size_type i = 0; i < nf; ++i) {
+        for (vector_double::size_type j = 0; j < nx; ++j) {
+            if (fvs[j * nf + i] != f0[i]) {
+                retval.emplace_back(i, j);
+            }
+        }
+    }
+    return retval;
+}
+
+/// Numerical computation of the gradient (low-order, batch version)
+/**
+ * This function is equivalent to pagmo::estimate_gradient(Func, const vector_double &, double) applied to the fitness
+ * function of \p p, but the \f$2n\f$ perturbed decision vectors are evaluated via the batch fitness evaluator \p b
+ * in a single call (or in a few calls, for very large problems).
+ *
+ * @param p the problem.
+ * @param b the batch fitness evaluator.
+ * @param x decision vector around which the gradient is estimated.
+ * @param dx To detect the numerical derivative each component of the input decision vector \p x will be varied by
+ * \f$\max(|x_i|,1) * \f$ \p dx.
+ *
+ * @return the dense gradient of the fitness function of \p p approximated around \p x.
+ *
+ * @throws std::invalid_argument if the size of \p x differs from the dimension of \p p.
+ * @throws unspecified any exception thrown by the invocation of \p b.
+ */
+vector_double estimate_gradient(const problem &p, const bfe &b, const vector_double &x, double dx)
+{
+    fd_check_x(p, x, "estimate_gradient");
+
+    const auto nx = x.size();
+    const auto nf = p.get_nf();
+
+    vector_double gradient(nf * nx, 0.);
+    // NOTE: for each variable j, the points 2j and 2j + 1
+    // are the right and left perturbations.
+    fd_batch_eval(
+        p, b, x, 2u * nx, 2u,
+        [&x, dx](vector_double::size_type k, double *dv) {
+            const auto j = k / 2u;
+            const auto h = fd_step(x[j], dx);
+            dv[j] = (k % 2u) ? x[j] - h : x[j] + h;
+        },
+        [&x, dx, &gradient, nx, nf](vector_double::size_type k, const double *f) {
+            const auto j = k / 2u;
+            const auto h = fd_step(x[j], dx);
+            const auto f_r = f, f_l = f + nf;
+            for (vector_double::size_type i = 0; i < nf; ++i) {
+                gradient[j + i * nx] = (f_r[i] - f_l[i]) / 2. / h;
+            }
+        });
+    return gradient;
+}
+
+/// Numerical computation of the gradient (high-order, batch version)
+/**
+ * This function is equivalent to pagmo::estimate_gradient_h(Func, const vector_double &, double) applied to the
+ * fitness function of \p p, but the \f$6n\f$ perturbed decision vectors are evaluated via the batch fitness evaluator
+ * \p b in a single call (or in a few calls, for very large problems).
+ *
+ * @param p the problem.
+ * @param b the batch fitness evaluator.
+ * @param x decision vector around which the gradient is estimated.
+ * @param dx To detect the numerical derivative each component of the input decision vector \p x will be varied by
+ * \f$\max(|x_i|,1) * \f$ \p dx.
+ *
+ * @return the dense gradient of the fitness function of \p p approximated around \p x.
+ *
+ * @throws std::invalid_argument if the size of \p x differs from the dimension of \p p.
+ * @throws unspecified any exception thrown by the invocation of \p b.
+ */
+vector_double estimate_gradient_h(const problem &p, const bfe &b, const vector_double &x, double dx)
+{
+    fd_check_x(p, x, "estimate_gradient_h");
+
+    const auto nx = x.size();
+    const auto nf = p.get_nf();
+
+    // The perturbations, in units of h, of the 6 points
+    // used for each variable.
+    constexpr std::array<double, 6> steps = {{1., -1., 2., -2., 3., -3.}};
+
+    vector_double gradient(nf * nx, 0.);
+    fd_batch_eval(
+        p, b, x, 6u * nx, 6u,
+        [&x, dx, &steps](vector_double::size_type k, double *dv) {
+            const auto j = k / 6u;
+            dv[j] = x[j] + steps[k % 6u] * fd_step(x[j], dx);
+        },
+        [&x, dx, &gradient, nx, nf](vector_double::size_type k, const double *f) {
+            const auto j = k / 6u;
+            const auto h = fd_step(x[j], dx);
+            const auto f_r1 = f, f_l1 = f + nf, f_r2 = f + 2u * nf, f_l2 = f + 3u * nf, f_r3 = f + 4u * nf,
+                       f_l3 = f + 5u * nf;
+            for (vector_double::size_type i = 0; i < nf; ++i) {
+                const double m1 = (f_r1[i] - f_l1[i]) / 2.;
+                const double m2 = (f_r2[i] - f_l2[i]) / 4.;
+                const double m3 = (f_r3[i] - f_l3[i]) / 6.;
+                gradient[j + i * nx] = ((15. * m1 - 6. * m2) + m3) / (10. * h);
+            }
+        });
+    return gradient;
+}
+
+/// Numerical computation of the sparse gradient (batch version)
+/**
+ * This function will estimate, via central differences, the components of the gradient of the fitness function
+ * of \p p listed in the sparsity pattern returned by pagmo::problem::gradient_sparsity(). The returned
+ * vector is thus in the format expected by pagmo::problem::gradient().
+ *
+ * The variables which appear in the sparsity pattern are partitioned, via a greedy colouring of their
+ * intersection graph (Curtis, Powell and Reid), into groups of variables not sharing any fitness component.
+ * All the variables of a group are perturbed at the same time, and the \f$2m\f$ perturbed decision
+ * vectors (where \f$m\f$ is the number of groups) are evaluated via the batch fitness evaluator \p b
+ * in a single call (or in a few calls, for very large problems). For banded patterns, \f$m\f$ does not depend
+ * on the problem dimension, while a dense fitness component (e.g., the objective in most constrained problems)
+ * forces a separate group for each variable. The numerical approximation of each derivative is the same as in
+ * pagmo::estimate_gradient().
+ *
+ * **NOTE** the result is correct only if the sparsity pattern of \p p includes all the non-zero components
+ * of the gradient: a dependency missing from the pattern will pollute the derivatives of the variables
+ * grouped together.
+ *
+ * @param p the problem.
+ * @param b the batch fitness evaluator.
+ * @param x decision vector around which the gradient is estimated.
+ * @param dx To detect the numerical derivative each component of the input decision vector \p x will be varied by
+ * \f$\max(|x_i|,1) * \f$ \p dx.
+ *
+ * @return the sparse gradient of the fitness function of \p p approximated around \p x.
+ *
+ * @throws std::invalid_argument if the size of \p x differs from the dimension of \p p.
+ * @throws unspecified any exception thrown by pagmo::problem::gradient_sparsity() or by the invocation of \p b.
+ */
+vector_double estimate_sparse_gradient(const problem &p, const bfe &b, const vector_double &x, double dx)
+{
+    fd_check_x(p, x, "estimate_sparse_gradient");
+
+    const auto nx = x.size();
+    const auto nf = p.get_nf();
+    const auto sp = p.gradient_sparsity();
+
+    // For each variable, the indices of the elements
+    // of the sparsity pattern in which it appears and, for each
+    // fitness component, the variables it depends on.
+    std::vector<std::vector<sparsity_pattern::size_type>> col_entries(nx);
+    std::vector<std::vector<vector_double::size_type>> row_cols(nf);
+    for (sparsity_pattern::size_type e = 0; e < sp.size(); ++e) {
+        col_entries[sp[e].second].push_back(e);
+        row_cols[sp[e].first].push_back(sp[e].second);
+    }
+
+    // Greedy colouring of the variables: a variable is assigned to the first group
+    // which does not contain any variable sharing a fitness component with it.
+    // forbidden[g] == j signals that the group g is not available for the variable j.
+    constexpr auto no_group = std::numeric_limits<vector_double::size_type>::max();
+    std::vector<vector_double::size_type> col_group(nx, no_group), forbidden;
+    std::vector<std::vector<vector_double::size_type>> groups;
+    for (vector_double::size_type j = 0; j < nx; ++j) {
+        if (col_entries[j].empty()) {
+            continue;
+        }
+        for (const auto e : col_entries[j]) {
+            for (const auto k : row_cols[sp[e].first]) {
+                if (col_group[k] != no_group) {
+                    forbidden[col_group[k]] = j;
+                }
+            }
+        }
+        const auto g = static_cast<vector_double::size_type>(
+            std::find_if(forbidden.begin(), forbidden.end(), [j](vector_double::size_type n) { return n != j; })
+            - forbidden.begin());
+        if (g == groups.size()) {
+            groups.emplace_back();
+            forbidden.push_back(no_group);
+        }
+        groups[g].push_back(j);
+        col_group[j] = g;
+    }
+
+    vector_double retval(sp.size());
+    fd_batch_eval(
+        p, b, x, 2u * groups.size(), 2u,
+        [&x, dx, &groups](vector_double::size_type k, double *dv) {
+            for (const auto j : groups[k / 2u]) {
+                const auto h = fd_step(x[j], dx);
+                dv[j] = (k % 2u) ? x[j] - h : x[j] + h;
+            }
+        },
+        [&](vector_double::size_type k, const double *f) {
+            const auto f_r = f, f_l = f + nf;
+            for (const auto j : groups[k / 2u]) {
+                const auto h = fd_step(x[j], dx);
+                for (const auto e : col_entries[j]) {
+                    const auto i = sp[e].first;
+                    retval[e] = (f_r[i] - f_l[i]) / 2. / h;
+                }
+            }
+        });
+    return retval;
+}
+
+/// Numerical computation of the Hessians (batch version)
+/**
+ * This function will estimate, via finite differences, the components of the Hessians of the fitness function
+ * of \p p listed in the sparsity patterns returned by pagmo::problem::hessians_sparsity(). The returned
+ * vector is thus in the format expected by pagmo::problem::hessians().
+ *
+ * The diagonal elements are approximated by
+ *
+ * \f[
+ * \frac{\partial^2 f}{\partial x_j^2} \approx \frac{f(x+h_j) - 2f(x) + f(x-h_j)}{h_j^2},
+ * \f]
+ *
+ * and the off-diagonal elements by
+ *
+ * \f[
+ * \frac{\partial^2 f}{\partial x_j \partial x_k} \approx
+ * \frac{f(x+h_j+h_k) - f(x+h_j-h_k) - f(x-h_j+h_k) + f(x-h_j-h_k)}{4h_jh_k},
+ * \f]
+ *
+ * where \f$h_j = \max(|x_j|,1) dx\f$. The perturbed decision vectors required by the
+ * union of the sparsity patterns of all the fitness components (2 for each diagonal element and 4 for
+ * each off-diagonal element) and \p x itself are evaluated via the batch fitness evaluator \p b
+ * in a single call (or in a few calls, for very large problems).
+ *
+ * @param p the problem.
+ * @param b the batch fitness evaluator.
+ * @param x decision vector around which the Hessians are estimated.
+ * @param dx the relative size of the perturbations.
+ *
+ * @return the sparse Hessians of the fitness function of \p p approximated around \p x.
+ *
+ * @throws std::invalid_argument if the size of \p x differs from the dimension of \p p.
+ * @throws unspecified any exception thrown by pagmo::problem::hessians_sparsity() or by the invocation of \p b.
+ */
+std::vector<vector_double> estimate_hessians(const problem &p, const bfe &b, const vector_double &x, double dx)
+{
+    fd_check_x(p, x, "estimate_hessians");
+
+    const auto nf = p.get_nf();
+    const auto hs = p.hessians_sparsity();
+    assert(hs.size() == nf);
+
+    // Assign to each distinct element of the Hessians the index
+    // of the first of its perturbed points. Point 0 is x itself.
+    std::map<std::pair<vector_double::size_type, vector_double::size_type>, vector_double::size_type> offsets;
+    // For each perturbed point, the perturbed variables and the perturbations
+    // in units of h (a zero perturbation means that the variable is not perturbed).
+    struct fd_point {
+        vector_double::size_type j, k;
+        double sj, sk;
+    };
+    std::vector<fd_point> points{{0, 0, 0., 0.}};
+    for (const auto &sp : hs) {
+        for (const auto &e : sp) {
+            if (offsets.find(e) != offsets.end()) {
+                continue;
+            }
+            offsets.emplace(e, points.size());
+            if (e.first == e.second) {
+                points.push_back({e.first, e.first, 1., 0.});
+                points.push_back({e.first, e.first, -1., 0.});
+            } else {
+                points.push_back({e.first, e.second, 1., 1.});
+                points.push_back({e.first, e.second, 1., -1.});
+                points.push_back({e.first, e.second, -1., 1.});
+                points.push_back({e.first, e.second, -1., -1.});
+            }
+        }
+    }
+
+    vector_double fvs(points.size() * nf);
+    fd_batch_eval(
+        p, b, x, points.size(), 1u,
+        [&x, dx, &points](vector_double::size_type n, double *dv) {
+            const auto &pt = points[n];
+            dv[pt.j] += pt.sj * fd_step(x[pt.j], dx);
+            dv[pt.k] += pt.sk * fd_step(x[pt.k], dx);
+        },
+        [&fvs, nf](vector_double::size_type n, const double *f) { std::copy(f, f + nf, fvs.data() + n * nf); });
+
+    std::vector<vector_double> retval(nf);
+    for (vector_double::size_type i = 0; i < nf; ++i) {
+        retval[i].reserve(hs[i].size());
+        for (const auto &e : hs[i]) {
+            const auto off = offsets.find(e)->second;
+            const auto f = [&fvs, nf, i](vector_double::size_type n) { return fvs[n * nf + i]; };
+            const auto hj = fd_step(x[e.first], dx);
+            if (e.first == e.second) {
+                retval[i].push_back((f(off) - 2. * f(0) + f(off + 1u)) / (hj * hj));
+            } else {
+                const auto hk = fd_step(x[e.second], dx);
+                retval[i].push_back(((f(off) - f(off + 1u)) - (f(off + 2u) - f(off + 3u))) / (4. * hj * hk));
+            }
+        }
+    }
+    return retval;
+}
+
+} // namespace pagmo
@@ -76,6 +76,64 @@ void reksum(std::vector<std::vector<double>> &retval, const std::vector<pop_size
     }
 }
 
+decomposition_method decomposition_method_from_string(const std::string &method)
+{
+    if (method == "weighted") {
+        return decomposition_method::weighted;
+    } else if (method == "tchebycheff") {
+        return decomposition_method::tchebycheff;
+    } else if (method == "bi") {
+        return decomposition_method::bi;
+    }
+    pagmo_throw(std::invalid_argument, "The decomposition method chosen was: " + method
+                                           + R"(, but only "weighted", "tchebycheff" or "bi" are allowed)");
+}
+
+double decompose_objectives_impl(const double *f, const double *weight, const double *ref_point,
+                                 vector_double::size_type nf, decomposition_method method)
+{
+    double fd = 0.;
+    switch (method) {
+        case decomposition_method::weighted:
+            for (decltype(nf) i = 0u; i < nf; ++i) {
+                fd += weight[i] * f[i];
+            }
+            break;
+        case decomposition_method::tchebycheff: {
+            double tmp, fixed_weight;
+            for (decltype(nf) i = 0u; i < nf; ++i) {
+                (weight[i] == 0.) ? (fixed_weight = 1e-4)
+                                  : (fixed_weight = weight[i]); // fixes the numerical problem of 0 weights
+                tmp = fixed_weight * std::abs(f[i] - ref_point[i]);
+                if (tmp > fd) {
+                    fd = tmp;
+                }
+            }
+            break;
+        }
+        case decomposition_method::bi: {
+            const double THETA = 5.;
+            double d1 = 0.;
+            double weight_norm = 0.;
+            for (decltype(nf) i = 0u; i < nf; ++i) {
+                d1 += (f[i] - ref_point[i]) * weight[i];
+                weight_norm += weight[i] * weight[i];
+            }
+            weight_norm = std::sqrt(weight_norm);
+            d1 = d1 / weight_norm;
+
+            double d2 = 0.;
+            for (decltype(nf) i = 0u; i < nf; ++i) {
+                const auto tmp = f[i] - (ref_point[i] + d1 * weight[i] / weight_norm);
+                d2 += tmp * tmp;
+            }
+            d2 = std::sqrt(d2);
+            fd = d1 + THETA * d2;
+        }
+    }
+    return fd;
+}
+
 } // namespace detail
 
 /// Pareto-dominance
@@ -599,43 +657,8 @@ vector_double decompose_objectives(const vector_double &f, const vector_double &
         pagmo_throw(std::invalid_argument, "The number of objectives detected is: " + std::to_string(f.size())
                                                + ". Cannot decompose this into anything.");
     }
-    double fd = 0.;
-    if (method == "weighted") {
-        for (decltype(f.size()) i = 0u; i < f.size(); ++i) {
-            fd += weight[i] * f[i];
-        }
-    } else if (method == "tchebycheff") {
-        double tmp, fixed_weight;
-        for (decltype(f.size()) i = 0u; i < f.size(); ++i) {
-            (weight[i] == 0.) ? (fixed_weight = 1e-4)
-                              : (fixed_weight = weight[i]); // fixes the numerical problem of 0 weights
-            tmp = fixed_weight * std::abs(f[i] - ref_point[i]);
-            if (tmp > fd) {
-                fd = tmp;
-            }
-        }
-    } else if (method == "bi") { // BI method
-        const double THETA = 5.;
-        double d1 = 0.;
-        double weight_norm = 0.;
-        for (decltype(f.size()) i = 0u; i < f.size(); ++i) {
-            d1 += (f[i] - ref_point[i]) * weight[i];
-            weight_norm += std::pow(weight[i], 2);
-        }
-        weight_norm = std::sqrt(weight_norm);
-        d1 = d1 / weight_norm;
-
-        double d2 = 0.;
-        for (decltype(f.size()) i = 0u; i < f.size(); ++i) {
-            d2 += std::pow(f[i] - (ref_point[i] + d1 * weight[i] / weight_norm), 2);
-        }
-        d2 = std::sqrt(d2);
-        fd = d1 + THETA * d2;
-    } else {
-        pagmo_throw(std::invalid_argument, "The decomposition method chosen was: " + method
-                                               + R"(, but only "weighted", "tchebycheff" or "bi" are allowed)");
-    }
-    return {fd};
+    return {detail::decompose_objectives_impl(f.data(), weight.data(), ref_point.data(), f.size(),
+                                              detail::decomposition_method_from_string(method))};
 }
 
 } // namespace pagmo
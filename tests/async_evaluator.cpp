@@ -0,0 +1,200 @@
+/* Copyright 2017-2020 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#define BOOST_TEST_MODULE async_evaluator_test
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <utility>
+
+#include <pagmo/async_evaluator.hpp>
+#include <pagmo/config.hpp>
+#include <pagmo/problem.hpp>
+#include <pagmo/problems/rosenbrock.hpp>
+#include <pagmo/threading.hpp>
+#include <pagmo/types.hpp>
+
+using namespace pagmo;
+
+// A problem whose fitness evaluation takes x[0] milliseconds.
+struct slow_udp {
+    vector_double fitness(const vector_double &x) const
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(static_cast<int>(x[0])));
+        return {x[0]};
+    }
+    std::pair<vector_double, vector_double> get_bounds() const
+    {
+        return {{0.}, {1000.}};
+    }
+};
+
+// A problem which throws when x[0] is negative.
+struct throwing_udp {
+    vector_double fitness(const vector_double &x) const
+    {
+        if (x[0] < 0.) {
+            throw std::invalid_argument("negative input");
+        }
+        return {x[0]};
+    }
+    std::pair<vector_double, vector_double> get_bounds() const
+    {
+        return {{-1.}, {1.}};
+    }
+};
+
+// A problem that is not thread safe.
+struct unsafe_udp {
+    vector_double fitness(const vector_double &x) const
+    {
+        return {x[0] * x[0]};
+    }
+    std::pair<vector_double, vector_double> get_bounds() const
+    {
+        return {{-1.}, {1.}};
+    }
+    thread_safety get_thread_safety() const
+    {
+        return thread_safety::none;
+    }
+};
+
+BOOST_AUTO_TEST_CASE(async_evaluator_construction_test)
+{
+    problem p{rosenbrock{5u}};
+    async_evaluator ev0(p);
+    BOOST_CHECK(ev0.get_backend() == async_backend::thread);
+    BOOST_CHECK(ev0.get_n_workers() > 0u);
+    BOOST_CHECK(ev0.get_n_pending() == 0u);
+    async_evaluator ev1(p, async_backend::thread, 3u);
+    BOOST_CHECK(ev1.get_n_workers() == 3u);
+    BOOST_CHECK(!ev1.poll());
+    BOOST_CHECK_THROW(ev1.wait(), std::invalid_argument);
+    BOOST_CHECK_THROW(ev1.submit(vector_double(4u, 0.)), std::invalid_argument);
+    BOOST_CHECK_THROW(async_evaluator(problem{unsafe_udp{}}, async_backend::thread), std::invalid_argument);
+
+    std::ostringstream oss;
+    oss << async_backend::thread << ' ' << async_backend::fork;
+    BOOST_CHECK_EQUAL(oss.str(), "thread fork");
+}
+
+// Submit n dvs, retrieve all the results and check them against the serial evaluation.
+void check_evaluations(const problem &p, async_backend backend, unsigned n)
+{
+    async_evaluator ev(p, backend, 4u);
+    const auto fevals0 = p.get_fevals();
+    problem p_copy{p};
+    std::set<unsigned long long> ids;
+    for (auto i = 0u; i < n; ++i) {
+        ids.insert(ev.submit(vector_double(p.get_nx(), i * 0.1)));
+    }
+    BOOST_CHECK_EQUAL(ids.size(), n);
+    for (auto i = 0u; i < n; ++i) {
+        auto res = ev.wait();
+        BOOST_CHECK_EQUAL(ids.erase(std::get<0>(res)), 1u);
+        BOOST_CHECK(std::get<2>(res) == p_copy.fitness(std::get<1>(res)));
+    }
+    BOOST_CHECK(ids.empty());
+    BOOST_CHECK_EQUAL(ev.get_n_pending(), 0u);
+    BOOST_CHECK_EQUAL(p.get_fevals() - fevals0, n);
+}
+
+BOOST_AUTO_TEST_CASE(async_evaluator_thread_test)
+{
+    check_evaluations(problem{rosenbrock{5u}}, async_backend::thread, 50u);
+
+    // The results are returned in completion order.
+    problem p{slow_udp{}};
+    async_evaluator ev(p, async_backend::thread, 2u);
+    const auto id_slow = ev.submit({500.});
+    const auto id_fast = ev.submit({1.});
+    BOOST_CHECK_EQUAL(std::get<0>(ev.wait()), id_fast);
+    BOOST_CHECK_EQUAL(ev.get_n_pending(), 1u);
+    BOOST_CHECK_EQUAL(std::get<0>(ev.wait()), id_slow);
+
+    // Poll until a result is available.
+    ev.submit({1.});
+    auto res = ev.poll();
+    while (!res) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        res = ev.poll();
+    }
+    BOOST_CHECK((std::get<2>(*res) == vector_double{1.}));
+
+    // Errors are reported upon retrieval.
+    problem tp{throwing_udp{}};
+    async_evaluator tev(tp, async_backend::thread, 2u);
+    tev.submit({-.5});
+    BOOST_CHECK_THROW(tev.wait(), std::invalid_argument);
+    BOOST_CHECK_EQUAL(tev.get_n_pending(), 0u);
+    BOOST_CHECK_EQUAL(tp.get_fevals(), 0u);
+
+    // Destruction with pending evaluations.
+    {
+        async_evaluator dev(p, async_backend::thread, 2u);
+        dev.submit({50.});
+        dev.submit({50.});
+        dev.submit({50.});
+    }
+    BOOST_CHECK_EQUAL(p.get_fevals(), 3u);
+}
+
+#if defined(PAGMO_WITH_FORK_ISLAND)
+
+BOOST_AUTO_TEST_CASE(async_evaluator_fork_test)
+{
+    check_evaluations(problem{rosenbrock{5u}}, async_backend::fork, 20u);
+    // Problems which are not thread-safe can be used with the fork backend.
+    check_evaluations(problem{unsafe_udp{}}, async_backend::fork, 10u);
+
+    // Errors in the child are reported upon retrieval.
+    problem tp{throwing_udp{}};
+    async_evaluator tev(tp, async_backend::fork, 2u);
+    tev.submit({-.5});
+    tev.submit({.5});
+    std::string msg;
+    for (auto i = 0; i < 2; ++i) {
+        try {
+            BOOST_CHECK((std::get<2>(tev.wait()) == vector_double{.5}));
+        } catch (const std::runtime_error &e) {
+            msg = e.what();
+        }
+    }
+    BOOST_CHECK(msg.find("negative input") != std::string::npos);
+    BOOST_CHECK_EQUAL(tp.get_fevals(), 1u);
+}
+
+#endif
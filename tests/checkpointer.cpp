@@ -0,0 +1,123 @@
+/* Copyright 2017-2020 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#define BOOST_TEST_MODULE checkpointer_test
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <stdexcept>
+#include <string>
+
+#include <pagmo/algorithm.hpp>
+#include <pagmo/algorithms/de.hpp>
+#include <pagmo/archipelago.hpp>
+#include <pagmo/checkpointer.hpp>
+#include <pagmo/island.hpp>
+#include <pagmo/population.hpp>
+#include <pagmo/problems/rosenbrock.hpp>
+#include <pagmo/topologies/ring.hpp>
+#include <pagmo/topology.hpp>
+
+using namespace pagmo;
+
+BOOST_AUTO_TEST_CASE(checkpointer_incremental)
+{
+    archipelago archi{ring{}, 4u, de{10u}, rosenbrock{5u}, 10u, 42u};
+    archi.set_migration_type(migration_type::broadcast);
+
+    checkpointer ck("checkpointer_test_dir");
+    BOOST_CHECK_EQUAL(ck.get_directory(), "checkpointer_test_dir");
+
+    // The first checkpoint writes all the islands.
+    BOOST_CHECK_EQUAL(ck.save(archi), 4u);
+    ck.wait_check();
+    // No changes, no island written.
+    BOOST_CHECK_EQUAL(ck.save(archi), 0u);
+    // Change a single island.
+    archi[1].set_population(population{rosenbrock{5u}, 10u, 43u});
+    BOOST_CHECK_EQUAL(ck.save(archi), 1u);
+    archi[2].set_algorithm(algorithm{de{20u}});
+    BOOST_CHECK_EQUAL(ck.save(archi), 1u);
+    // Evolution changes all the islands.
+    archi.evolve();
+    archi.wait_check();
+    BOOST_CHECK_EQUAL(ck.save(archi), 4u);
+    ck.wait_check();
+
+    // Restore.
+    auto archi2 = ck.load();
+    BOOST_CHECK_EQUAL(archi2.size(), 4u);
+    BOOST_CHECK(archi2.get_champions_f() == archi.get_champions_f());
+    BOOST_CHECK(archi2.get_champions_x() == archi.get_champions_x());
+    BOOST_CHECK(archi2.get_migrants_db() == archi.get_migrants_db());
+    BOOST_CHECK(archi2.get_migration_type() == migration_type::broadcast);
+    BOOST_CHECK(archi2.get_migrant_handling() == archi.get_migrant_handling());
+    BOOST_CHECK(archi2.get_topology().is<ring>());
+    BOOST_CHECK(archi2.get_topology().get_connections(0).first == archi.get_topology().get_connections(0).first);
+    BOOST_CHECK(archi2[2].get_algorithm().extract<de>()->get_extra_info()
+                == archi[2].get_algorithm().extract<de>()->get_extra_info());
+
+    // The restored islands are up to date with respect to the checkpoint.
+    BOOST_CHECK_EQUAL(ck.save(archi2), 0u);
+    // A new island is always written.
+    archi2.push_back(de{10u}, rosenbrock{5u}, 10u);
+    BOOST_CHECK_EQUAL(ck.save(archi2), 1u);
+    ck.wait_check();
+    BOOST_CHECK_EQUAL(ck.load().size(), 5u);
+}
+
+BOOST_AUTO_TEST_CASE(checkpointer_evolving)
+{
+    // Checkpoint while the archipelago is evolving.
+    archipelago archi{ring{}, 4u, de{10u}, rosenbrock{5u}, 10u, 42u};
+    checkpointer ck("checkpointer_test_dir");
+    archi.evolve(20u);
+    for (auto i = 0; i < 5; ++i) {
+        ck.save(archi);
+    }
+    archi.wait_check();
+    ck.save(archi);
+    auto archi2 = ck.load();
+    BOOST_CHECK_EQUAL(archi2.size(), 4u);
+    BOOST_CHECK(archi2.get_champions_f() == archi.get_champions_f());
+    // The restored archipelago can evolve.
+    archi2.evolve();
+    archi2.wait_check();
+}
+
+BOOST_AUTO_TEST_CASE(checkpointer_errors)
+{
+    archipelago archi{4u, de{10u}, rosenbrock{5u}, 10u, 42u};
+    checkpointer ck("./this_directory_does_not_exist");
+    BOOST_CHECK_EQUAL(ck.save(archi), 4u);
+    BOOST_CHECK_THROW(ck.wait_check(), std::runtime_error);
+    // After a failure, all the islands are written again.
+    BOOST_CHECK_EQUAL(ck.save(archi), 4u);
+    BOOST_CHECK_THROW(ck.load(), std::runtime_error);
+    BOOST_CHECK_THROW(ck.load(), std::runtime_error);
+}
@@ -40,6 +40,8 @@ see https://www.gnu.org/licenses/. */
 
 #include <pagmo/algorithm.hpp>
 #include <pagmo/algorithms/cmaes.hpp>
+#include <pagmo/batch_evaluators/thread_bfe.hpp>
+#include <pagmo/bfe.hpp>
 #include <pagmo/population.hpp>
 #include <pagmo/problems/hock_schittkowsky_71.hpp>
 #include <pagmo/problems/inventory.hpp>
@@ -288,3 +290,42 @@ BOOST_AUTO_TEST_CASE(cmaes_memory_test)
     BOOST_CHECK_CLOSE(std::get<2>(log[0]), std::get<2>(log2[1]), 1e-8);
     // the 1 and 0 will be different as fevals is reset at each evolve
 }
+
+BOOST_AUTO_TEST_CASE(cmaes_bfe_test)
+{
+    // Evolving with a bfe must give the same result as the serial evolution.
+    cmaes user_algo{20u, -1, -1, -1, -1, 0.5, 1e-6, 1e-6, false, false, 23u};
+    user_algo.set_verbosity(1u);
+    problem prob{rosenbrock{25u}};
+    population pop{prob, 10u, 23u};
+    pop = user_algo.evolve(pop);
+
+    cmaes user_algo2{20u, -1, -1, -1, -1, 0.5, 1e-6, 1e-6, false, false, 23u};
+    user_algo2.set_verbosity(1u);
+    user_algo2.set_bfe(bfe{thread_bfe{}});
+    population pop2{prob, 10u, 23u};
+    pop2 = user_algo2.evolve(pop2);
+
+    BOOST_CHECK(user_algo.get_log().size() > 0u);
+    BOOST_CHECK(user_algo.get_log() == user_algo2.get_log());
+    BOOST_CHECK(pop.get_x() == pop2.get_x());
+    BOOST_CHECK(pop.get_f() == pop2.get_f());
+    BOOST_CHECK(pop.get_problem().get_fevals() == pop2.get_problem().get_fevals());
+
+    // The bfe is preserved by serialization.
+    algorithm algo{user_algo2};
+    std::stringstream ss;
+    {
+        boost::archive::binary_oarchive oarchive(ss);
+        oarchive << algo;
+    }
+    algo = algorithm{};
+    {
+        boost::archive::binary_iarchive iarchive(ss);
+        iarchive >> algo;
+    }
+    population pop3{prob, 10u, 23u};
+    algo.extract<cmaes>()->set_seed(23u);
+    pop3 = algo.evolve(pop3);
+    BOOST_CHECK(pop3.get_x() == pop2.get_x());
+}
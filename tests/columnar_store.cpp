@@ -0,0 +1,171 @@
+/* Copyright 2017-2020 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#define BOOST_TEST_MODULE columnar_store_test
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <ios>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <pagmo/algorithms/de.hpp>
+#include <pagmo/archipelago.hpp>
+#include <pagmo/columnar_store.hpp>
+#include <pagmo/population.hpp>
+#include <pagmo/problems/rosenbrock.hpp>
+#include <pagmo/problems/zdt.hpp>
+#include <pagmo/types.hpp>
+
+using namespace pagmo;
+
+// Check that the snapshot s contains the individuals of pop.
+static void check_snapshot(const columnar_snapshot &s, const population &pop)
+{
+    BOOST_REQUIRE_EQUAL(s.size(), pop.size());
+    BOOST_REQUIRE_EQUAL(s.get_nx(), pop.get_problem().get_nx());
+    BOOST_REQUIRE_EQUAL(s.get_nf(), pop.get_problem().get_nf());
+    for (pop_size_t i = 0; i < pop.size(); ++i) {
+        BOOST_CHECK_EQUAL(s.get_ID()[i], pop.get_ID()[i]);
+        BOOST_CHECK(vector_double(s.get_x() + i * s.get_nx(), s.get_x() + (i + 1u) * s.get_nx()) == pop.get_x()[i]);
+        BOOST_CHECK(vector_double(s.get_f() + i * s.get_nf(), s.get_f() + (i + 1u) * s.get_nf()) == pop.get_f()[i]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(columnar_store_population)
+{
+    const std::string path = "columnar_store_test_dir/pop.colst";
+    std::remove(path.c_str());
+
+    population pop{rosenbrock{5u}, 20u, 42u};
+    {
+        columnar_writer w(path);
+        BOOST_CHECK_EQUAL(w.get_path(), path);
+        w.append(pop, 0);
+        // Evolve and append again.
+        pop = de{1u}.evolve(pop);
+        w.append(pop, 1);
+    }
+    // Append another snapshot, re-opening the store, with
+    // an empty population and a multi-objective population.
+    population pop_mo{zdt{1u, 10u}, 10u, 42u};
+    {
+        columnar_writer w(path);
+        w.append(population{rosenbrock{5u}}, 2);
+        w.append(pop_mo, 3);
+    }
+
+    columnar_reader r(path);
+    BOOST_CHECK_EQUAL(r.get_path(), path);
+    BOOST_REQUIRE_EQUAL(r.size(), 4u);
+
+    BOOST_CHECK_EQUAL(r[0].get_tag(), 0u);
+    BOOST_CHECK_EQUAL(r[1].get_tag(), 1u);
+    BOOST_CHECK_EQUAL(r[1].get_island(), 0u);
+    check_snapshot(r[1], pop);
+    BOOST_REQUIRE(r[1].get_champion_x() != nullptr);
+    BOOST_CHECK(vector_double(r[1].get_champion_x(), r[1].get_champion_x() + 5) == pop.champion_x());
+    BOOST_CHECK(vector_double(r[1].get_champion_f(), r[1].get_champion_f() + 1) == pop.champion_f());
+
+    BOOST_CHECK_EQUAL(r[2].size(), 0u);
+    BOOST_CHECK(r[2].get_champion_x() == nullptr);
+
+    check_snapshot(r[3], pop_mo);
+    BOOST_CHECK(r[3].get_champion_x() == nullptr);
+    BOOST_CHECK(r[3].get_champion_f() == nullptr);
+
+    BOOST_CHECK_THROW(r[4], std::out_of_range);
+
+    // Move semantics.
+    auto r2(std::move(r));
+    BOOST_CHECK_EQUAL(r2.size(), 4u);
+}
+
+BOOST_AUTO_TEST_CASE(columnar_store_archipelago)
+{
+    const std::string path = "columnar_store_test_dir/archi.colst";
+    std::remove(path.c_str());
+
+    archipelago archi{3u, de{5u}, rosenbrock{4u}, 10u, 42u};
+    columnar_writer w(path);
+    for (unsigned long long gen = 0; gen < 3u; ++gen) {
+        archi.evolve();
+        archi.wait_check();
+        w.append(archi, gen);
+    }
+
+    columnar_reader r(path);
+    BOOST_REQUIRE_EQUAL(r.size(), 9u);
+    for (std::size_t i = 0; i < r.size(); ++i) {
+        BOOST_CHECK_EQUAL(r[i].get_tag(), i / 3u);
+        BOOST_CHECK_EQUAL(r[i].get_island(), i % 3u);
+    }
+    for (std::size_t i = 0; i < 3u; ++i) {
+        check_snapshot(r[6u + i], archi[i].get_population());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(columnar_store_errors)
+{
+    const std::string path = "columnar_store_test_dir/errors.colst";
+    std::remove(path.c_str());
+
+    // Non-existing file.
+    BOOST_CHECK_THROW(columnar_reader{path}, std::runtime_error);
+
+    // Not a columnar store.
+    {
+        std::ofstream ofs(path, std::ios::binary);
+        ofs << "hello world, this is not a columnar store";
+    }
+    BOOST_CHECK_THROW(columnar_writer{path}, std::invalid_argument);
+    BOOST_CHECK_THROW(columnar_reader{path}, std::invalid_argument);
+    std::remove(path.c_str());
+
+    // A truncated snapshot is ignored.
+    {
+        columnar_writer w(path);
+        w.append(population{rosenbrock{5u}, 10u, 42u});
+        w.append(population{rosenbrock{5u}, 10u, 43u});
+    }
+    std::string content;
+    {
+        std::ifstream ifs(path, std::ios::binary);
+        content.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+    }
+    {
+        std::ofstream ofs(path, std::ios::binary | std::ios::trunc);
+        ofs.write(content.data(), static_cast<std::streamsize>(content.size() - 8u));
+    }
+    BOOST_CHECK_EQUAL(columnar_reader{path}.size(), 1u);
+}
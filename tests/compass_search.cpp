@@ -37,6 +37,7 @@ see https://www.gnu.org/licenses/. */
 
 #include <pagmo/algorithm.hpp>
 #include <pagmo/algorithms/compass_search.hpp>
+#include <pagmo/bfe.hpp>
 #include <pagmo/io.hpp>
 #include <pagmo/population.hpp>
 #include <pagmo/problems/hock_schittkowsky_71.hpp>
@@ -45,6 +46,7 @@ see https://www.gnu.org/licenses/. */
 #include <pagmo/problems/zdt.hpp>
 #include <pagmo/s11n.hpp>
 #include <pagmo/types.hpp>
+#include <pagmo/utils/constrained.hpp>
 
 using namespace pagmo;
 
@@ -157,3 +159,44 @@ BOOST_AUTO_TEST_CASE(compass_search_serialization_test)
         BOOST_CHECK_CLOSE(std::get<4>(before_log[i]), std::get<4>(after_log[i]), 1e-8);
     }
 }
+
+BOOST_AUTO_TEST_CASE(compass_search_bfe_test)
+{
+    problem prob{rosenbrock{10u}};
+    population pop2{prob, 1u, 23u};
+    compass_search user_algo2{10000u, 0.1, 0.0001, 0.5};
+    user_algo2.set_verbosity(1u);
+    user_algo2.set_bfe(bfe{});
+    pop2 = user_algo2.evolve(pop2);
+    // All the poll points of an iteration are evaluated.
+    BOOST_CHECK_EQUAL((pop2.get_problem().get_fevals() - 1u) % 20u, 0u);
+    for (const auto &l : user_algo2.get_log()) {
+        BOOST_CHECK_EQUAL(std::get<0>(l) % 20u, 0u);
+    }
+    BOOST_CHECK(pop2.get_f()[0][0] < (population{prob, 1u, 23u}.get_f()[0][0]));
+    BOOST_CHECK(prob.fitness(pop2.get_x()[0]) == pop2.get_f()[0]);
+    // With constraints.
+    problem prob2{hock_schittkowsky_71{}};
+    prob2.set_c_tol({1e-3, 1e-3});
+    population pop3{prob2, 5u, 23u};
+    const auto f0 = pop3.get_f()[pop3.best_idx()];
+    compass_search user_algo3{10000u, 0.1, 0.0001, 0.5};
+    user_algo3.set_bfe(bfe{});
+    pop3 = user_algo3.evolve(pop3);
+    BOOST_CHECK(!compare_fc(f0, pop3.get_f()[pop3.best_idx()], 2u, prob2.get_c_tol()));
+    // The bfe survives serialization.
+    algorithm algo{user_algo2};
+    std::stringstream ss;
+    {
+        boost::archive::binary_oarchive oarchive(ss);
+        oarchive << algo;
+    }
+    algo = algorithm{};
+    {
+        boost::archive::binary_iarchive iarchive(ss);
+        iarchive >> algo;
+    }
+    population pop4{prob, 1u, 23u};
+    pop4 = algo.evolve(pop4);
+    BOOST_CHECK(pop4.get_x() == pop2.get_x());
+}
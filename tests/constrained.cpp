@@ -30,7 +30,9 @@ see https://www.gnu.org/licenses/. */
 #define BOOST_TEST_DYN_LINK
 #include <boost/test/unit_test.hpp>
 
+#include <random>
 #include <stdexcept>
+#include <vector>
 
 #include <pagmo/io.hpp>
 #include <pagmo/types.hpp>
@@ -141,3 +143,94 @@ BOOST_AUTO_TEST_CASE(sort_population_con_test)
     BOOST_CHECK_THROW(sort_population_con(example, 0), std::invalid_argument);
     BOOST_CHECK_THROW(sort_population_con(example, 0, tol), std::invalid_argument);
 }
+
+BOOST_AUTO_TEST_CASE(min_max_element_population_con_test)
+{
+    std::vector<vector_double> example;
+    vector_double tol;
+    // Known cases
+    example = {{0, 0, 0}, {1, 1, 0}, {2, 0, 0}};
+    BOOST_CHECK_EQUAL(min_element_population_con(example, 1u), 0u);
+    BOOST_CHECK_EQUAL(max_element_population_con(example, 1u), 1u);
+    example = {{-1, 0, -20}, {0, 0, -1}, {1, 0, -2}};
+    BOOST_CHECK_EQUAL(min_element_population_con(example, 2u, 0.), 1u);
+    BOOST_CHECK_EQUAL(max_element_population_con(example, 2u, 0.), 0u);
+    example = {{-1, 0, 0}, {0, 0, -1}, {1, 0, 0}};
+    tol = {0., 1.};
+    BOOST_CHECK_EQUAL(min_element_population_con(example, 2u, tol), 0u);
+    BOOST_CHECK_EQUAL(max_element_population_con(example, 2u, tol), 2u);
+    example = {{1}, {0}, {2}, {3}};
+    BOOST_CHECK_EQUAL(min_element_population_con(example, 0u), 1u);
+    BOOST_CHECK_EQUAL(max_element_population_con(example, 0u), 3u);
+    // Agreement with sort_population_con() on random fitness vectors.
+    // NOTE: the constraints are either all equalities or all inequalities,
+    // so that the ordering induced by compare_fc() is a strict weak ordering
+    // and the result of the sort is well defined.
+    std::mt19937 r_engine(32u);
+    std::uniform_real_distribution<double> dist(-1., 1.);
+    for (auto trial = 0; trial < 100; ++trial) {
+        example = std::vector<vector_double>(20u, vector_double(5u));
+        for (auto &f : example) {
+            for (auto &v : f) {
+                v = dist(r_engine);
+            }
+        }
+        tol = {0.5, 0.5, 0., 0.};
+        for (auto n_eq : {0u, 4u}) {
+            const auto sorted = sort_population_con(example, n_eq, tol);
+            BOOST_CHECK_EQUAL(min_element_population_con(example, n_eq, tol), sorted.front());
+            BOOST_CHECK_EQUAL(max_element_population_con(example, n_eq, tol), sorted.back());
+        }
+    }
+    // Corner cases and throws
+    example = {{1, 2}};
+    BOOST_CHECK_EQUAL(min_element_population_con(example, 0u), 0u);
+    BOOST_CHECK_EQUAL(max_element_population_con(example, 0u), 0u);
+    BOOST_CHECK_THROW(min_element_population_con({}, 0u), std::invalid_argument);
+    BOOST_CHECK_THROW(max_element_population_con({}, 0u), std::invalid_argument);
+    BOOST_CHECK_THROW(min_element_population_con({{}}, 0u), std::invalid_argument);
+    BOOST_CHECK_THROW(min_element_population_con({{1, 2}, {1}}, 0u), std::invalid_argument);
+    BOOST_CHECK_THROW(min_element_population_con({{1, 2}, {1, 3}}, 0u, vector_double{1., 2.}), std::invalid_argument);
+    BOOST_CHECK_THROW(max_element_population_con({{1, 2}, {1, 3}}, 2u), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(select_best_N_con_test)
+{
+    std::vector<vector_double> example;
+    vector_double tol;
+    // Corner cases
+    BOOST_CHECK(select_best_N_con({}, 2u, 0u).empty());
+    BOOST_CHECK(select_best_N_con({{1, 2}, {2, 0}}, 0u, 0u).empty());
+    BOOST_CHECK((select_best_N_con({{1, 2}}, 3u, 0u) == std::vector<pop_size_t>{0u}));
+    // Known cases
+    example = {{0, 0, 0}, {1, 1, 0}, {2, 0, 0}};
+    BOOST_CHECK((select_best_N_con(example, 2u, 1u) == std::vector<pop_size_t>{0u, 2u}));
+    BOOST_CHECK((select_best_N_con(example, 5u, 1u) == std::vector<pop_size_t>{0u, 2u, 1u}));
+    example = {{-1, 0, 0}, {0, 0, -1}, {1, 0, 0}};
+    tol = {0., 1.};
+    BOOST_CHECK((select_best_N_con(example, 2u, 2u, tol) == std::vector<pop_size_t>{0u, 1u}));
+    // Agreement with sort_population_con() on random fitness vectors.
+    // NOTE: as in the min/max_element tests, the constraints are either all equalities
+    // or all inequalities, so that the sort result is well defined.
+    std::mt19937 r_engine(32u);
+    std::uniform_real_distribution<double> dist(-1., 1.);
+    for (auto trial = 0; trial < 100; ++trial) {
+        example = std::vector<vector_double>(30u, vector_double(5u));
+        for (auto &f : example) {
+            for (auto &v : f) {
+                v = dist(r_engine);
+            }
+        }
+        for (auto n_eq : {0u, 4u}) {
+            const auto sorted = sort_population_con(example, n_eq, 0.5);
+            for (pop_size_t N : {1u, 10u, 30u}) {
+                BOOST_CHECK(select_best_N_con(example, N, n_eq, 0.5)
+                            == std::vector<pop_size_t>(sorted.begin(), sorted.begin() + N));
+            }
+        }
+    }
+    // throws
+    BOOST_CHECK_THROW(select_best_N_con({{1, 2}, {1}}, 1u, 0u), std::invalid_argument);
+    BOOST_CHECK_THROW(select_best_N_con({{1, 2}, {1, 3}}, 1u, 2u), std::invalid_argument);
+    BOOST_CHECK_THROW(select_best_N_con({{1, 2}, {1, 3}}, 1u, 0u, vector_double{1., 2.}), std::invalid_argument);
+}
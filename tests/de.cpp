@@ -32,12 +32,16 @@ see https://www.gnu.org/licenses/. */
 
 #include <iostream>
 #include <string>
+#include <utility>
 
 #include <boost/lexical_cast.hpp>
 #include <boost/test/tools/floating_point_comparison.hpp>
 
 #include <pagmo/algorithm.hpp>
 #include <pagmo/algorithms/de.hpp>
+#include <pagmo/async_evaluator.hpp>
+#include <pagmo/bfe.hpp>
+#include <pagmo/config.hpp>
 #include <pagmo/io.hpp>
 #include <pagmo/population.hpp>
 #include <pagmo/problems/hock_schittkowsky_71.hpp>
@@ -49,6 +53,20 @@ see https://www.gnu.org/licenses/. */
 
 using namespace pagmo;
 
+// A user-defined wrapper of rosenbrock, whose fitness is evaluated
+// through the type-erased interface of the problem.
+struct udp_rosenbrock {
+    vector_double fitness(const vector_double &x) const
+    {
+        return m_r.fitness(x);
+    }
+    std::pair<vector_double, vector_double> get_bounds() const
+    {
+        return m_r.get_bounds();
+    }
+    rosenbrock m_r{10u};
+};
+
 BOOST_AUTO_TEST_CASE(de_algorithm_construction)
 {
     de user_algo{1234u, 0.7, 0.5, 2u, 1e-6, 1e-6, 23u};
@@ -174,3 +192,89 @@ BOOST_AUTO_TEST_CASE(de_serialization_test)
         BOOST_CHECK_CLOSE(std::get<4>(before_log[i]), std::get<4>(after_log[i]), 1e-8);
     }
 }
+
+BOOST_AUTO_TEST_CASE(de_async_test)
+{
+    problem prob{rosenbrock{10u}};
+    population pop{prob, 20u, 23u};
+    const auto best0 = pop.champion_f()[0];
+    de uda{50u, 0.8, 0.9, 2u, 0., 0., 23u};
+    uda.set_async(async_backend::thread, 4u);
+    uda.set_verbosity(10u);
+    BOOST_CHECK(uda.get_extra_info().find("Asynchronous evaluation: thread (4 workers)") != std::string::npos);
+    const auto fevals0 = pop.get_problem().get_fevals();
+    pop = uda.evolve(pop);
+    // The budget of fitness evaluations is the same as in the generational mode.
+    BOOST_CHECK_EQUAL(pop.get_problem().get_fevals() - fevals0, 50u * 20u);
+    BOOST_CHECK(pop.champion_f()[0] <= best0);
+    BOOST_CHECK_EQUAL(uda.get_log().size(), 5u);
+    BOOST_CHECK_EQUAL(std::get<1>(uda.get_log().back()), 41u * 20u);
+    // The population is consistent with the fitness function.
+    for (decltype(pop.size()) i = 0u; i < pop.size(); ++i) {
+        BOOST_CHECK(prob.fitness(pop.get_x()[i]) == pop.get_f()[i]);
+    }
+    // Tolerance-based exit.
+    de uda2{1000u, 0.8, 0.9, 2u, 1e-1, 1e-1, 23u};
+    uda2.set_async(async_backend::thread, 2u);
+    population pop2{rosenbrock{2u}, 10u, 23u};
+    BOOST_CHECK_NO_THROW(uda2.evolve(pop2));
+
+#if defined(PAGMO_WITH_FORK_ISLAND)
+    de uda3{5u, 0.8, 0.9, 2u, 0., 0., 23u};
+    uda3.set_async(async_backend::fork, 2u);
+    population pop3{rosenbrock{10u}, 10u, 23u};
+    pop3 = uda3.evolve(pop3);
+    BOOST_CHECK_EQUAL(pop3.get_problem().get_fevals(), 10u + 5u * 10u);
+#endif
+}
+
+BOOST_AUTO_TEST_CASE(de_bfe_test)
+{
+    // The generational bfe mode gives the same results as the serial mode.
+    problem prob{rosenbrock{10u}};
+    for (unsigned variant = 1u; variant <= 10u; ++variant) {
+        population pop1{prob, 20u, 23u};
+        de uda1{50u, 0.8, 0.9, variant, 0., 0., 23u};
+        uda1.set_verbosity(1u);
+        pop1 = uda1.evolve(pop1);
+
+        population pop2{prob, 20u, 23u};
+        de uda2{50u, 0.8, 0.9, variant, 0., 0., 23u};
+        uda2.set_verbosity(1u);
+        uda2.set_bfe(bfe{});
+        pop2 = uda2.evolve(pop2);
+        BOOST_CHECK(uda1.get_log() == uda2.get_log());
+        BOOST_CHECK(pop1.get_x() == pop2.get_x());
+        BOOST_CHECK(pop1.get_f() == pop2.get_f());
+        BOOST_CHECK_EQUAL(pop2.get_problem().get_fevals(), 20u + 50u * 20u);
+    }
+    // The bfe survives serialization.
+    de uda{2u, 0.8, 0.9, 2u, 0., 0., 23u};
+    uda.set_bfe(bfe{});
+    algorithm algo{uda};
+    std::stringstream ss;
+    {
+        boost::archive::binary_oarchive oarchive(ss);
+        oarchive << algo;
+    }
+    algo = algorithm{};
+    {
+        boost::archive::binary_iarchive iarchive(ss);
+        iarchive >> algo;
+    }
+    population pop{prob, 20u, 23u};
+    pop = algo.evolve(pop);
+    BOOST_CHECK_EQUAL(pop.get_problem().get_fevals(), 20u + 2u * 20u);
+}
+
+BOOST_AUTO_TEST_CASE(de_scalar_fitness_test)
+{
+    // The evolution of a built-in UDP, evaluated via its scalar_fitness() method,
+    // is identical to the evolution of a user-defined UDP providing only fitness().
+    population pop1{rosenbrock{10u}, 20u, 23u}, pop2{udp_rosenbrock{}, 20u, 23u};
+    pop1 = de{10u, 0.8, 0.9, 2u, 1e-6, 1e-6, 42u}.evolve(pop1);
+    pop2 = de{10u, 0.8, 0.9, 2u, 1e-6, 1e-6, 42u}.evolve(pop2);
+    BOOST_CHECK(pop1.get_x() == pop2.get_x());
+    BOOST_CHECK(pop1.get_f() == pop2.get_f());
+    BOOST_CHECK_EQUAL(pop1.get_problem().get_fevals(), pop2.get_problem().get_fevals());
+}
@@ -0,0 +1,291 @@
+/* Copyright 2017-2020 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#define BOOST_TEST_MODULE evaluation_budget_test
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+#include <pagmo/algorithms/compass_search.hpp>
+#include <pagmo/algorithms/de.hpp>
+#include <pagmo/algorithms/mbh.hpp>
+#include <pagmo/algorithms/not_population_based.hpp>
+#include <pagmo/archipelago.hpp>
+#include <pagmo/async_evaluator.hpp>
+#include <pagmo/batch_evaluators/thread_bfe.hpp>
+#include <pagmo/bfe.hpp>
+#include <pagmo/config.hpp>
+#include <pagmo/evaluation_budget.hpp>
+#include <pagmo/population.hpp>
+#include <pagmo/problem.hpp>
+#include <pagmo/problems/rosenbrock.hpp>
+#include <pagmo/problems/zdt.hpp>
+#include <pagmo/s11n.hpp>
+#include <pagmo/types.hpp>
+
+using namespace pagmo;
+
+// A problem providing only the basic thread safety level.
+struct basic_udp {
+    vector_double fitness(const vector_double &x) const
+    {
+        return {x[0] * x[0] + x[1] * x[1]};
+    }
+    std::pair<vector_double, vector_double> get_bounds() const
+    {
+        return {{-1., -1.}, {1., 1.}};
+    }
+};
+
+// Expose the multistart helper of not_population_based.
+struct multistart_tester : not_population_based {
+    using not_population_based::run_multistart;
+};
+
+BOOST_AUTO_TEST_CASE(evaluation_budget_basic)
+{
+    evaluation_budget b0;
+    BOOST_CHECK_EQUAL(b0.get_fevals(), 0u);
+    BOOST_CHECK_EQUAL(b0.get_max_fevals(), std::numeric_limits<unsigned long long>::max());
+    BOOST_CHECK(b0.get_target() == -std::numeric_limits<double>::infinity());
+    BOOST_CHECK(!b0.stop_requested());
+    b0.consume(std::numeric_limits<unsigned long long>::max() - 1u);
+    BOOST_CHECK(!b0.stop_requested());
+    b0.check_target(-1e300);
+    BOOST_CHECK(!b0.stop_requested());
+    b0.request_stop();
+    BOOST_CHECK(b0.stop_requested());
+    b0.reset();
+    BOOST_CHECK(!b0.stop_requested());
+    BOOST_CHECK_EQUAL(b0.get_fevals(), 0u);
+
+    // Maximum number of fitness evaluations.
+    evaluation_budget b1{10u};
+    b1.consume(9u);
+    BOOST_CHECK(!b1.stop_requested());
+    b1.consume(1u);
+    BOOST_CHECK(b1.stop_requested());
+    BOOST_CHECK_EQUAL(b1.get_fevals(), 10u);
+    b1.reset();
+    b1.consume(std::numeric_limits<unsigned long long>::max());
+    BOOST_CHECK(b1.stop_requested());
+    BOOST_CHECK(evaluation_budget{0u}.stop_requested());
+
+    // Target.
+    evaluation_budget b2{std::numeric_limits<unsigned long long>::max(), 1.};
+    BOOST_CHECK_EQUAL(b2.get_target(), 1.);
+    b2.check_target(1.);
+    b2.check_target(std::nan(""));
+    BOOST_CHECK(!b2.stop_requested());
+    b2.check_target(.5);
+    BOOST_CHECK(b2.stop_requested());
+
+    BOOST_CHECK_THROW(evaluation_budget(10u, std::nan("")), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(evaluation_budget_problem)
+{
+    problem p{rosenbrock{2u}};
+    BOOST_CHECK(!p.get_budget());
+    auto b = std::make_shared<evaluation_budget>(100u, 0.5);
+    p.set_budget(b);
+    BOOST_CHECK(p.get_budget() == b);
+
+    // The budget is shared by the copies of the problem.
+    auto p2(p);
+    BOOST_CHECK(p2.get_budget() == b);
+    p.fitness({2., 2.});
+    p2.scalar_fitness({2., 2.});
+    BOOST_CHECK_EQUAL(b->get_fevals(), 2u);
+    BOOST_CHECK(!b->stop_requested());
+
+    // Batch evaluations are not charged twice.
+    const vector_double dvs = {2., 2., 3., 3., 4., 4., 5., 5.};
+    bfe{thread_bfe{}}(p, dvs);
+    BOOST_CHECK_EQUAL(b->get_fevals(), 6u);
+    BOOST_CHECK_EQUAL(p.get_fevals(), 5u);
+    BOOST_CHECK(!b->stop_requested());
+
+    // Target.
+    bfe{thread_bfe{}}(p, {2., 2., 1., 1.});
+    BOOST_CHECK(b->stop_requested());
+    b->reset();
+    p.fitness({1., 1.});
+    BOOST_CHECK(b->stop_requested());
+    b->reset();
+    p2.scalar_fitness({1., 1.});
+    BOOST_CHECK(b->stop_requested());
+
+    // Populations share the budget as well.
+    b->reset();
+    population pop{p, 20u, 42u};
+    BOOST_CHECK(pop.get_problem().get_budget() == b);
+    BOOST_CHECK_EQUAL(b->get_fevals(), 20u);
+
+    // The target is ignored on multi-component fitnesses.
+    problem pmo{zdt{1u, 10u}};
+    auto bmo = std::make_shared<evaluation_budget>(100u, std::numeric_limits<double>::infinity());
+    pmo.set_budget(bmo);
+    pmo.fitness(vector_double(10u, .5));
+    BOOST_CHECK_EQUAL(bmo->get_fevals(), 1u);
+    BOOST_CHECK(!bmo->stop_requested());
+
+    // Detach the budget.
+    p.set_budget(nullptr);
+    BOOST_CHECK(!p.get_budget());
+    p.fitness({1., 1.});
+    BOOST_CHECK_EQUAL(b->get_fevals(), 20u);
+
+    // The budget is not serialised.
+    std::stringstream ss;
+    {
+        boost::archive::binary_oarchive oarchive(ss);
+        oarchive << p2;
+    }
+    {
+        boost::archive::binary_iarchive iarchive(ss);
+        iarchive >> p2;
+    }
+    BOOST_CHECK(!p2.get_budget());
+}
+
+BOOST_AUTO_TEST_CASE(evaluation_budget_archipelago_fevals)
+{
+    problem p{rosenbrock{10u}};
+    auto b = std::make_shared<evaluation_budget>(1000u);
+    p.set_budget(b);
+    archipelago archi{4u, de{1u}, p, 20u, 42u};
+    BOOST_CHECK_EQUAL(b->get_fevals(), 80u);
+
+    // Without the budget, this would require 80000 fitness evaluations.
+    archi.evolve(1000u);
+    archi.wait_check();
+    BOOST_CHECK(b->stop_requested());
+    // Each island might complete the iteration in progress
+    // when the budget is exhausted.
+    BOOST_CHECK(b->get_fevals() >= 1000u);
+    BOOST_CHECK(b->get_fevals() < 1000u + 4u * 20u);
+    unsigned long long tot_fevals = 0;
+    for (const auto &isl : archi) {
+        tot_fevals += isl.get_population().get_problem().get_fevals();
+    }
+    BOOST_CHECK_EQUAL(tot_fevals, b->get_fevals());
+
+    // Once the budget is exhausted, further evolutions do nothing.
+    archi.evolve(10u);
+    archi.wait_check();
+    tot_fevals = 0;
+    for (const auto &isl : archi) {
+        tot_fevals += isl.get_population().get_problem().get_fevals();
+    }
+    BOOST_CHECK_EQUAL(tot_fevals, b->get_fevals());
+}
+
+BOOST_AUTO_TEST_CASE(evaluation_budget_archipelago_target)
+{
+    problem p{rosenbrock{2u}};
+    auto b = std::make_shared<evaluation_budget>(std::numeric_limits<unsigned long long>::max(), 1e-3);
+    p.set_budget(b);
+    archipelago archi{4u, de{1u}, p, 20u, 42u};
+
+    archi.evolve(100000u);
+    archi.wait_check();
+    BOOST_CHECK(b->stop_requested());
+    BOOST_CHECK(b->get_fevals() < 4u * 20u * 100000u);
+    bool found = false;
+    for (const auto &isl : archi) {
+        found = found || isl.get_population().champion_f()[0] < 1e-3;
+    }
+    BOOST_CHECK(found);
+}
+
+// The fitness evaluations performed on copies of a problem sharing its budget
+// are charged to the budget exactly once.
+static void check_async_evaluator(async_backend backend)
+{
+    problem p{rosenbrock{2u}};
+    auto b = std::make_shared<evaluation_budget>(100u, 1e-3);
+    p.set_budget(b);
+    async_evaluator ev(p, backend, 4u);
+    for (auto i = 0; i < 10; ++i) {
+        ev.submit({2., 2.});
+    }
+    for (auto i = 0; i < 10; ++i) {
+        ev.wait();
+    }
+    BOOST_CHECK_EQUAL(p.get_fevals(), 10u);
+    BOOST_CHECK_EQUAL(b->get_fevals(), 10u);
+    BOOST_CHECK(!b->stop_requested());
+
+    // Target.
+    ev.submit({1., 1.});
+    ev.wait();
+    BOOST_CHECK_EQUAL(b->get_fevals(), 11u);
+    BOOST_CHECK(b->stop_requested());
+}
+
+BOOST_AUTO_TEST_CASE(evaluation_budget_copies)
+{
+    check_async_evaluator(async_backend::thread);
+#if defined(PAGMO_WITH_FORK_ISLAND)
+    check_async_evaluator(async_backend::fork);
+#endif
+
+    // mbh with multiple trials.
+    {
+        problem p{rosenbrock{4u}};
+        auto b = std::make_shared<evaluation_budget>();
+        p.set_budget(b);
+        population pop{p, 5u, 23u};
+        mbh algo{compass_search{100u, 0.1, 0.001, 0.7}, 5u, 0.1, 23u};
+        algo.set_n_trials(4u);
+        pop = algo.evolve(pop);
+        BOOST_CHECK(pop.get_problem().get_fevals() > 5u);
+        BOOST_CHECK_EQUAL(pop.get_problem().get_fevals(), b->get_fevals());
+    }
+
+    // Multistart optimisation on a problem which is not thread-safe.
+    {
+        problem p{basic_udp{}};
+        auto b = std::make_shared<evaluation_budget>();
+        p.set_budget(b);
+        multistart_tester{}.run_multistart(p, 4u, [](problem &q, population::size_type) {
+            for (auto i = 0; i < 10; ++i) {
+                q.fitness({.5, .5});
+            }
+        });
+        BOOST_CHECK_EQUAL(p.get_fevals(), 40u);
+        BOOST_CHECK_EQUAL(b->get_fevals(), 40u);
+    }
+}
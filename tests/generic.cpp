@@ -30,12 +30,16 @@ see https://www.gnu.org/licenses/. */
 #define BOOST_TEST_DYN_LINK
 #include <boost/test/unit_test.hpp>
 
+#include <algorithm>
 #include <cmath>
 #include <initializer_list>
 #include <limits>
+#include <numeric>
+#include <random>
 #include <stdexcept>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include <boost/algorithm/string/predicate.hpp>
 
@@ -418,3 +422,36 @@ BOOST_AUTO_TEST_CASE(kNN_test)
         BOOST_CHECK_THROW(kNN(points, 3u), std::invalid_argument);
     }
 }
+
+BOOST_AUTO_TEST_CASE(select_best_N_so_test)
+{
+    const auto nan = std::numeric_limits<double>::quiet_NaN();
+    // Corner cases
+    BOOST_CHECK(select_best_N_so({}, 2u).empty());
+    BOOST_CHECK(select_best_N_so({{1.}, {2.}}, 0u).empty());
+    BOOST_CHECK((select_best_N_so({{1.}}, 2u) == std::vector<pop_size_t>{0u}));
+    BOOST_CHECK((select_best_N_so({{2.}, {1.}, {3.}}, 5u) == std::vector<pop_size_t>{1u, 0u, 2u}));
+    // NaNs are worse than any other value
+    BOOST_CHECK((select_best_N_so({{3.}, {1.}, {nan}, {2.}}, 2u) == std::vector<pop_size_t>{1u, 3u}));
+    BOOST_CHECK((select_best_N_so({{nan}, {1.}, {nan}, {2.}}, 3u).size() == 3u));
+    BOOST_CHECK((select_best_N_so({{nan}, {1.}, {nan}, {2.}}, 2u) == std::vector<pop_size_t>{1u, 3u}));
+    // Only the first component is considered
+    BOOST_CHECK((select_best_N_so({{3., -10.}, {1., 10.}, {2., 0.}}, 2u) == std::vector<pop_size_t>{1u, 2u}));
+    // Agreement with a full sort on random data
+    detail::random_engine_type r_engine(32u);
+    std::uniform_real_distribution<double> dist(-1., 1.);
+    for (auto trial = 0; trial < 100; ++trial) {
+        std::vector<vector_double> f(50u, vector_double(1u));
+        for (auto &v : f) {
+            v[0] = dist(r_engine);
+        }
+        std::vector<pop_size_t> sorted(f.size());
+        std::iota(sorted.begin(), sorted.end(), pop_size_t(0));
+        std::sort(sorted.begin(), sorted.end(), [&f](pop_size_t a, pop_size_t b) { return f[a][0] < f[b][0]; });
+        for (pop_size_t N : {1u, 7u, 25u, 50u}) {
+            BOOST_CHECK(select_best_N_so(f, N) == std::vector<pop_size_t>(sorted.begin(), sorted.begin() + N));
+        }
+    }
+    // throws
+    BOOST_CHECK_THROW(select_best_N_so({{1.}, {}}, 1u), std::invalid_argument);
+}
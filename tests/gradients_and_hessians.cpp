@@ -30,10 +30,17 @@ see https://www.gnu.org/licenses/. */
 #define BOOST_TEST_DYN_LINK
 #include <boost/test/unit_test.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
+#include <pagmo/bfe.hpp>
 #include <pagmo/io.hpp>
+#include <pagmo/problem.hpp>
+#include <pagmo/problems/luksan_vlcek1.hpp>
 #include <pagmo/rng.hpp>
 #include <pagmo/types.hpp>
 #include <pagmo/utils/gradients_and_hessians.hpp>
@@ -150,4 +157,144 @@ BOOST_AUTO_TEST_CASE(estimate_gradient_test)
     for (unsigned i = 0u; i < res.size(); ++i) {
         BOOST_CHECK_CLOSE(gh[i], res[i], 1e-11);
     }
-}
\ No newline at end of file
+}
+struct dummy_problem_sparse {
+    vector_double fitness(const vector_double &dv) const
+    {
+        return {dv[0] * dv[0] + dv[1], dv[1] * dv[2]};
+    }
+    std::pair<vector_double, vector_double> get_bounds() const
+    {
+        vector_double lb(4, -15);
+        vector_double ub(4, 15);
+        return {lb, ub};
+    }
+    vector_double::size_type get_nobj() const
+    {
+        return 2u;
+    }
+    sparsity_pattern gradient_sparsity() const
+    {
+        return {{0, 0}, {0, 1}, {1, 1}, {1, 2}};
+    }
+    std::vector<sparsity_pattern> hessians_sparsity() const
+    {
+        return {{{0, 0}}, {{2, 1}}};
+    }
+};
+
+// A problem with n objectives, each depending on three consecutive variables.
+struct dummy_problem_banded {
+    vector_double fitness(const vector_double &dv) const
+    {
+        vector_double retval(m_dim);
+        for (vector_double::size_type i = 0; i < m_dim; ++i) {
+            retval[i] = (i > 0u ? dv[i - 1u] : 0.) + dv[i] * dv[i] + (i + 1u < m_dim ? 3. * dv[i + 1u] : 0.);
+        }
+        return retval;
+    }
+    std::pair<vector_double, vector_double> get_bounds() const
+    {
+        return {vector_double(m_dim, -1.), vector_double(m_dim, 1.)};
+    }
+    vector_double::size_type get_nobj() const
+    {
+        return m_dim;
+    }
+    sparsity_pattern gradient_sparsity() const
+    {
+        sparsity_pattern retval;
+        for (vector_double::size_type i = 0; i < m_dim; ++i) {
+            for (auto j = i > 0u ? i - 1u : i; j < std::min(i + 2u, m_dim); ++j) {
+                retval.emplace_back(i, j);
+            }
+        }
+        return retval;
+    }
+    vector_double::size_type m_dim = 100u;
+};
+
+BOOST_AUTO_TEST_CASE(estimate_batch_test)
+{
+    const vector_double x{0.1, 0.2, 0.3, 0.4};
+    bfe b{};
+
+    // The batch versions give the same results as the serial ones.
+    problem prob{dummy_problem_easy_grad{}};
+    auto f = [&prob](const vector_double &dv) { return prob.fitness(dv); };
+    BOOST_CHECK(estimate_gradient(prob, b, x) == estimate_gradient(f, x));
+    BOOST_CHECK(estimate_gradient_h(prob, b, x) == estimate_gradient_h(f, x));
+    prob = problem{dummy_problem{}};
+    BOOST_CHECK((estimate_sparsity(prob, b, x)
+                 == sparsity_pattern{{0, 0}, {0, 1}, {0, 2}, {0, 3}, {1, 1}, {1, 2}, {1, 3}, {2, 2}}));
+    // With a dense sparsity pattern, the sparse gradient is the dense one.
+    BOOST_CHECK(estimate_sparse_gradient(prob, b, x) == estimate_gradient(prob, b, x));
+
+    // Number of evaluations.
+    prob = problem{dummy_problem_easy_grad{}};
+    estimate_gradient(prob, b, x);
+    BOOST_CHECK_EQUAL(prob.get_fevals(), 8u);
+    estimate_gradient_h(prob, b, x);
+    BOOST_CHECK_EQUAL(prob.get_fevals(), 32u);
+
+    // Sparse gradient and Hessians.
+    prob = problem{dummy_problem_sparse{}};
+    const auto g = estimate_sparse_gradient(prob, b, x);
+    // Only the first three variables are perturbed, and
+    // the first and the third one are perturbed together.
+    BOOST_CHECK_EQUAL(prob.get_fevals(), 4u);
+    BOOST_REQUIRE_EQUAL(g.size(), 4u);
+    BOOST_CHECK_CLOSE(g[0], 0.2, 1e-5);
+    BOOST_CHECK_CLOSE(g[1], 1., 1e-5);
+    BOOST_CHECK_CLOSE(g[2], 0.3, 1e-5);
+    BOOST_CHECK_CLOSE(g[3], 0.2, 1e-5);
+    const auto h = estimate_hessians(prob, b, x);
+    // x, plus 2 points for the diagonal element and 4 for the off-diagonal one.
+    BOOST_CHECK_EQUAL(prob.get_fevals(), 11u);
+    BOOST_REQUIRE_EQUAL(h.size(), 2u);
+    BOOST_REQUIRE_EQUAL(h[0].size(), 1u);
+    BOOST_REQUIRE_EQUAL(h[1].size(), 1u);
+    BOOST_CHECK_CLOSE(h[0][0], 2., 1e-3);
+    BOOST_CHECK_CLOSE(h[1][0], 1., 1e-3);
+
+    // Dense Hessians.
+    prob = problem{dummy_problem_easy_grad{}};
+    const auto hd = estimate_hessians(prob, b, x);
+    BOOST_REQUIRE_EQUAL(hd.size(), 3u);
+    // Lower triangular, dense: (0,0), (1,0), (1,1), (2,0), ...
+    BOOST_REQUIRE_EQUAL(hd[0].size(), 10u);
+    BOOST_CHECK_SMALL(hd[0][0], 1e-6);
+    BOOST_CHECK_CLOSE(hd[0][2], 2., 1e-3);
+    BOOST_CHECK_CLOSE(hd[0][9], 2.4, 1e-3);
+    BOOST_CHECK_CLOSE(hd[1][1], 0.12, 1e-3);
+
+    // Banded pattern: the variables are perturbed in three groups.
+    prob = problem{dummy_problem_banded{}};
+    const vector_double xb(100u, 0.5);
+    const auto gb = estimate_sparse_gradient(prob, b, xb);
+    BOOST_CHECK_EQUAL(prob.get_fevals(), 6u);
+    const auto spb = prob.gradient_sparsity();
+    BOOST_REQUIRE_EQUAL(gb.size(), spb.size());
+    for (decltype(spb.size()) e = 0; e < spb.size(); ++e) {
+        const auto i = spb[e].first, j = spb[e].second;
+        BOOST_CHECK_CLOSE(gb[e], j < i ? 1. : (j == i ? 1. : 3.), 1e-5);
+    }
+
+    // Dense objective: one group per variable, same result as the analytical gradient.
+    prob = problem{luksan_vlcek1{10u}};
+    const vector_double xl{0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.};
+    const auto gl = estimate_sparse_gradient(prob, b, xl);
+    BOOST_CHECK_EQUAL(prob.get_fevals(), 20u);
+    const auto gla = prob.gradient(xl);
+    BOOST_REQUIRE_EQUAL(gl.size(), gla.size());
+    for (decltype(gl.size()) e = 0; e < gl.size(); ++e) {
+        BOOST_CHECK(std::abs(gl[e] - gla[e]) < 1e-5 * std::max(std::abs(gla[e]), 1.));
+    }
+
+    // Wrong dimension.
+    BOOST_CHECK_THROW(estimate_gradient(prob, b, {1.}), std::invalid_argument);
+    BOOST_CHECK_THROW(estimate_gradient_h(prob, b, {1.}), std::invalid_argument);
+    BOOST_CHECK_THROW(estimate_sparsity(prob, b, {1.}), std::invalid_argument);
+    BOOST_CHECK_THROW(estimate_sparse_gradient(prob, b, {1.}), std::invalid_argument);
+    BOOST_CHECK_THROW(estimate_hessians(prob, b, {1.}), std::invalid_argument);
+}
@@ -345,3 +345,23 @@ BOOST_AUTO_TEST_CASE(ipopt_thread_safety)
     BOOST_CHECK((island{ipopt{}, luksan_vlcek1{4}, 10}.is<thread_island>()));
 #endif
 }
+
+BOOST_AUTO_TEST_CASE(ipopt_multistart)
+{
+    ipopt ip;
+    BOOST_CHECK_EQUAL(ip.get_n_starts(), 1u);
+    BOOST_CHECK_THROW(ip.set_n_starts(0), std::invalid_argument);
+    ip.set_n_starts(3);
+    BOOST_CHECK_EQUAL(ip.get_n_starts(), 3u);
+    BOOST_CHECK(ip.get_extra_info().find("Starts: 3") != std::string::npos);
+    ip.set_selection("random");
+    ip.set_replacement("worst");
+    problem prob(luksan_vlcek1{4});
+    prob.set_c_tol({1E-8, 1E-8});
+    population pop(prob, 10);
+    const auto fevals = pop.get_problem().get_fevals();
+    pop = ip.evolve(pop);
+    BOOST_CHECK(pop.get_problem().get_fevals() > fevals);
+    BOOST_CHECK_EQUAL(Ipopt::Solve_Succeeded, ip.get_last_opt_result());
+    BOOST_CHECK(ip.get_log().empty());
+}
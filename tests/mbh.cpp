@@ -239,3 +239,47 @@ BOOST_AUTO_TEST_CASE(mbh_inner_algo_get_test)
         BOOST_CHECK(!std::is_const<std::remove_reference<decltype(uda.get_inner_algorithm())>::type>::value);
     }
 }
+
+BOOST_AUTO_TEST_CASE(mbh_n_trials_test)
+{
+    mbh user_algo{compass_search{100u, 0.1, 0.001, 0.7}, 5u, 0.1, 23u};
+    BOOST_CHECK_EQUAL(user_algo.get_n_trials(), 1u);
+    BOOST_CHECK_THROW(user_algo.set_n_trials(0u), std::invalid_argument);
+    user_algo.set_n_trials(4u);
+    BOOST_CHECK_EQUAL(user_algo.get_n_trials(), 4u);
+    BOOST_CHECK(user_algo.get_extra_info().find("Trials: 4") != std::string::npos);
+
+    // The evolution is deterministic if the seed is controlled.
+    problem prob{hock_schittkowsky_71{}};
+    prob.set_c_tol({1e-3, 1e-3});
+    population pop1{prob, 5u, 23u};
+    population pop2{prob, 5u, 23u};
+    user_algo.set_verbosity(1u);
+    pop1 = user_algo.evolve(pop1);
+    mbh user_algo2{compass_search{100u, 0.1, 0.001, 0.7}, 5u, 0.1, 23u};
+    user_algo2.set_n_trials(4u);
+    user_algo2.set_verbosity(1u);
+    pop2 = user_algo2.evolve(pop2);
+    BOOST_CHECK(user_algo.get_log() == user_algo2.get_log());
+    BOOST_CHECK(pop1.get_x() == pop2.get_x());
+    // The fitness evaluations of all the trials are accounted for: each step
+    // makes at least the 5 evaluations of the perturbed population in each trial.
+    BOOST_CHECK(pop1.get_problem().get_fevals() >= 5u + 4u * 5u * user_algo.get_log().size());
+    for (decltype(pop1.size()) i = 0u; i < pop1.size(); ++i) {
+        BOOST_CHECK(prob.fitness(pop1.get_x()[i]) == pop1.get_f()[i]);
+    }
+
+    // The number of trials survives serialization.
+    algorithm algo{user_algo};
+    std::stringstream ss;
+    {
+        boost::archive::binary_oarchive oarchive(ss);
+        oarchive << algo;
+    }
+    algo = algorithm{};
+    {
+        boost::archive::binary_iarchive iarchive(ss);
+        iarchive >> algo;
+    }
+    BOOST_CHECK_EQUAL(algo.extract<mbh>()->get_n_trials(), 4u);
+}
@@ -37,6 +37,8 @@ see https://www.gnu.org/licenses/. */
 
 #include <pagmo/algorithm.hpp>
 #include <pagmo/algorithms/moead.hpp>
+#include <pagmo/batch_evaluators/thread_bfe.hpp>
+#include <pagmo/bfe.hpp>
 #include <pagmo/io.hpp>
 #include <pagmo/problems/rosenbrock.hpp>
 #include <pagmo/problems/zdt.hpp>
@@ -254,3 +256,33 @@ BOOST_AUTO_TEST_CASE(moead_serialization_test)
         }
     }
 }
+
+BOOST_AUTO_TEST_CASE(moead_bfe_test)
+{
+    // The batch-synchronous mode is deterministic if the seed is controlled,
+    // and it does not depend on the bfe used.
+    problem prob{zdt{1u, 30u}};
+    for (const auto &dec : {"tchebycheff", "weighted", "bi"}) {
+        population pop1{prob, 40u, 23u};
+        population pop2{prob, 40u, 23u};
+
+        moead user_algo1{20u, "grid", dec, 10u, 1., 0.5, 20., 0.9, 2u, true, 23u};
+        user_algo1.set_verbosity(1u);
+        user_algo1.set_bfe(bfe{});
+        pop1 = user_algo1.evolve(pop1);
+
+        moead user_algo2{20u, "grid", dec, 10u, 1., 0.5, 20., 0.9, 2u, true, 23u};
+        user_algo2.set_verbosity(1u);
+        user_algo2.set_bfe(bfe{thread_bfe{}});
+        pop2 = user_algo2.evolve(pop2);
+
+        BOOST_CHECK(user_algo1.get_log().size() == 20u);
+        BOOST_CHECK(user_algo1.get_log() == user_algo2.get_log());
+        BOOST_CHECK(pop1.get_x() == pop2.get_x());
+        BOOST_CHECK(pop1.get_f() == pop2.get_f());
+        // One candidate per decomposed problem and per generation.
+        BOOST_CHECK_EQUAL(pop1.get_problem().get_fevals(), 40u + 20u * 40u);
+        // The average decomposed fitness improves.
+        BOOST_CHECK(std::get<2>(user_algo1.get_log().back()) < std::get<2>(user_algo1.get_log().front()));
+    }
+}
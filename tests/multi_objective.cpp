@@ -409,4 +409,21 @@ BOOST_AUTO_TEST_CASE(decompose_objectives_test)
     BOOST_CHECK_THROW(decompose_objectives(f, weight, {1.}, "weighted"), std::invalid_argument);
     BOOST_CHECK_THROW(decompose_objectives(f, weight, ref_point, "pippo"), std::invalid_argument);
     BOOST_CHECK_THROW(decompose_objectives({}, {}, {}, "weighted"), std::invalid_argument);
+
+    // The low-level kernel.
+    BOOST_CHECK(detail::decomposition_method_from_string("weighted") == detail::decomposition_method::weighted);
+    BOOST_CHECK(detail::decomposition_method_from_string("tchebycheff") == detail::decomposition_method::tchebycheff);
+    BOOST_CHECK(detail::decomposition_method_from_string("bi") == detail::decomposition_method::bi);
+    BOOST_CHECK_THROW(detail::decomposition_method_from_string("pippo"), std::invalid_argument);
+    BOOST_CHECK_EQUAL(
+        detail::decompose_objectives_impl(f.data(), weight.data(), ref_point.data(), 2u,
+                                          detail::decomposition_method::weighted),
+        fw);
+    BOOST_CHECK_EQUAL(
+        detail::decompose_objectives_impl(f.data(), weight.data(), ref_point.data(), 2u,
+                                          detail::decomposition_method::tchebycheff),
+        ft);
+    BOOST_CHECK_EQUAL(detail::decompose_objectives_impl(f.data(), weight.data(), ref_point.data(), 2u,
+                                                        detail::decomposition_method::bi),
+                      fb);
 }
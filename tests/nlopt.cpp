@@ -381,3 +381,53 @@ BOOST_AUTO_TEST_CASE(nlopt_loc_opt)
     algo.evolve(pop);
     BOOST_CHECK(algo.extract<nlopt>()->get_last_opt_result() >= 0);
 }
+
+BOOST_AUTO_TEST_CASE(nlopt_multistart)
+{
+    nlopt n{"slsqp"};
+    BOOST_CHECK_EQUAL(n.get_n_starts(), 1u);
+    BOOST_CHECK_THROW(n.set_n_starts(0), std::invalid_argument);
+    n.set_n_starts(5);
+    BOOST_CHECK_EQUAL(n.get_n_starts(), 5u);
+    BOOST_CHECK(n.get_extra_info().find("Starts: 5") != std::string::npos);
+    // Run a multistart evolution with the various policies.
+    for (auto s : {"best", "worst", "random"}) {
+        for (auto r : {"best", "worst", "random"}) {
+            n.set_selection(s);
+            n.set_replacement(r);
+            population pop(rosenbrock{10}, 20);
+            const auto champ = pop.champion_f();
+            const auto fevals = pop.get_problem().get_fevals();
+            pop = n.evolve(pop);
+            BOOST_CHECK(pop.champion_f()[0] <= champ[0]);
+            BOOST_CHECK(pop.get_problem().get_fevals() > fevals);
+            BOOST_CHECK(n.get_log().empty());
+            pop = population{hs71{}, 20};
+            pop.get_problem().set_c_tol({1E-6, 1E-6});
+            n.evolve(pop);
+        }
+    }
+    // More starts than individuals.
+    n.set_n_starts(50);
+    population pop(rosenbrock{10}, 3);
+    BOOST_CHECK_NO_THROW(n.evolve(pop));
+    // Index selection is compatible only with a single start.
+    n.set_selection(0);
+    BOOST_CHECK_THROW(n.evolve(pop), std::invalid_argument);
+    // Serialization.
+    n.set_selection("best");
+    algorithm algo{n};
+    std::stringstream ss;
+    const auto before = boost::lexical_cast<std::string>(algo);
+    {
+        boost::archive::binary_oarchive oarchive(ss);
+        oarchive << algo;
+    }
+    algo = algorithm{};
+    {
+        boost::archive::binary_iarchive iarchive(ss);
+        iarchive >> algo;
+    }
+    BOOST_CHECK_EQUAL(before, boost::lexical_cast<std::string>(algo));
+    BOOST_CHECK_EQUAL(algo.extract<nlopt>()->get_n_starts(), 50u);
+}
@@ -38,6 +38,7 @@ see https://www.gnu.org/licenses/. */
 
 #include <pagmo/algorithm.hpp>
 #include <pagmo/algorithms/nsga2.hpp>
+#include <pagmo/async_evaluator.hpp>
 #include <pagmo/io.hpp>
 #include <pagmo/problems/dtlz.hpp>
 #include <pagmo/problems/hock_schittkowsky_71.hpp>
@@ -231,3 +232,29 @@ BOOST_AUTO_TEST_CASE(bfe_usage_test)
     pop2 = algo2.evolve(pop);
     BOOST_CHECK(algo1.extract<nsga2>()->get_log() == algo2.extract<nsga2>()->get_log());
 }
+
+BOOST_AUTO_TEST_CASE(async_usage_test)
+{
+    problem prob{zdt(1u, 10u)};
+    population pop{prob, 24u, 32u};
+    const auto fevals0 = pop.get_problem().get_fevals();
+    nsga2 uda{10u};
+    uda.set_seed(23u);
+    uda.set_verbosity(1u);
+    uda.set_async(async_backend::thread, 4u);
+    BOOST_CHECK(uda.get_extra_info().find("Asynchronous evaluation") != std::string::npos);
+    auto new_pop = uda.evolve(pop);
+    BOOST_CHECK_EQUAL(new_pop.get_problem().get_fevals() - fevals0, 10u * 24u);
+    BOOST_CHECK_EQUAL(new_pop.size(), 24u);
+    BOOST_CHECK_EQUAL(uda.get_log().size(), 10u);
+    for (decltype(new_pop.size()) i = 0u; i < new_pop.size(); ++i) {
+        BOOST_CHECK(prob.fitness(new_pop.get_x()[i]) == new_pop.get_f()[i]);
+    }
+    // The ideal point can only improve in the steady-state scheme.
+    const auto &log = uda.get_log();
+    for (decltype(log.size()) i = 1u; i < log.size(); ++i) {
+        for (auto j = 0u; j < 2u; ++j) {
+            BOOST_CHECK(std::get<2>(log[i])[j] <= std::get<2>(log[i - 1u])[j]);
+        }
+    }
+}
@@ -31,6 +31,7 @@ see https://www.gnu.org/licenses/. */
 #include <boost/test/unit_test.hpp>
 
 #include <cmath>
+#include <cstdint>
 #include <initializer_list>
 #include <iostream>
 #include <limits>
@@ -38,7 +39,9 @@ see https://www.gnu.org/licenses/. */
 #include <stdexcept>
 #include <string>
 #include <type_traits>
+#include <vector>
 
+#include <boost/algorithm/string/predicate.hpp>
 #include <boost/lexical_cast.hpp>
 
 #include <pagmo/batch_evaluators/thread_bfe.hpp>
@@ -351,6 +354,91 @@ BOOST_AUTO_TEST_CASE(population_serialization_test)
     }
     auto after = boost::lexical_cast<std::string>(pop);
     BOOST_CHECK_EQUAL(before, after);
+
+    // Check exact round trips of the individuals, with binary and text archives.
+    pop = population{problem{zdt{1, 10u}}, 50, 1234u};
+    population pop2;
+    {
+        std::stringstream ss2;
+        {
+            boost::archive::binary_oarchive oarchive(ss2);
+            oarchive << pop;
+        }
+        {
+            boost::archive::binary_iarchive iarchive(ss2);
+            iarchive >> pop2;
+        }
+    }
+    BOOST_CHECK(pop2.get_ID() == pop.get_ID());
+    BOOST_CHECK(pop2.get_x() == pop.get_x());
+    BOOST_CHECK(pop2.get_f() == pop.get_f());
+    pop2 = population{};
+    {
+        std::stringstream ss2;
+        {
+            boost::archive::text_oarchive oarchive(ss2);
+            oarchive << pop;
+        }
+        {
+            boost::archive::text_iarchive iarchive(ss2);
+            iarchive >> pop2;
+        }
+    }
+    BOOST_CHECK(pop2.get_ID() == pop.get_ID());
+    BOOST_CHECK_EQUAL(pop2.get_x().size(), 50u);
+    BOOST_CHECK_EQUAL(pop2.get_f().size(), 50u);
+}
+
+BOOST_AUTO_TEST_CASE(bulk_serialization_test)
+{
+    auto round_trip = [](const std::vector<vector_double> &vv) {
+        std::stringstream ss;
+        {
+            boost::archive::binary_oarchive oarchive(ss);
+            detail::bulk_save(oarchive, vv);
+        }
+        std::vector<vector_double> retval{{1., 2.}};
+        {
+            boost::archive::binary_iarchive iarchive(ss);
+            detail::bulk_load(iarchive, retval);
+        }
+        return retval;
+    };
+
+    BOOST_CHECK(round_trip({}).empty());
+    BOOST_CHECK((round_trip({{}, {}}) == std::vector<vector_double>{{}, {}}));
+    BOOST_CHECK((round_trip({{1., 2., 3.}, {4., 5., 6.}}) == std::vector<vector_double>{{1., 2., 3.}, {4., 5., 6.}}));
+    // Vectors of different sizes.
+    BOOST_CHECK((round_trip({{1.}, {}, {2., 3.}}) == std::vector<vector_double>{{1.}, {}, {2., 3.}}));
+
+    // Groups of individuals.
+    individuals_group_t g{{1u, 2u}, {{1., 2.}, {3., 4.}}, {{5.}, {6.}}}, g2;
+    {
+        std::stringstream ss;
+        {
+            boost::archive::text_oarchive oarchive(ss);
+            oarchive << g;
+        }
+        {
+            boost::archive::text_iarchive iarchive(ss);
+            iarchive >> g2;
+        }
+    }
+    BOOST_CHECK(g == g2);
+
+    // Wrong endianness tag.
+    {
+        std::stringstream ss;
+        {
+            boost::archive::text_oarchive oarchive(ss);
+            oarchive << std::uint32_t(0x04030201ul) << 0ull << 0ull;
+        }
+        std::vector<vector_double> vv;
+        boost::archive::text_iarchive iarchive(ss);
+        BOOST_CHECK_EXCEPTION(detail::bulk_load(iarchive, vv), std::runtime_error, [](const std::runtime_error &re) {
+            return boost::contains(re.what(), "different byte order");
+        });
+    }
 }
 
 struct minlp {
@@ -462,3 +550,76 @@ BOOST_AUTO_TEST_CASE(population_nan_champion)
     pop0.push_back({std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::quiet_NaN()});
     BOOST_CHECK(!std::isnan(pop0.champion_f()[0]));
 }
+
+BOOST_AUTO_TEST_CASE(population_dedup_test)
+{
+    population pop{rosenbrock{3u}, 10u, 42u};
+    vector_double f;
+    // Disabled by default.
+    BOOST_CHECK(!pop.get_dedup());
+    BOOST_CHECK(!pop.lookup_f(pop.get_x()[0], f));
+    BOOST_CHECK(f.empty());
+
+    pop.set_dedup(true);
+    BOOST_CHECK(pop.get_dedup());
+    for (population::size_type i = 0; i < pop.size(); ++i) {
+        BOOST_CHECK(pop.lookup_f(pop.get_x()[i], f));
+        BOOST_CHECK(f == pop.get_f()[i]);
+    }
+    BOOST_CHECK_EQUAL(pop.get_dedup_hits(), 10u);
+    BOOST_CHECK(!pop.lookup_f({1., 2., 3.}, f));
+    BOOST_CHECK_EQUAL(pop.get_dedup_hits(), 10u);
+
+    // The index follows the changes in the population.
+    const auto old_x = pop.get_x()[3];
+    pop.set_x(3, {1., 2., 3.});
+    BOOST_CHECK(!pop.lookup_f(old_x, f));
+    BOOST_CHECK(pop.lookup_f({1., 2., 3.}, f));
+    BOOST_CHECK(f == pop.get_f()[3]);
+    pop.push_back({3., 2., 1.});
+    BOOST_CHECK(pop.lookup_f({3., 2., 1.}, f));
+    BOOST_CHECK(f == pop.get_f()[10]);
+    // Duplicated individuals.
+    pop.set_x(4, {1., 2., 3.});
+    pop.set_x(3, {0., 0., 0.});
+    BOOST_CHECK(pop.lookup_f({1., 2., 3.}, f));
+    BOOST_CHECK(f == pop.get_f()[4]);
+    // NaNs.
+    const auto nan = std::numeric_limits<double>::quiet_NaN();
+    pop.push_back({nan, 1., 2.});
+    BOOST_CHECK(pop.lookup_f({nan, 1., 2.}, f));
+    BOOST_CHECK_EQUAL(pop.get_dedup_hits(), 14u);
+    BOOST_CHECK(boost::contains(boost::lexical_cast<std::string>(pop), "saved by deduplication: 14"));
+
+    // Copy, move and serialization.
+    auto pop2(pop);
+    BOOST_CHECK(pop2.get_dedup());
+    BOOST_CHECK(pop2.lookup_f({0., 0., 0.}, f));
+    BOOST_CHECK_EQUAL(pop2.get_dedup_hits(), 15u);
+    auto pop3(std::move(pop2));
+    BOOST_CHECK(pop3.lookup_f({0., 0., 0.}, f));
+    std::stringstream ss;
+    {
+        boost::archive::binary_oarchive oarchive(ss);
+        oarchive << pop3;
+    }
+    population pop4;
+    {
+        boost::archive::binary_iarchive iarchive(ss);
+        iarchive >> pop4;
+    }
+    BOOST_CHECK(pop4.get_dedup());
+    BOOST_CHECK_EQUAL(pop4.get_dedup_hits(), 16u);
+    BOOST_CHECK(pop4.lookup_f({3., 2., 1.}, f));
+    BOOST_CHECK(f == pop4.get_f()[10]);
+
+    // Disable.
+    pop.set_dedup(false);
+    BOOST_CHECK(!pop.lookup_f({0., 0., 0.}, f));
+    BOOST_CHECK(!boost::contains(boost::lexical_cast<std::string>(pop), "deduplication"));
+
+    // Stochastic problem.
+    population pop_st{inventory{}, 5u};
+    BOOST_CHECK_THROW(pop_st.set_dedup(true), std::invalid_argument);
+    BOOST_CHECK(!pop_st.get_dedup());
+}
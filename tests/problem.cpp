@@ -48,6 +48,7 @@ see https://www.gnu.org/licenses/. */
 #include <pagmo/exceptions.hpp>
 #include <pagmo/problem.hpp>
 #include <pagmo/problems/null_problem.hpp>
+#include <pagmo/problems/rosenbrock.hpp>
 #include <pagmo/s11n.hpp>
 #include <pagmo/threading.hpp>
 #include <pagmo/types.hpp>
@@ -1570,6 +1571,109 @@ BOOST_AUTO_TEST_CASE(batch_fitness)
     BOOST_CHECK(p.has_batch_fitness());
 }
 
+BOOST_AUTO_TEST_CASE(scalar_fitness)
+{
+    // A problem with no scalar fitness: the fitness is used.
+    problem p{base_p{1u, 0u, 0u, {42.}}};
+    BOOST_CHECK(!has_scalar_fitness<base_p>::value);
+    BOOST_CHECK(!p.has_scalar_fitness());
+    BOOST_CHECK_EQUAL(p.scalar_fitness({.5}), 42.);
+    BOOST_CHECK_EQUAL(p.get_fevals(), 1u);
+    BOOST_CHECK_THROW(p.scalar_fitness({.5, .5}), std::invalid_argument);
+    // Wrong fitness dimension from the UDP.
+    p = problem{base_p{1u, 0u, 0u, {42., 43.}}};
+    BOOST_CHECK_THROW(p.scalar_fitness({.5}), std::invalid_argument);
+    // Constrained problem.
+    p = problem{base_p{1u, 1u, 0u, {42., 43.}}};
+    BOOST_CHECK_EXCEPTION(p.scalar_fitness({.5}), std::invalid_argument, [](const std::invalid_argument &ia) {
+        return boost::contains(ia.what(), "The scalar_fitness() method can be invoked only on problems whose fitness "
+                                          "has a single component");
+    });
+
+    // A UDP which provides scalar_fitness().
+    struct sf0 {
+        vector_double fitness(const vector_double &dv) const
+        {
+            return {scalar_fitness(dv.data())};
+        }
+        double scalar_fitness(const double *dv) const
+        {
+            return dv[0] + dv[1];
+        }
+        std::pair<vector_double, vector_double> get_bounds() const
+        {
+            return {{0, 0}, {1, 1}};
+        }
+    };
+    p = problem{sf0{}};
+    BOOST_CHECK(has_scalar_fitness<sf0>::value);
+    BOOST_CHECK(p.has_scalar_fitness());
+    BOOST_CHECK_EQUAL(p.scalar_fitness({1., 2.}), 3.);
+    BOOST_CHECK(p.fitness({1., 2.}) == vector_double{3.});
+    BOOST_CHECK_EQUAL(p.get_fevals(), 2u);
+    BOOST_CHECK_THROW(p.scalar_fitness({1.}), std::invalid_argument);
+    // Copies, moves and serialization preserve the flag.
+    auto p2(p);
+    BOOST_CHECK(p2.has_scalar_fitness());
+    auto p3(std::move(p2));
+    BOOST_CHECK(p3.has_scalar_fitness());
+    p = problem{rosenbrock{3u}};
+    BOOST_CHECK(p.has_scalar_fitness());
+    BOOST_CHECK_EQUAL(p.scalar_fitness({1., 2., 3.}), p.fitness({1., 2., 3.})[0]);
+    std::stringstream ss;
+    {
+        boost::archive::binary_oarchive oarchive(ss);
+        oarchive << p;
+    }
+    p = problem{};
+    BOOST_CHECK(!p.has_scalar_fitness());
+    {
+        boost::archive::binary_iarchive iarchive(ss);
+        iarchive >> p;
+    }
+    BOOST_CHECK(p.has_scalar_fitness());
+
+    // A UDP which provides scalar_fitness() but has a multidimensional fitness.
+    struct sf1 {
+        vector_double fitness(const vector_double &) const
+        {
+            return {0, 0};
+        }
+        double scalar_fitness(const double *) const
+        {
+            return 0;
+        }
+        vector_double::size_type get_nobj() const
+        {
+            return 2u;
+        }
+        std::pair<vector_double, vector_double> get_bounds() const
+        {
+            return {{0}, {1}};
+        }
+    };
+    BOOST_CHECK(has_scalar_fitness<sf1>::value);
+    BOOST_CHECK_THROW(problem{sf1{}}, std::invalid_argument);
+
+    // A wrong signature is not detected.
+    struct sf2 {
+        vector_double fitness(const vector_double &) const
+        {
+            return {0};
+        }
+        double scalar_fitness(const double *) // non-const
+        {
+            return 0;
+        }
+        std::pair<vector_double, vector_double> get_bounds() const
+        {
+            return {{0}, {1}};
+        }
+    };
+    BOOST_CHECK(!has_scalar_fitness<sf2>::value);
+    BOOST_CHECK(!problem{sf2{}}.has_scalar_fitness());
+}
+
 BOOST_AUTO_TEST_CASE(is_valid)
 {
     problem p0;
@@ -1615,3 +1719,88 @@ BOOST_AUTO_TEST_CASE(get_ptr)
     BOOST_CHECK(static_cast<const problem &>(p0).get_ptr()
                 == static_cast<const problem &>(p0).extract<grad_p_override>());
 }
+
+struct ts_const {
+    vector_double fitness(const vector_double &) const
+    {
+        return {m_value};
+    }
+    std::pair<vector_double, vector_double> get_bounds() const
+    {
+        return {{0}, {1}};
+    }
+    void set_seed(unsigned seed)
+    {
+        m_value = seed;
+    }
+    thread_safety get_thread_safety() const
+    {
+        return thread_safety::constant;
+    }
+    template <typename Archive>
+    void serialize(Archive &ar, unsigned)
+    {
+        ar &m_value;
+    }
+    double m_value = 0;
+};
+
+PAGMO_S11N_PROBLEM_EXPORT(ts_const)
+
+BOOST_AUTO_TEST_CASE(shared_udp_test)
+{
+    // UDPs which are not thread-safe for concurrent const access are deep copied.
+    problem p0{ts1{}};
+    auto p1(p0);
+    BOOST_CHECK(static_cast<const problem &>(p0).extract<ts1>()
+                != static_cast<const problem &>(p1).extract<ts1>());
+
+    // UDPs providing the constant guarantee are shared.
+    problem p2{ts_const{}};
+    p2.fitness({0.5});
+    auto p3(p2);
+    BOOST_CHECK(static_cast<const problem &>(p2).extract<ts_const>()
+                == static_cast<const problem &>(p3).extract<ts_const>());
+    // The counters are not shared.
+    BOOST_CHECK_EQUAL(p3.get_fevals(), 1u);
+    p3.fitness({0.5});
+    BOOST_CHECK_EQUAL(p2.get_fevals(), 1u);
+    BOOST_CHECK_EQUAL(p3.get_fevals(), 2u);
+    // Same for copy assignment.
+    problem p4;
+    p4 = p2;
+    BOOST_CHECK(static_cast<const problem &>(p2).extract<ts_const>()
+                == static_cast<const problem &>(p4).extract<ts_const>());
+
+    // Mutable access detaches the UDP.
+    p3.set_seed(42);
+    BOOST_CHECK(static_cast<const problem &>(p2).extract<ts_const>()
+                != static_cast<const problem &>(p3).extract<ts_const>());
+    BOOST_CHECK_EQUAL(p2.fitness({0.5})[0], 0.);
+    BOOST_CHECK_EQUAL(p3.fitness({0.5})[0], 42.);
+    BOOST_CHECK_EQUAL(p4.fitness({0.5})[0], 0.);
+    p4.extract<ts_const>()->m_value = 1;
+    BOOST_CHECK_EQUAL(p2.fitness({0.5})[0], 0.);
+    BOOST_CHECK_EQUAL(p4.fitness({0.5})[0], 1.);
+
+    // Serialization of shared UDPs.
+    std::vector<problem> v{p2, p2};
+    std::stringstream ss;
+    {
+        boost::archive::binary_oarchive oarchive(ss);
+        oarchive << v;
+    }
+    v.clear();
+    {
+        boost::archive::binary_iarchive iarchive(ss);
+        iarchive >> v;
+    }
+    BOOST_CHECK_EQUAL(v.size(), 2u);
+    BOOST_CHECK(static_cast<const problem &>(v[0]).extract<ts_const>()
+                != static_cast<const problem &>(v[1]).extract<ts_const>());
+    BOOST_CHECK_EQUAL(v[0].fitness({0.5})[0], 0.);
+    BOOST_CHECK_EQUAL(v[1].get_fevals(), 3u);
+    v[0].set_seed(3);
+    BOOST_CHECK_EQUAL(v[0].fitness({0.5})[0], 3.);
+    BOOST_CHECK_EQUAL(v[1].fitness({0.5})[0], 0.);
+}
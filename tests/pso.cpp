@@ -35,6 +35,7 @@ see https://www.gnu.org/licenses/. */
 #include <iostream>
 #include <limits> //  std::numeric_limits<double>::infinity();
 #include <string>
+#include <utility>
 
 #include <pagmo/algorithm.hpp>
 #include <pagmo/algorithms/pso.hpp>
@@ -47,6 +48,20 @@ see https://www.gnu.org/licenses/. */
 
 using namespace pagmo;
 
+// A user-defined wrapper of rosenbrock, whose fitness is evaluated
+// through the type-erased interface of the problem.
+struct udp_rosenbrock {
+    vector_double fitness(const vector_double &x) const
+    {
+        return m_r.fitness(x);
+    }
+    std::pair<vector_double, vector_double> get_bounds() const
+    {
+        return m_r.get_bounds();
+    }
+    rosenbrock m_r{10u};
+};
+
 BOOST_AUTO_TEST_CASE(construction)
 {
     BOOST_CHECK_NO_THROW(pso{});
@@ -133,6 +148,16 @@ BOOST_AUTO_TEST_CASE(evolve_test)
             BOOST_CHECK(user_algo1.get_log() == user_algo3.get_log());
         }
     }
+    // The memory is reset if the problem dimension changes while
+    // the swarm size stays the same.
+    {
+        pso user_algo{10u, 0.79, 2., 2., 0.1, 5u, 2u, 4u, true, 23u};
+        population pop1{rosenbrock{10u}, 5u, 23u};
+        user_algo.evolve(pop1);
+        population pop2{rosenbrock{4u}, 5u, 23u};
+        pop2 = user_algo.evolve(pop2);
+        BOOST_CHECK_EQUAL(pop2.get_x()[0].size(), 4u);
+    }
 }
 BOOST_AUTO_TEST_CASE(setters_getters_test)
 {
@@ -184,3 +209,15 @@ BOOST_AUTO_TEST_CASE(serialization_test)
         BOOST_CHECK_CLOSE(std::get<5>(before_log[i]), std::get<5>(after_log[i]), 1e-8);
     }
 }
+
+BOOST_AUTO_TEST_CASE(scalar_fitness_test)
+{
+    // The evolution of a built-in UDP, evaluated via its scalar_fitness() method,
+    // is identical to the evolution of a user-defined UDP providing only fitness().
+    population pop1{rosenbrock{10u}, 20u, 23u}, pop2{udp_rosenbrock{}, 20u, 23u};
+    pop1 = pso{10u, 0.7298, 2.05, 2.05, 0.5, 5u, 2u, 4u, false, 42u}.evolve(pop1);
+    pop2 = pso{10u, 0.7298, 2.05, 2.05, 0.5, 5u, 2u, 4u, false, 42u}.evolve(pop2);
+    BOOST_CHECK(pop1.get_x() == pop2.get_x());
+    BOOST_CHECK(pop1.get_f() == pop2.get_f());
+    BOOST_CHECK_EQUAL(pop1.get_problem().get_fevals(), pop2.get_problem().get_fevals());
+}
@@ -40,6 +40,7 @@ see https://www.gnu.org/licenses/. */
 
 #include <pagmo/algorithm.hpp>
 #include <pagmo/algorithms/pso_gen.hpp>
+#include <pagmo/async_evaluator.hpp>
 #include <pagmo/population.hpp>
 #include <pagmo/problems/hock_schittkowsky_71.hpp>
 #include <pagmo/problems/rosenbrock.hpp>
@@ -334,3 +335,26 @@ BOOST_AUTO_TEST_CASE(bfe_usage_test_stoch)
 
     BOOST_CHECK(pop.get_f() == pop_2.get_f());
 }
+
+BOOST_AUTO_TEST_CASE(async_usage_test)
+{
+    population pop{rosenbrock{10u}, 30u, 23u};
+    const auto best0 = pop.champion_f()[0];
+    const auto fevals0 = pop.get_problem().get_fevals();
+    for (auto neighb_type : {1u, 2u, 3u, 4u}) {
+        for (auto variant : {1u, 5u, 6u}) {
+            pso_gen uda{20u, 0.79, 2., 2., 0.1, variant, neighb_type, 4u, false, 23u};
+            uda.set_async(async_backend::thread, 4u);
+            uda.set_verbosity(1u);
+            BOOST_CHECK(uda.get_extra_info().find("Asynchronous evaluation") != std::string::npos);
+            auto new_pop = uda.evolve(pop);
+            BOOST_CHECK_EQUAL(new_pop.get_problem().get_fevals() - fevals0, 20u * 30u);
+            BOOST_CHECK(new_pop.champion_f()[0] <= best0);
+            BOOST_CHECK_EQUAL(uda.get_log().size(), 20u);
+        }
+    }
+    // Stochastic problems are not supported in asynchronous mode.
+    pso_gen uda{20u};
+    uda.set_async(async_backend::thread);
+    BOOST_CHECK_THROW(uda.evolve(population{my_sto_prob{25u, 10, 5}, 30u, 23u}), std::invalid_argument);
+}
@@ -33,6 +33,7 @@ see https://www.gnu.org/licenses/. */
 #include <algorithm>
 #include <iostream>
 #include <iterator>
+#include <sstream>
 #include <thread>
 #include <vector>
 
@@ -82,3 +83,111 @@ BOOST_AUTO_TEST_CASE(data_races_test)
     t1.join();
     t2.join();
 }
+
+// Same as above, with a third thread concurrently resetting the seed.
+BOOST_AUTO_TEST_CASE(set_seed_data_races_test)
+{
+    unsigned N = 10000u;
+    random_device::set_seed(0u);
+    std::vector<detail::random_engine_type::result_type> prs1, prs2, prs3, prs4;
+    std::generate_n(std::back_inserter(prs1), N, random_device::next);
+    std::thread t1([&]() { std::generate_n(std::back_inserter(prs2), N, random_device::next); });
+    std::thread t2([&]() { std::generate_n(std::back_inserter(prs3), N, random_device::next); });
+    std::thread t3([&]() {
+        for (auto i = 0u; i < 1000u; ++i) {
+            random_device::set_seed(i % 2u);
+        }
+    });
+    t1.join();
+    t2.join();
+    t3.join();
+    // After the concurrent activity, setting the seed must restart the sequence.
+    random_device::set_seed(0u);
+    std::generate_n(std::back_inserter(prs4), N, random_device::next);
+    BOOST_CHECK(prs1 == prs4);
+}
+
+BOOST_AUTO_TEST_CASE(philox_test)
+{
+    using e_type = detail::philox4x32;
+
+    // Reference value: the 10000th invocation of a default-constructed
+    // engine (this is the same requirement placed on std::philox4x32 in C++26).
+    e_type e0;
+    for (auto i = 0; i < 9999; ++i) {
+        e0();
+    }
+    BOOST_CHECK_EQUAL(e0(), 1955073260u);
+
+    // Known-answer test from the Random123 suite.
+    const auto b0 = e_type::block(0, 0, 0);
+    BOOST_CHECK_EQUAL(b0[0], 0x6627e8d5u);
+    BOOST_CHECK_EQUAL(b0[1], 0xe169c58du);
+    BOOST_CHECK_EQUAL(b0[2], 0xbc57ac4cu);
+    BOOST_CHECK_EQUAL(b0[3], 0x9b00dbd8u);
+
+    // Seeding.
+    e_type e1(42u), e2;
+    BOOST_CHECK(e1 != e2);
+    e2.seed(42u);
+    BOOST_CHECK(e1 == e2);
+    BOOST_CHECK_EQUAL(e1(), e2());
+    BOOST_CHECK(e1 == e2);
+
+    // discard() must be equivalent to repeated invocations.
+    for (unsigned long long z : {0ull, 1ull, 2ull, 3ull, 4ull, 5ull, 7ull, 8ull, 9ull, 1000ull, 1001ull}) {
+        for (auto pre = 0; pre < 5; ++pre) {
+            e_type a(123u), b(123u);
+            for (auto i = 0; i < pre; ++i) {
+                a();
+                b();
+            }
+            a.discard(z);
+            for (unsigned long long i = 0; i < z; ++i) {
+                b();
+            }
+            BOOST_CHECK(a == b);
+            BOOST_CHECK_EQUAL(a(), b());
+        }
+    }
+
+    // Stateless access and streams.
+    e_type e3(7u);
+    e3.discard(8u);
+    BOOST_CHECK_EQUAL(e3.get_counter(), 2u);
+    BOOST_CHECK_EQUAL(e3.get_stream(), 0u);
+    const auto b2 = e_type::block(7u, 0, 2u);
+    for (auto v : b2) {
+        BOOST_CHECK_EQUAL(e3(), v);
+    }
+    auto s1 = e3.split(1u), s1_copy = e3.split(1u), s2 = e3.split(2u);
+    BOOST_CHECK_EQUAL(s1.get_stream(), 1u);
+    BOOST_CHECK_EQUAL(s1.get_counter(), 0u);
+    BOOST_CHECK(s1 == s1_copy);
+    BOOST_CHECK(s1 != s2);
+    const auto bs = e_type::block(7u, 1u, 0);
+    for (auto v : bs) {
+        BOOST_CHECK_EQUAL(s1(), v);
+    }
+    BOOST_CHECK(e_type(7u, 2u, 0) == s2);
+
+    // Stream operators, in the middle of a block.
+    e_type e4(5u);
+    e4();
+    std::stringstream ss;
+    ss << e4;
+    e_type e5;
+    ss >> e5;
+    BOOST_CHECK(ss);
+    BOOST_CHECK(e4 == e5);
+    for (auto i = 0; i < 10; ++i) {
+        BOOST_CHECK_EQUAL(e4(), e5());
+    }
+    std::stringstream bad("1 2 3");
+    bad >> e5;
+    BOOST_CHECK(!bad);
+    BOOST_CHECK(e4 == e5);
+
+    // Copies are cheap.
+    BOOST_CHECK(sizeof(e_type) < 64u);
+}
@@ -35,15 +35,16 @@ see https://www.gnu.org/licenses/. */
 #include <sstream>
 #include <vector>
 
+#include <pagmo/rng.hpp>
 #include <pagmo/s11n.hpp>
 
 static std::mt19937 rng;
 
 static const int ntrials = 100;
 
-BOOST_AUTO_TEST_CASE(rng_serialization_test)
+template <typename r_type>
+static void rng_serialization_impl()
 {
-    using r_type = std::mt19937;
     using ia_type = boost::archive::binary_iarchive;
     using oa_type = boost::archive::binary_oarchive;
     auto rng_save = [](const r_type &r) {
@@ -62,19 +63,25 @@ BOOST_AUTO_TEST_CASE(rng_serialization_test)
             iarchive >> r;
         }
     };
-    std::uniform_int_distribution<r_type::result_type> dist;
+    std::uniform_int_distribution<typename r_type::result_type> dist;
     for (auto i = 0; i < ntrials; ++i) {
         auto seed = dist(rng);
         r_type r;
         r.seed(seed);
         auto str = rng_save(r);
-        std::vector<r_type::result_type> v1;
+        std::vector<typename r_type::result_type> v1;
         std::generate_n(std::back_inserter(v1), 100, r);
         auto r_copy(r);
         rng_load(str, r);
-        std::vector<r_type::result_type> v2;
+        std::vector<typename r_type::result_type> v2;
         std::generate_n(std::back_inserter(v2), 100, r);
         BOOST_CHECK_EQUAL_COLLECTIONS(v1.begin(), v1.end(), v2.begin(), v2.end());
         BOOST_CHECK(r_copy == r);
     }
 }
+
+BOOST_AUTO_TEST_CASE(rng_serialization_test)
+{
+    rng_serialization_impl<std::mt19937>();
+    rng_serialization_impl<pagmo::detail::philox4x32>();
+}
@@ -37,6 +37,7 @@ see https://www.gnu.org/licenses/. */
 
 #include <pagmo/algorithm.hpp>
 #include <pagmo/algorithms/sade.hpp>
+#include <pagmo/bfe.hpp>
 #include <pagmo/io.hpp>
 #include <pagmo/population.hpp>
 #include <pagmo/problems/hock_schittkowsky_71.hpp>
@@ -173,3 +174,35 @@ BOOST_AUTO_TEST_CASE(serialization_test)
         BOOST_CHECK_CLOSE(std::get<6>(before_log[i]), std::get<6>(after_log[i]), 1e-8);
     }
 }
+
+BOOST_AUTO_TEST_CASE(bfe_test)
+{
+    problem prob{rosenbrock{10u}};
+    for (unsigned variant = 1u; variant <= 18u; ++variant) {
+        // With jDE the generational bfe mode gives the same results as the serial mode.
+        population pop1{prob, 20u, 23u};
+        sade uda1{50u, variant, 1u, 0., 0., false, 23u};
+        uda1.set_verbosity(1u);
+        pop1 = uda1.evolve(pop1);
+
+        population pop2{prob, 20u, 23u};
+        sade uda2{50u, variant, 1u, 0., 0., false, 23u};
+        uda2.set_verbosity(1u);
+        uda2.set_bfe(bfe{});
+        pop2 = uda2.evolve(pop2);
+        BOOST_CHECK(uda1.get_log() == uda2.get_log());
+        BOOST_CHECK(pop1.get_x() == pop2.get_x());
+        BOOST_CHECK(pop1.get_f() == pop2.get_f());
+
+        // With iDE we check the budget and the consistency of the population.
+        population pop3{prob, 20u, 23u};
+        sade uda{50u, variant, 2u, 0., 0., false, 23u};
+        uda.set_bfe(bfe{});
+        const auto fevals0 = pop3.get_problem().get_fevals();
+        pop3 = uda.evolve(pop3);
+        BOOST_CHECK_EQUAL(pop3.get_problem().get_fevals() - fevals0, 50u * 20u);
+        for (decltype(pop3.size()) i = 0u; i < pop3.size(); ++i) {
+            BOOST_CHECK(prob.fitness(pop3.get_x()[i]) == pop3.get_f()[i]);
+        }
+    }
+}
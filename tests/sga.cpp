@@ -35,6 +35,7 @@ see https://www.gnu.org/licenses/. */
 #include <iostream>
 #include <stdexcept>
 #include <string>
+#include <utility>
 
 #include <pagmo/algorithm.hpp>
 #include <pagmo/algorithms/sea.hpp>
@@ -52,6 +53,20 @@ see https://www.gnu.org/licenses/. */
 
 using namespace pagmo;
 
+// A user-defined wrapper of rosenbrock, whose fitness is evaluated
+// through the type-erased interface of the problem.
+struct udp_rosenbrock {
+    vector_double fitness(const vector_double &x) const
+    {
+        return m_r.fitness(x);
+    }
+    std::pair<vector_double, vector_double> get_bounds() const
+    {
+        return m_r.get_bounds();
+    }
+    rosenbrock m_r{10u};
+};
+
 BOOST_AUTO_TEST_CASE(sga_algorithm_construction)
 {
     // sga uda{1u, 0.5, 10., .02, .5, 1u, 2u, "gaussian", "truncated", "sbx", 0u};
@@ -214,3 +229,43 @@ BOOST_AUTO_TEST_CASE(sga_serialization_test)
         BOOST_CHECK_CLOSE(std::get<3>(before_log[i]), std::get<3>(after_log[i]), 1e-8);
     }
 }
+
+BOOST_AUTO_TEST_CASE(sga_scalar_fitness_test)
+{
+    // The evolution of a built-in UDP, evaluated via its scalar_fitness() method,
+    // is identical to the evolution of a user-defined UDP providing only fitness().
+    population pop1{rosenbrock{10u}, 20u, 23u}, pop2{udp_rosenbrock{}, 20u, 23u};
+    pop1 = sga{10u, .9, 1., .02, 1., 2u, "exponential", "polynomial", "tournament", 42u}.evolve(pop1);
+    pop2 = sga{10u, .9, 1., .02, 1., 2u, "exponential", "polynomial", "tournament", 42u}.evolve(pop2);
+    BOOST_CHECK(pop1.get_x() == pop2.get_x());
+    BOOST_CHECK(pop1.get_f() == pop2.get_f());
+    BOOST_CHECK_EQUAL(pop1.get_problem().get_fevals(), pop2.get_problem().get_fevals());
+}
+
+BOOST_AUTO_TEST_CASE(sga_dedup_test)
+{
+    // With low crossover and mutation probabilities, many offspring are copies
+    // of the parents, and their fitness is taken from the deduplication index.
+    population pop1{rosenbrock{10u}, 20u, 23u}, pop2{rosenbrock{10u}, 20u, 23u};
+    pop2.set_dedup(true);
+    sga algo{10u, 0., 1., 0., 1., 2u, "exponential", "polynomial", "tournament", 42u};
+    pop1 = algo.evolve(pop1);
+    algo.set_seed(42u);
+    pop2 = algo.evolve(pop2);
+    BOOST_CHECK(pop1.get_x() == pop2.get_x());
+    BOOST_CHECK(pop1.get_f() == pop2.get_f());
+    BOOST_CHECK_EQUAL(pop1.get_problem().get_fevals(), 220u);
+    BOOST_CHECK(pop2.get_dedup_hits() > 100u);
+    BOOST_CHECK_EQUAL(pop2.get_problem().get_fevals() + pop2.get_dedup_hits(), 220u);
+
+    // With crossover and mutation, the results are unaffected.
+    population pop3{rosenbrock{10u}, 20u, 23u}, pop4{rosenbrock{10u}, 20u, 23u};
+    pop4.set_dedup(true);
+    sga algo2{10u, .9, 1., .02, 1., 2u, "exponential", "polynomial", "tournament", 42u};
+    pop3 = algo2.evolve(pop3);
+    algo2.set_seed(42u);
+    pop4 = algo2.evolve(pop4);
+    BOOST_CHECK(pop3.get_x() == pop4.get_x());
+    BOOST_CHECK(pop3.get_f() == pop4.get_f());
+    BOOST_CHECK_EQUAL(pop3.get_problem().get_fevals(), pop4.get_problem().get_fevals() + pop4.get_dedup_hits());
+}
@@ -0,0 +1,191 @@
+/* Copyright 2017-2020 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#define BOOST_TEST_MODULE tracing_test
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/property_tree/ptree.hpp>
+
+#include <pagmo/algorithms/de.hpp>
+#include <pagmo/archipelago.hpp>
+#include <pagmo/batch_evaluators/default_bfe.hpp>
+#include <pagmo/bfe.hpp>
+#include <pagmo/config.hpp>
+#include <pagmo/population.hpp>
+#include <pagmo/problem.hpp>
+#include <pagmo/problems/rosenbrock.hpp>
+#include <pagmo/topologies/ring.hpp>
+#include <pagmo/tracing.hpp>
+#include <pagmo/types.hpp>
+
+#if defined(PAGMO_WITH_FORK_ISLAND)
+#include <pagmo/islands/fork_island.hpp>
+#endif
+
+using namespace pagmo;
+
+namespace pt = boost::property_tree;
+
+// Parse the output of tracer::dump() and return the list of events.
+static std::vector<pt::ptree> parse_trace()
+{
+    std::stringstream ss;
+    tracer::dump(ss);
+    pt::ptree tree;
+    pt::read_json(ss, tree);
+    std::vector<pt::ptree> retval;
+    for (const auto &p : tree.get_child("traceEvents")) {
+        retval.push_back(p.second);
+    }
+    return retval;
+}
+
+static std::size_t count_events(const std::vector<pt::ptree> &evs, const std::string &name, const std::string &ph)
+{
+    std::size_t retval = 0;
+    for (const auto &ev : evs) {
+        if (ev.get<std::string>("name") == name && ev.get<std::string>("ph") == ph) {
+            ++retval;
+        }
+    }
+    return retval;
+}
+
+BOOST_AUTO_TEST_CASE(tracing_basic_test)
+{
+    tracer::clear();
+    BOOST_CHECK(!tracer::is_enabled());
+    BOOST_CHECK_EQUAL(tracer::get_n_events(), 0u);
+
+    // Nothing is recorded while tracing is disabled.
+    {
+        detail::trace_span span("foo", "bar");
+        detail::trace_instant("baz", "bar");
+    }
+    BOOST_CHECK_EQUAL(tracer::get_n_events(), 0u);
+    BOOST_CHECK(parse_trace().empty());
+
+    tracer::enable();
+    BOOST_CHECK(tracer::is_enabled());
+    {
+        detail::trace_span span("foo", "bar", {{"a", 1}, {"b", -2}});
+        detail::trace_instant("baz", "bar", {{"c", 3}});
+        // Disabling in the middle of a span still records the end event.
+        tracer::disable();
+    }
+    BOOST_CHECK_EQUAL(tracer::get_n_events(), 3u);
+    auto evs = parse_trace();
+    BOOST_CHECK_EQUAL(count_events(evs, "foo", "B"), 1u);
+    BOOST_CHECK_EQUAL(count_events(evs, "foo", "E"), 1u);
+    BOOST_CHECK_EQUAL(count_events(evs, "baz", "i"), 1u);
+    BOOST_CHECK_EQUAL(evs[0].get<int>("args.a"), 1);
+    BOOST_CHECK_EQUAL(evs[0].get<int>("args.b"), -2);
+    BOOST_CHECK_EQUAL(evs[1].get<int>("args.c"), 3);
+    BOOST_CHECK(evs[0].get<double>("ts") <= evs[2].get<double>("ts"));
+
+    // Fill more than one block, from multiple threads.
+    tracer::clear();
+    BOOST_CHECK_EQUAL(tracer::get_n_events(), 0u);
+    tracer::enable();
+    std::vector<std::thread> threads;
+    for (auto i = 0; i < 4; ++i) {
+        threads.emplace_back([]() {
+            for (auto j = 0; j < 3000; ++j) {
+                detail::trace_instant("ev", "test");
+            }
+        });
+    }
+    for (auto &t : threads) {
+        t.join();
+    }
+    tracer::disable();
+    BOOST_CHECK_EQUAL(tracer::get_n_events(), 12000u);
+    BOOST_CHECK_EQUAL(count_events(parse_trace(), "ev", "i"), 12000u);
+
+    // The stream flags are not altered.
+    std::ostringstream oss;
+    oss.precision(42);
+    tracer::dump(oss);
+    BOOST_CHECK_EQUAL(oss.precision(), 42);
+
+    tracer::clear();
+    BOOST_CHECK_THROW(tracer::save(""), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(tracing_archi_test)
+{
+    tracer::clear();
+    tracer::enable();
+
+    archipelago archi{ring{}, 4u, de{1}, rosenbrock{}, 10u};
+    archi.evolve(3);
+    archi.wait_check();
+
+    bfe{default_bfe{}}(problem{rosenbrock{}}, vector_double(4u, 0.5));
+
+    tracer::disable();
+
+    const auto evs = parse_trace();
+    BOOST_CHECK_EQUAL(count_events(evs, "island_evolve", "B"), 12u);
+    BOOST_CHECK_EQUAL(count_events(evs, "island_evolve", "E"), 12u);
+    BOOST_CHECK_EQUAL(count_events(evs, "migration", "B"), count_events(evs, "migration", "E"));
+    BOOST_CHECK_EQUAL(count_events(evs, "bfe", "B"), 1u);
+    BOOST_CHECK_EQUAL(count_events(evs, "bfe", "E"), 1u);
+    for (const auto &ev : evs) {
+        if (ev.get<std::string>("name") == "bfe" && ev.get<std::string>("ph") == "B") {
+            BOOST_CHECK_EQUAL(ev.get<int>("args.n_dvs"), 2);
+        }
+        if (ev.get<std::string>("name") == "migrant_exchange") {
+            BOOST_CHECK(ev.get<int>("args.src") >= 0);
+            BOOST_CHECK(ev.get<int>("args.dst") >= 0);
+            BOOST_CHECK(ev.get<int>("args.n_migrants") >= 0);
+        }
+    }
+
+#if defined(PAGMO_WITH_FORK_ISLAND)
+    tracer::clear();
+    tracer::enable();
+    island isl{fork_island{}, de{1}, population{rosenbrock{}, 10u}};
+    isl.evolve(2);
+    isl.wait_check();
+    tracer::disable();
+    const auto fevs = parse_trace();
+    BOOST_CHECK_EQUAL(count_events(fevs, "fork_island_child", "B"), 2u);
+    BOOST_CHECK_EQUAL(count_events(fevs, "fork_island_child", "E"), 2u);
+#endif
+
+    tracer::clear();
+}
@@ -30,6 +30,7 @@ see https://www.gnu.org/licenses/. */
 #define BOOST_TEST_DYN_LINK
 #include <boost/test/unit_test.hpp>
 
+#include <cmath>
 #include <initializer_list>
 #include <iostream>
 #include <limits> //  std::numeric_limits<double>::infinity();
@@ -40,6 +41,8 @@ see https://www.gnu.org/licenses/. */
 
 #include <pagmo/algorithm.hpp>
 #include <pagmo/algorithms/xnes.hpp>
+#include <pagmo/batch_evaluators/thread_bfe.hpp>
+#include <pagmo/bfe.hpp>
 #include <pagmo/population.hpp>
 #include <pagmo/problems/hock_schittkowsky_71.hpp>
 #include <pagmo/problems/inventory.hpp>
@@ -292,3 +295,39 @@ BOOST_AUTO_TEST_CASE(xnes_memory_test)
     BOOST_CHECK_CLOSE(std::get<2>(log[0]), std::get<2>(log2[1]), 1e-8);
     // the 1 and 0 will be different as fevals is reset at each evolve
 }
+
+BOOST_AUTO_TEST_CASE(xnes_bfe_test)
+{
+    // Evolving with a bfe must give the same result as the serial evolution.
+    xnes user_algo{20u, -1, -1, -1, -1, 1e-6, 1e-6, false, false, 23u};
+    user_algo.set_verbosity(1u);
+    problem prob{rosenbrock{25u}};
+    population pop{prob, 10u, 23u};
+    pop = user_algo.evolve(pop);
+
+    xnes user_algo2{20u, -1, -1, -1, -1, 1e-6, 1e-6, false, false, 23u};
+    user_algo2.set_verbosity(1u);
+    user_algo2.set_bfe(bfe{thread_bfe{}});
+    population pop2{prob, 10u, 23u};
+    pop2 = user_algo2.evolve(pop2);
+
+    BOOST_CHECK(user_algo.get_log().size() > 0u);
+    BOOST_CHECK(user_algo.get_log() == user_algo2.get_log());
+    BOOST_CHECK(pop.get_x() == pop2.get_x());
+    BOOST_CHECK(pop.get_problem().get_fevals() == pop2.get_problem().get_fevals());
+}
+
+BOOST_AUTO_TEST_CASE(xnes_dense_update_test)
+{
+    // When the population is larger than the problem dimension, the update of A
+    // uses the dense matrix exponential.
+    xnes user_algo{50u, 1., 1., 1., 0.5, 1e-6, 1e-6, false, false, 23u};
+    user_algo.set_verbosity(1u);
+    population pop{rosenbrock{4u}, 20u, 23u};
+    pop = user_algo.evolve(pop);
+    BOOST_CHECK(user_algo.get_log().size() > 0u);
+    for (const auto &l : user_algo.get_log()) {
+        BOOST_CHECK(std::isfinite(std::get<3>(l)));
+        BOOST_CHECK(std::isfinite(std::get<5>(l)));
+    }
+}